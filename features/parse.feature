@@ -21,3 +21,41 @@ Feature: Parse a blueprint
     When I run `snowcrash --format=json` interactively
     When I pipe in the file "blueprint.apib"
     Then the output should contain the content of file "ast.json"
+
+  Scenario: Parse a blueprint file into compact JSON
+
+    When I run `snowcrash --format=json --compact blueprint.apib`
+    Then the output should contain the content of file "ast.compact.json"
+
+  Scenario: Parse blueprint files into output files named by a template
+
+    When I run `snowcrash --format=json --output=../../tmp/aruba/{name}.{ext} blueprint.apib invalid_blueprint.apib`
+    Then the file "../../tmp/aruba/blueprint.json" should contain the content of file "ast.json"
+    And a file named "../../tmp/aruba/invalid_blueprint.json" should exist
+    And the output should contain "2 files, 0 failed"
+    And the exit status should be 0
+
+  Scenario: Parse blueprint files of a directory in parallel
+
+    When I run `snowcrash --validate --jobs=2 .`
+    Then the output should contain "./blueprint.apib:"
+    And the output should contain "./invalid_blueprint.apib:"
+    And the output should contain "2 files, 0 failed"
+    And the exit status should be 0
+
+  Scenario: Report a file failing in a batch
+
+    When I run `snowcrash --validate blueprint.apib missing.apib`
+    Then the output should contain:
+    """
+    missing.apib:
+    fatal: unable to open input file 'missing.apib'
+    """
+    And the output should contain "2 files, 1 failed"
+    And the exit status should be 1
+
+  Scenario: Reject an output file name template giving one file for more input files
+
+    When I run `snowcrash --output=ast.out blueprint.apib invalid_blueprint.apib`
+    Then the output should contain "fatal: output file name template gives the same file for more input files"
+    And the exit status should be 1
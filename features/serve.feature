@@ -0,0 +1,12 @@
+Feature: Serve JSON-RPC requests
+
+  Scenario: Serve requests read line by line
+
+    When I run `snowcrash --serve` interactively
+    When I pipe in the file "requests.jsonrpc"
+    Then the output should contain:
+    """
+    {"jsonrpc":"2.0","id":1,"result":{"report":{"error":{"code":0,"message":"","location":[]},"warnings":[{"code":5,"message":"unexpected header block, expected a group, resource or an action definition, e.g. '# Group <name>', '# <resource name> [<URI>]' or '# <HTTP method> <URI>'","location":[[24,29]]}]}}}
+    {"jsonrpc":"2.0","id":2,"error":{"code":-32601,"message":"unknown method 'render'"}}
+    """
+    And the exit status should be 0
@@ -6,3 +6,14 @@ Then /^the output should contain the content of file "(.*)"$/ do |filename|
 
   assert_partial_output(expected, all_output)
 end
+
+Then /^the file "(.*)" should contain the content of file "(.*)"$/ do |filename, expected_filename|
+  actual = nil
+  expected = nil
+  in_current_dir do
+    actual = File.read(filename)
+    expected = File.read(expected_filename)
+  end
+
+  assert_partial_output(expected, actual)
+end
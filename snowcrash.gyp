@@ -60,20 +60,42 @@
         'ext/markdown-parser/ext/sundown/html'
       ],
       'sources': [
+        'src/BinaryBlueprint.cc',
+        'src/BinaryBlueprint.h',
+        'src/BufferedWriter.cc',
+        'src/BufferedWriter.h',
+        'src/CBinaryBlueprint.cc',
+        'src/CBinaryBlueprint.h',
         'src/CBlueprint.cc',
         'src/CBlueprint.h',
         'src/CBlueprintSourcemap.cc',
         'src/CBlueprintSourcemap.h',
         'src/CSourceAnnotation.cc',
         'src/CSourceAnnotation.h',
+        'src/CompactSourceMap.cc',
+        'src/CompactSourceMap.h',
+        'src/DeserializeJSON.cc',
+        'src/DeserializeJSON.h',
+        'src/FlatMarkdown.cc',
+        'src/FlatMarkdown.h',
         'src/HTTP.cc',
         'src/HTTP.h',
+        'src/JSONReader.cc',
+        'src/JSONReader.h',
+        'src/JSONWriter.cc',
+        'src/JSONWriter.h',
         'src/Section.cc',
         'src/Section.h',
         'src/Serialize.cc',
         'src/Serialize.h',
+        'src/SerializeCBOR.cc',
+        'src/SerializeCBOR.h',
         'src/SerializeJSON.cc',
         'src/SerializeJSON.h',
+        'src/SerializeMessagePack.cc',
+        'src/SerializeMessagePack.h',
+        'src/SerializeNDJSON.cc',
+        'src/SerializeNDJSON.h',
         'src/SerializeYAML.cc',
         'src/SerializeYAML.h',
         'src/Signature.cc',
@@ -82,8 +104,14 @@
         'src/snowcrash.h',
         'src/csnowcrash.cc',
         'src/csnowcrash.h',
+        'src/UriTemplateExpander.cc',
+        'src/UriTemplateExpander.h',
         'src/UriTemplateParser.cc',
         'src/UriTemplateParser.h',
+        'src/UriTemplateRouter.cc',
+        'src/UriTemplateRouter.h',
+        'src/YAMLWriter.cc',
+        'src/YAMLWriter.h',
         'src/PayloadParser.h',
         'src/SectionParserData.h',
         'src/ActionParser.h',
@@ -92,8 +120,13 @@
         'src/BlueprintParser.h',
         'src/BlueprintSourcemap.h',
         'src/BlueprintUtility.h',
+        'src/BlueprintVisitor.h',
         'src/CodeBlockUtility.h',
+        'src/DeserializeBlueprint.h',
+        'src/Directory.h',
         'src/HeadersParser.h',
+        'src/MappedFile.h',
+        'src/Parallel.h',
         'src/ParameterParser.h',
         'src/ParametersParser.h',
         'src/Platform.h',
@@ -110,8 +143,10 @@
       ],
       'conditions': [
         [ 'OS=="win"',
-          { 'sources': [ 'src/win/RegexMatch.cc' ] },
-          { 'sources': [ 'src/posix/RegexMatch.cc' ] } # OS != Windows
+          { 'sources': [ 'src/win/Directory.cc', 'src/win/MappedFile.cc', 'src/win/Parallel.cc', 'src/win/RegexMatch.cc' ] },
+          { 'sources': [ 'src/posix/Directory.cc', 'src/posix/MappedFile.cc', 'src/posix/Parallel.cc', 'src/posix/RegexMatch.cc' ],
+            'link_settings': { 'libraries': [ '-lpthread' ] }
+          } # OS != Windows
         ]
       ],
       'dependencies': [
@@ -123,6 +158,7 @@
       'type': 'executable',
       'include_dirs': [
         'src',
+        'src/snowcrash',
         'test',
         'test/vendor/Catch/include',
         'ext/markdown-parser/src',
@@ -132,24 +168,43 @@
       'sources': [
         'test/test-ActionParser.cc',
         'test/test-AssetParser.cc',
+        'test/test-Batch.cc',
+        'test/test-BinaryBlueprint.cc',
         'test/test-Blueprint.cc',
         'test/test-BlueprintParser.cc',
+        'test/test-BlueprintVisitor.cc',
+        'test/test-CompactSourceMap.cc',
+        'test/test-DeserializeJSON.cc',
         'test/test-HeadersParser.cc',
         'test/test-Indentation.cc',
+        'test/test-JSONReader.cc',
+        'test/test-JSONWriter.cc',
         'test/test-ParameterParser.cc',
+        'test/test-Parallel.cc',
         'test/test-ParametersParser.cc',
         'test/test-PayloadParser.cc',
         'test/test-RegexMatch.cc',
         'test/test-ResourceParser.cc',
         'test/test-ResourceGroupParser.cc',
         'test/test-SectionParser.cc',
+        'test/test-SerializeCBOR.cc',
+        'test/test-SerializeJSON.cc',
+        'test/test-SerializeMessagePack.cc',
+        'test/test-SerializeNDJSON.cc',
+        'test/test-SerializeRoundTrip.cc',
+        'test/test-Server.cc',
         'test/test-SymbolIdentifier.cc',
         'test/test-SymbolTable.cc',
+        'test/test-UriTemplateExpander.cc',
         'test/test-UriTemplateParser.cc',
+        'test/test-UriTemplateRouter.cc',
         'test/test-ValuesParser.cc',
+        'test/test-YAMLWriter.cc',
         'test/test-Warnings.cc',
         'test/test-csnowcrash.cc',
-        'test/test-snowcrash.cc'
+        'test/test-snowcrash.cc',
+        'src/snowcrash/Batch.cc',
+        'src/snowcrash/Server.cc'
       ],
       'dependencies': [
         'libsnowcrash',
@@ -167,6 +222,10 @@
         'ext/cmdline'
       ],
       'sources': [
+        'src/snowcrash/Batch.cc',
+        'src/snowcrash/Batch.h',
+        'src/snowcrash/Server.cc',
+        'src/snowcrash/Server.h',
         'src/snowcrash/snowcrash.cc'
       ],
       'dependencies': [
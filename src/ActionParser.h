@@ -37,8 +37,8 @@ namespace snowcrash {
     /**
      * Action Section processor
      */
-    template<>
-    struct SectionProcessor<Action> : public SectionProcessorBase<Action> {
+    template<typename Policy>
+    struct SectionProcessor<Action, Policy> : public SectionProcessorBase<Action, Policy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -52,7 +52,7 @@ namespace snowcrash {
             mdp::ByteBuffer remainingContent;
             GetFirstLine(node->text, remainingContent);
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 if (!out.node.method.empty()) {
                     out.sourceMap.method.sourceMap = node->sourceMap;
                 }
@@ -65,7 +65,7 @@ namespace snowcrash {
             if (!remainingContent.empty()) {
                 out.node.description += remainingContent;
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     out.sourceMap.description.sourceMap.append(node->sourceMap);
                 }
             }
@@ -82,38 +82,35 @@ namespace snowcrash {
             MarkdownNodeIterator cur = node;
             std::stringstream ss;
 
-            mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-
             switch (sectionType) {
                 case ParametersSectionType:
                 {
                     ParseResultRef<Parameters> parameters(out.report, out.node.parameters, out.sourceMap.parameters);
-                    return ParametersParser::parse(node, siblings, pd, parameters);
+                    return SectionParser<Parameters, ListSectionAdapter, Policy>::parse(node, siblings, pd, parameters);
                 }
 
                 case RequestSectionType:
                 case RequestBodySectionType:
                 {
-                    IntermediateParseResult<Payload> payload(out.report);
+                    IntermediateParseResult<Payload, Policy> payload(out.report);
 
-                    cur = PayloadParser::parse(node, siblings, pd, payload);
+                    cur = SectionParser<Payload, ListSectionAdapter, Policy>::parse(node, siblings, pd, payload);
 
                     if (out.node.examples.empty() || !out.node.examples.back().responses.empty()) {
                         TransactionExample transaction;
-                        SourceMap<TransactionExample> transactionSM;
 
                         out.node.examples.push_back(transaction);
 
-                        if (pd.exportSourceMap()) {
-                            out.sourceMap.examples.collection.push_back(transactionSM);
+                        if (Policy::exportSourceMap(pd)) {
+                            out.sourceMap.examples.collection.push_back(SourceMap<TransactionExample>());
                         }
                     }
 
-                    checkPayload(sectionType, sourceMap, payload.node, out);
+                    checkPayload(sectionType, node, pd, payload.node, out);
 
                     out.node.examples.back().requests.push_back(payload.node);
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         out.sourceMap.examples.collection.back().requests.collection.push_back(payload.sourceMap);
                     }
 
@@ -123,26 +120,25 @@ namespace snowcrash {
                 case ResponseSectionType:
                 case ResponseBodySectionType:
                 {
-                    IntermediateParseResult<Payload> payload(out.report);
+                    IntermediateParseResult<Payload, Policy> payload(out.report);
 
-                    cur = PayloadParser::parse(node, siblings, pd, payload);
+                    cur = SectionParser<Payload, ListSectionAdapter, Policy>::parse(node, siblings, pd, payload);
 
                     if (out.node.examples.empty()) {
                         TransactionExample transaction;
-                        SourceMap<TransactionExample> transactionSM;
 
                         out.node.examples.push_back(transaction);
 
-                        if (pd.exportSourceMap()) {
-                            out.sourceMap.examples.collection.push_back(transactionSM);
+                        if (Policy::exportSourceMap(pd)) {
+                            out.sourceMap.examples.collection.push_back(SourceMap<TransactionExample>());
                         }
                     }
 
-                    checkPayload(sectionType, sourceMap, payload.node, out);
+                    checkPayload(sectionType, node, pd, payload.node, out);
 
                     out.node.examples.back().responses.push_back(payload.node);
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         out.sourceMap.examples.collection.back().responses.collection.push_back(payload.sourceMap);
                     }
 
@@ -152,7 +148,7 @@ namespace snowcrash {
                 case HeadersSectionType:
                 {
                     ParseResultRef<Headers> headers(out.report, out.node.headers, out.sourceMap.headers);
-                    return SectionProcessor<Action>::handleDeprecatedHeaders(node, siblings, pd, headers);
+                    return SectionProcessor<Action, Policy>::handleDeprecatedHeaders(node, siblings, pd, headers);
                 }
 
                 default:
@@ -165,11 +161,11 @@ namespace snowcrash {
         static bool isUnexpectedNode(const MarkdownNodeIterator& node,
                                      SectionType sectionType) {
 
-            if (SectionProcessor<Asset>::sectionType(node) != UndefinedSectionType) {
+            if (SectionProcessor<Asset, Policy>::sectionType(node) != UndefinedSectionType) {
                 return true;
             }
 
-            return SectionProcessorBase<Action>::isUnexpectedNode(node, sectionType);
+            return SectionProcessorBase<Action, Policy>::isUnexpectedNode(node, sectionType);
         }
 
         static MarkdownNodeIterator processUnexpectedNode(const MarkdownNodeIterator& node,
@@ -187,7 +183,7 @@ namespace snowcrash {
 
                 mdp::ByteBuffer content = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, out.node.examples.back().responses.back().body);
 
-                if (pd.exportSourceMap() && !content.empty()) {
+                if (Policy::exportSourceMap(pd) && !content.empty()) {
                     out.sourceMap.examples.collection.back().responses.collection.back().body.sourceMap.append(node->sourceMap);
                 }
 
@@ -203,32 +199,35 @@ namespace snowcrash {
 
                 mdp::ByteBuffer content = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, out.node.examples.back().requests.back().body);
 
-                if (pd.exportSourceMap() && !content.empty()) {
+                if (Policy::exportSourceMap(pd) && !content.empty()) {
                     out.sourceMap.examples.collection.back().requests.collection.back().body.sourceMap.append(node->sourceMap);
                 }
 
                 return ++MarkdownNodeIterator(node);
             }
 
-            SectionType assetType = SectionProcessor<Asset>::sectionType(node);
+            SectionType assetType = SectionProcessor<Asset, Policy>::sectionType(node);
 
             if (assetType != UndefinedSectionType) {
 
                 // WARN: Ignoring section
-                std::stringstream ss;
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                if (pd.reportsWarning(out.report, IgnoringWarning)) {
 
-                ss << "Ignoring " << SectionName(assetType) << " list item, ";
-                ss << SectionName(assetType) << " list item is expected to be indented by 4 spaces or 1 tab";
+                    std::stringstream ss;
+                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
 
-                out.report.warnings.push_back(Warning(ss.str(),
-                                                      IgnoringWarning,
-                                                      sourceMap));
+                    ss << "Ignoring " << SectionName(assetType) << " list item, ";
+                    ss << SectionName(assetType) << " list item is expected to be indented by 4 spaces or 1 tab";
+
+                    out.report.warnings.push_back(Warning(ss.str(),
+                                                          IgnoringWarning,
+                                                          sourceMap));
+                }
 
                 return ++MarkdownNodeIterator(node);
             }
 
-            return SectionProcessorBase<Action>::processUnexpectedNode(node, siblings, pd, sectionType, out);
+            return SectionProcessorBase<Action, Policy>::processUnexpectedNode(node, siblings, pd, sectionType, out);
         }
 
         static SectionType sectionType(const MarkdownNodeIterator& node) {
@@ -254,21 +253,21 @@ namespace snowcrash {
             SectionType nestedType = UndefinedSectionType;
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = SectionProcessor<Parameters, Policy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = SectionProcessor<Headers, Policy>::sectionType(node);
 
             if (nestedType == HeadersSectionType) {
                 return nestedType;
             }
 
             // Check if payload section
-            nestedType = SectionProcessor<Payload>::sectionType(node);
+            nestedType = SectionProcessor<Payload, Policy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -286,7 +285,7 @@ namespace snowcrash {
             nested.push_back(RequestBodySectionType);
             nested.push_back(RequestSectionType);
 
-            types = SectionProcessor<Payload>::nestedSectionTypes();
+            types = SectionProcessor<Payload, Policy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -298,14 +297,17 @@ namespace snowcrash {
 
             if (!out.node.headers.empty()) {
 
-                SectionProcessor<Headers>::injectDeprecatedHeaders(pd, out.node.headers, out.sourceMap.headers, out.node.examples, out.sourceMap.examples);
+                SectionProcessor<Headers, Policy>::injectDeprecatedHeaders(pd, out.node.headers, out.sourceMap.headers, out.node.examples, out.sourceMap.examples);
                 out.node.headers.clear();
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     out.sourceMap.headers.collection.clear();
                 }
             }
 
+            if (!pd.reportsWarning(out.report, EmptyDefinitionWarning))
+                return;
+
             if (out.node.examples.empty()) {
 
                 // WARN: No response for action
@@ -337,23 +339,26 @@ namespace snowcrash {
         /**
          *  \brief  Check & report payload validity.
          *  \param  sectionType A section of the payload.
-         *  \param  sourceMap   Payload signature source map.
+         *  \param  node        Payload signature node.
+         *  \param  pd          Parser data.
          *  \param  payload     The payload to be checked.
-         *  \param  action      The Action to which payload belongs to.
-         *  \param  report      Parser report.
+         *  \param  out         The Action to which payload belongs to.
          */
         static void checkPayload(SectionType sectionType,
-                                 const mdp::CharactersRangeSet sourceMap,
+                                 const MarkdownNodeIterator& node,
+                                 const SectionParserData& pd,
                                  const Payload& payload,
                                  const ParseResultRef<Action>& out) {
 
-            if (isPayloadDuplicate(sectionType, payload, out.node.examples.back())) {
+            if (pd.reportsWarning(out.report, DuplicateWarning) &&
+                isPayloadDuplicate(sectionType, payload, out.node.examples.back())) {
 
                 // WARN: Duplicate payload
                 std::stringstream ss;
                 ss << SectionName(sectionType) << " payload `" << payload.name << "`";
                 ss << " already defined for `" << out.node.method << "` method";
 
+                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
                 out.report.warnings.push_back(Warning(ss.str(),
                                                       DuplicateWarning,
                                                       sourceMap));
@@ -369,7 +374,10 @@ namespace snowcrash {
 
                 HTTPMethodTraits methodTraits = GetMethodTrait(out.node.method);
 
-                if (!methodTraits.allowBody && !payload.body.empty()) {
+                if (!methodTraits.allowBody && !payload.body.empty() &&
+                    pd.reportsWarning(out.report, EmptyDefinitionWarning)) {
+
+                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
 
                     // WARN: Edge case for 2xx CONNECT
                     if (out.node.method == HTTPMethodName::Connect && code/100 == 2) {
@@ -405,11 +413,11 @@ namespace snowcrash {
 
             if (sectionType == RequestSectionType) {
 
-                RequestIterator duplicate = SectionProcessor<Payload>::findRequest(example, payload);
+                RequestIterator duplicate = SectionProcessor<Payload, Policy>::findRequest(example, payload);
                 return duplicate != example.requests.end();
             } else if (sectionType == ResponseSectionType) {
 
-                ResponseIterator duplicate = SectionProcessor<Payload>::findResponse(example, payload);
+                ResponseIterator duplicate = SectionProcessor<Payload, Policy>::findResponse(example, payload);
                 return duplicate != example.responses.end();
             }
 
@@ -422,16 +430,19 @@ namespace snowcrash {
                                                             SectionParserData& pd,
                                                             const ParseResultRef<Headers>& out) {
 
-            MarkdownNodeIterator cur = HeadersParser::parse(node, siblings, pd, out);
+            MarkdownNodeIterator cur = SectionParser<Headers, ListSectionAdapter, Policy>::parse(node, siblings, pd, out);
 
             // WARN: Deprecated header sections
-            std::stringstream ss;
-            ss << "the 'headers' section at this level is deprecated and will be removed in a future, use respective payload header section(s) instead";
+            if (pd.reportsWarning(out.report, DeprecatedWarning)) {
+
+                std::stringstream ss;
+                ss << "the 'headers' section at this level is deprecated and will be removed in a future, use respective payload header section(s) instead";
 
-            mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-            out.report.warnings.push_back(Warning(ss.str(),
-                                                  DeprecatedWarning,
-                                                  sourceMap));
+                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                out.report.warnings.push_back(Warning(ss.str(),
+                                                      DeprecatedWarning,
+                                                      sourceMap));
+            }
 
             return cur;
         }
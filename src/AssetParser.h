@@ -33,8 +33,8 @@ namespace snowcrash {
     /**
      *  Asset Section Processor
      */
-    template<>
-    struct SectionProcessor<Asset> : public SectionProcessorBase<Asset> {
+    template<typename Policy>
+    struct SectionProcessor<Asset, Policy> : public SectionProcessorBase<Asset, Policy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -45,7 +45,7 @@ namespace snowcrash {
             out.node = "";
             CodeBlockUtility::signatureContentAsCodeBlock(node, pd, out.report, out.node);
 
-            if (pd.exportSourceMap() && !out.node.empty()) {
+            if (Policy::exportSourceMap(pd) && !out.node.empty()) {
                 out.sourceMap.sourceMap.append(node->sourceMap);
             }
 
@@ -70,7 +70,7 @@ namespace snowcrash {
 
             out.node += content;
 
-            if (pd.exportSourceMap() && !content.empty()) {
+            if (Policy::exportSourceMap(pd) && !content.empty()) {
                 out.sourceMap.sourceMap.append(node->sourceMap);
             }
 
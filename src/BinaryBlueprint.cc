@@ -0,0 +1,733 @@
+//
+//  BinaryBlueprint.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <climits>
+#include <cstring>
+#include <map>
+#include <vector>
+#include "BinaryBlueprint.h"
+
+using namespace snowcrash;
+
+/** Alignment of records in the image */
+static const size_t BinaryAlignment = 4;
+
+/** Offset of a field of the record at given offset */
+#define FIELD(Record, record, field) ((record) + offsetof(Record, field))
+
+namespace snowcrash {
+
+    /**
+     *  \brief Binary image under construction
+     *
+     *  Records are referred to by their offsets in the image as the image
+     *  grows. Strings are collected and written into the string pool at
+     *  the end of the image, every distinct string only once.
+     */
+    class BinaryImageBuilder {
+    public:
+        BinaryImageBuilder() : overflow(false) {}
+
+        std::vector<char> data;
+
+        /** Set if a value does not fit its record field */
+        bool overflow;
+
+        /** Allocate zeroed aligned block, \return offset of the block */
+        size_t allocate(size_t size) {
+            size_t offset = (data.size() + BinaryAlignment - 1) & ~(BinaryAlignment - 1);
+            data.resize(offset + size, 0);
+            return offset;
+        }
+
+        /** \return Record at given offset */
+        template<typename T>
+        T& at(size_t offset) {
+            return *reinterpret_cast<T*>(&data[offset]);
+        }
+
+        /** Set string field at given offset */
+        void string(size_t field, const std::string& value) {
+            strings.push_back(std::make_pair(field, &value));
+        }
+
+        /** Allocate array of records for the array field, \return offset of the first record */
+        template<typename T>
+        size_t array(size_t field, size_t size) {
+            if (size == 0)
+                return 0;
+
+            size_t first = allocate(size * sizeof(T));
+
+            BinaryArray<T>& array = at<BinaryArray<T> >(field);
+            array.offset = static_cast<unsigned int>(first - field);
+            array.size = static_cast<unsigned int>(size);
+
+            return first;
+        }
+
+        /** Write the string pool and resolve all string fields */
+        void finalize() {
+
+            typedef std::map<std::string, size_t> StringPool;
+            StringPool pool;
+
+            for (std::vector<StringField>::const_iterator it = strings.begin(); it != strings.end(); ++it) {
+
+                const std::string& value = *it->second;
+                StringPool::iterator pooled = pool.find(value);
+
+                if (pooled == pool.end()) {
+                    size_t offset = data.size();
+                    data.insert(data.end(), value.begin(), value.end());
+                    data.push_back('\0');
+                    pooled = pool.insert(std::make_pair(value, offset)).first;
+                }
+
+                BinaryString& field = at<BinaryString>(it->first);
+                field.offset = static_cast<unsigned int>(pooled->second - it->first);
+                field.length = static_cast<unsigned int>(value.size());
+            }
+
+            data.resize(allocate(0));
+            strings.clear();
+        }
+
+    private:
+        typedef std::pair<size_t, const std::string*> StringField;
+        std::vector<StringField> strings;
+    };
+}
+
+static void WriteKeyValues(BinaryImageBuilder& image, size_t field, const Collection<KeyValuePair>::type& keyValues)
+{
+    size_t record = image.array<BinaryKeyValue>(field, keyValues.size());
+
+    for (Collection<KeyValuePair>::const_iterator it = keyValues.begin();
+         it != keyValues.end();
+         ++it, record += sizeof(BinaryKeyValue)) {
+
+        image.string(FIELD(BinaryKeyValue, record, key), it->first);
+        image.string(FIELD(BinaryKeyValue, record, value), it->second);
+    }
+}
+
+static void WriteParameters(BinaryImageBuilder& image, size_t field, const Parameters& parameters)
+{
+    size_t record = image.array<BinaryParameter>(field, parameters.size());
+
+    for (Collection<Parameter>::const_iterator it = parameters.begin();
+         it != parameters.end();
+         ++it, record += sizeof(BinaryParameter)) {
+
+        image.string(FIELD(BinaryParameter, record, name), it->name);
+        image.string(FIELD(BinaryParameter, record, description), it->description);
+        image.string(FIELD(BinaryParameter, record, type), it->type);
+        image.at<BinaryParameter>(record).use = it->use;
+        image.string(FIELD(BinaryParameter, record, defaultValue), it->defaultValue);
+        image.string(FIELD(BinaryParameter, record, exampleValue), it->exampleValue);
+
+        size_t value = image.array<BinaryString>(FIELD(BinaryParameter, record, values), it->values.size());
+
+        for (Values::const_iterator valueIt = it->values.begin();
+             valueIt != it->values.end();
+             ++valueIt, value += sizeof(BinaryString)) {
+
+            image.string(value, *valueIt);
+        }
+    }
+}
+
+static void WritePayload(BinaryImageBuilder& image, size_t record, const Payload& payload)
+{
+    image.string(FIELD(BinaryPayload, record, name), payload.name);
+    image.string(FIELD(BinaryPayload, record, description), payload.description);
+    WriteParameters(image, FIELD(BinaryPayload, record, parameters), payload.parameters);
+    WriteKeyValues(image, FIELD(BinaryPayload, record, headers), payload.headers);
+    image.string(FIELD(BinaryPayload, record, body), payload.body);
+    image.string(FIELD(BinaryPayload, record, schema), payload.schema);
+
+    size_t reference = FIELD(BinaryPayload, record, reference);
+    image.string(FIELD(BinaryReference, reference, id), payload.reference.id);
+
+    // Type of an unset reference is undefined
+    if (!payload.reference.id.empty())
+        image.at<BinaryReference>(reference).type = payload.reference.type;
+}
+
+static void WritePayloads(BinaryImageBuilder& image, size_t field, const Collection<Payload>::type& payloads)
+{
+    size_t record = image.array<BinaryPayload>(field, payloads.size());
+
+    for (Collection<Payload>::const_iterator it = payloads.begin();
+         it != payloads.end();
+         ++it, record += sizeof(BinaryPayload)) {
+
+        WritePayload(image, record, *it);
+    }
+}
+
+static void WriteActions(BinaryImageBuilder& image, size_t field, const Actions& actions)
+{
+    size_t record = image.array<BinaryAction>(field, actions.size());
+
+    for (Collection<Action>::const_iterator it = actions.begin();
+         it != actions.end();
+         ++it, record += sizeof(BinaryAction)) {
+
+        image.string(FIELD(BinaryAction, record, method), it->method);
+        image.string(FIELD(BinaryAction, record, name), it->name);
+        image.string(FIELD(BinaryAction, record, description), it->description);
+        WriteParameters(image, FIELD(BinaryAction, record, parameters), it->parameters);
+        WriteKeyValues(image, FIELD(BinaryAction, record, headers), it->headers);
+
+        size_t example = image.array<BinaryTransactionExample>(FIELD(BinaryAction, record, examples),
+                                                               it->examples.size());
+
+        for (TransactionExamples::const_iterator exampleIt = it->examples.begin();
+             exampleIt != it->examples.end();
+             ++exampleIt, example += sizeof(BinaryTransactionExample)) {
+
+            image.string(FIELD(BinaryTransactionExample, example, name), exampleIt->name);
+            image.string(FIELD(BinaryTransactionExample, example, description), exampleIt->description);
+            WritePayloads(image, FIELD(BinaryTransactionExample, example, requests), exampleIt->requests);
+            WritePayloads(image, FIELD(BinaryTransactionExample, example, responses), exampleIt->responses);
+        }
+    }
+}
+
+static void WriteBlueprint(BinaryImageBuilder& image, size_t record, const Blueprint& blueprint)
+{
+    WriteKeyValues(image, FIELD(BinaryBlueprint, record, metadata), blueprint.metadata);
+    image.string(FIELD(BinaryBlueprint, record, name), blueprint.name);
+    image.string(FIELD(BinaryBlueprint, record, description), blueprint.description);
+
+    size_t group = image.array<BinaryResourceGroup>(FIELD(BinaryBlueprint, record, resourceGroups),
+                                                    blueprint.resourceGroups.size());
+
+    for (ResourceGroups::const_iterator it = blueprint.resourceGroups.begin();
+         it != blueprint.resourceGroups.end();
+         ++it, group += sizeof(BinaryResourceGroup)) {
+
+        image.string(FIELD(BinaryResourceGroup, group, name), it->name);
+        image.string(FIELD(BinaryResourceGroup, group, description), it->description);
+
+        size_t resource = image.array<BinaryResource>(FIELD(BinaryResourceGroup, group, resources),
+                                                      it->resources.size());
+
+        for (Resources::const_iterator resourceIt = it->resources.begin();
+             resourceIt != it->resources.end();
+             ++resourceIt, resource += sizeof(BinaryResource)) {
+
+            image.string(FIELD(BinaryResource, resource, uriTemplate), resourceIt->uriTemplate);
+            image.string(FIELD(BinaryResource, resource, name), resourceIt->name);
+            image.string(FIELD(BinaryResource, resource, description), resourceIt->description);
+            WritePayload(image, FIELD(BinaryResource, resource, model), resourceIt->model);
+            WriteParameters(image, FIELD(BinaryResource, resource, parameters), resourceIt->parameters);
+            WriteKeyValues(image, FIELD(BinaryResource, resource, headers), resourceIt->headers);
+            WriteActions(image, FIELD(BinaryResource, resource, actions), resourceIt->actions);
+        }
+    }
+}
+
+/** Write a table of the compact source map */
+template<typename T, typename U>
+static void WriteTable(BinaryImageBuilder& image, size_t field, const std::vector<U>& table)
+{
+    size_t record = image.array<T>(field, table.size());
+
+    for (typename std::vector<U>::const_iterator it = table.begin(); it != table.end(); ++it, record += sizeof(T)) {
+        image.at<T>(record) = static_cast<T>(*it);
+
+        if (static_cast<U>(image.at<T>(record)) != *it)
+            image.overflow = true;
+    }
+}
+
+static void WriteSourceMap(BinaryImageBuilder& image, size_t field, const CompactSourceMap& sourceMap)
+{
+    size_t record = image.array<BinarySourceMap>(field, 1);
+
+    WriteTable<unsigned char>(image, FIELD(BinarySourceMap, record, nodeKinds), sourceMap.nodeKinds);
+    WriteTable<unsigned int>(image, FIELD(BinarySourceMap, record, nodeParents), sourceMap.nodeParents);
+    WriteTable<unsigned int>(image, FIELD(BinarySourceMap, record, nodeEntries), sourceMap.nodeEntries);
+    WriteTable<unsigned int>(image, FIELD(BinarySourceMap, record, entryNodes), sourceMap.entryNodes);
+    WriteTable<unsigned char>(image, FIELD(BinarySourceMap, record, entryFields), sourceMap.entryFields);
+    WriteTable<unsigned int>(image, FIELD(BinarySourceMap, record, entryRanges), sourceMap.entryRanges);
+    WriteTable<unsigned int>(image, FIELD(BinarySourceMap, record, rangeLocations), sourceMap.rangeLocations);
+    WriteTable<unsigned int>(image, FIELD(BinarySourceMap, record, rangeLengths), sourceMap.rangeLengths);
+}
+
+/** Build image of the blueprint and optional source map, \return false if it does not fit the 32-bit fields */
+static bool BuildImage(const Blueprint& blueprint,
+                       const CompactSourceMap* sourceMap,
+                       std::vector<char>& data)
+{
+    BinaryImageBuilder image;
+    size_t header = image.allocate(sizeof(BinaryBlueprintImage));
+
+    WriteBlueprint(image, FIELD(BinaryBlueprintImage, header, blueprint), blueprint);
+
+    if (sourceMap)
+        WriteSourceMap(image, FIELD(BinaryBlueprintImage, header, sourceMap), *sourceMap);
+
+    image.finalize();
+
+    // Offsets and sizes are narrowed to 32 bits as the image grows, all of
+    // them are less than the size of the whole image
+    if (image.overflow || image.data.size() > UINT_MAX) {
+        data.clear();
+        return false;
+    }
+
+    BinaryBlueprintImage& info = image.at<BinaryBlueprintImage>(header);
+    info.magic = BinaryBlueprintMagic;
+    info.version = BinaryBlueprintVersion;
+    info.size = static_cast<unsigned int>(image.data.size());
+    info.flags = sourceMap ? SourceMapBinaryBlueprintFlag : 0;
+
+    data.swap(image.data);
+    return true;
+}
+
+void snowcrash::SerializeBinaryBlueprint(const Blueprint& blueprint, std::ostream& os)
+{
+    std::vector<char> data;
+
+    if (!BuildBinaryBlueprint(blueprint, NULL, data)) {
+        os.setstate(std::ios_base::failbit);
+        return;
+    }
+
+    os.write(&data[0], data.size());
+}
+
+void snowcrash::SerializeBinaryBlueprint(const Blueprint& blueprint,
+                                         const SourceMap<Blueprint>& sourceMap,
+                                         std::ostream& os)
+{
+    std::vector<char> data;
+
+    if (!BuildBinaryBlueprint(blueprint, &sourceMap, data)) {
+        os.setstate(std::ios_base::failbit);
+        return;
+    }
+
+    os.write(&data[0], data.size());
+}
+
+bool snowcrash::BuildBinaryBlueprint(const Blueprint& blueprint,
+                                     const SourceMap<Blueprint>* sourceMap,
+                                     std::vector<char>& image)
+{
+    if (!sourceMap)
+        return BuildImage(blueprint, NULL, image);
+
+    CompactSourceMap compact;
+    BuildCompactSourceMap(*sourceMap, compact);
+
+    return BuildImage(blueprint, &compact, image);
+}
+
+namespace snowcrash {
+
+    /**
+     *  \brief Binary image bounds checker
+     *
+     *  Arrays are checked in the order the builder writes them and every
+     *  array has to start past the end of the previous one. Arrays can't
+     *  overlap or be referred to twice, so no record is checked more than
+     *  once and the check is linear in the size of the image.
+     */
+    class BinaryImageChecker {
+    public:
+        BinaryImageChecker(const char* imageBegin, const char* imageEnd)
+        : begin(imageBegin), end(imageEnd), next(imageBegin + sizeof(BinaryBlueprintImage)) {}
+
+        bool string(const BinaryString& value) const {
+            const char* field = reinterpret_cast<const char*>(&value);
+
+            if (value.offset == 0 ||
+                value.offset > static_cast<size_t>(end - field) ||
+                value.length >= static_cast<size_t>(end - field) - value.offset)
+                return false;
+
+            return value.c_str()[value.length] == '\0';
+        }
+
+        template<typename T>
+        bool array(const BinaryArray<T>& value) {
+            if (value.size == 0)
+                return true;
+
+            const char* field = reinterpret_cast<const char*>(&value);
+            const char* first = field + value.offset;
+
+            if (value.offset == 0 ||
+                value.offset > static_cast<size_t>(end - field) ||
+                first < next ||
+                (first - begin) % BinaryAlignment != 0 ||
+                value.size > static_cast<size_t>(end - first) / sizeof(T))
+                return false;
+
+            next = first + value.size * sizeof(T);
+            return true;
+        }
+
+        bool keyValues(const BinaryArray<BinaryKeyValue>& value) {
+            if (!array(value))
+                return false;
+
+            for (size_t i = 0; i < value.size; ++i) {
+                if (!string(value[i].key) || !string(value[i].value))
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool parameters(const BinaryArray<BinaryParameter>& value) {
+            if (!array(value))
+                return false;
+
+            for (size_t i = 0; i < value.size; ++i) {
+
+                const BinaryParameter& parameter = value[i];
+
+                if (!string(parameter.name) ||
+                    !string(parameter.description) ||
+                    !string(parameter.type) ||
+                    parameter.use > RequiredParameterUse ||
+                    !string(parameter.defaultValue) ||
+                    !string(parameter.exampleValue) ||
+                    !array(parameter.values))
+                    return false;
+
+                for (size_t j = 0; j < parameter.values.size; ++j) {
+                    if (!string(parameter.values[j]))
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool payload(const BinaryPayload& value) {
+            return string(value.name) &&
+                   string(value.description) &&
+                   parameters(value.parameters) &&
+                   keyValues(value.headers) &&
+                   string(value.body) &&
+                   string(value.schema) &&
+                   string(value.reference.id);
+        }
+
+        bool payloads(const BinaryArray<BinaryPayload>& value) {
+            if (!array(value))
+                return false;
+
+            for (size_t i = 0; i < value.size; ++i) {
+                if (!payload(value[i]))
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool actions(const BinaryArray<BinaryAction>& value) {
+            if (!array(value))
+                return false;
+
+            for (size_t i = 0; i < value.size; ++i) {
+
+                const BinaryAction& action = value[i];
+
+                if (!string(action.method) ||
+                    !string(action.name) ||
+                    !string(action.description) ||
+                    !parameters(action.parameters) ||
+                    !keyValues(action.headers) ||
+                    !array(action.examples))
+                    return false;
+
+                for (size_t j = 0; j < action.examples.size; ++j) {
+
+                    const BinaryTransactionExample& example = action.examples[j];
+
+                    if (!string(example.name) ||
+                        !string(example.description) ||
+                        !payloads(example.requests) ||
+                        !payloads(example.responses))
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool blueprint(const BinaryBlueprint& value) {
+            if (!keyValues(value.metadata) ||
+                !string(value.name) ||
+                !string(value.description) ||
+                !array(value.resourceGroups))
+                return false;
+
+            for (size_t i = 0; i < value.resourceGroups.size; ++i) {
+
+                const BinaryResourceGroup& group = value.resourceGroups[i];
+
+                if (!string(group.name) ||
+                    !string(group.description) ||
+                    !array(group.resources))
+                    return false;
+
+                for (size_t j = 0; j < group.resources.size; ++j) {
+
+                    const BinaryResource& resource = group.resources[j];
+
+                    if (!string(resource.uriTemplate) ||
+                        !string(resource.name) ||
+                        !string(resource.description) ||
+                        !payload(resource.model) ||
+                        !parameters(resource.parameters) ||
+                        !keyValues(resource.headers) ||
+                        !actions(resource.actions))
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool sourceMap(const BinarySourceMap& value) {
+            if (!array(value.nodeKinds) ||
+                !array(value.nodeParents) ||
+                !array(value.nodeEntries) ||
+                !array(value.entryNodes) ||
+                !array(value.entryFields) ||
+                !array(value.entryRanges) ||
+                !array(value.rangeLocations) ||
+                !array(value.rangeLengths))
+                return false;
+
+            size_t nodes = value.nodeKinds.size;
+            size_t entries = value.entryNodes.size;
+            size_t ranges = value.rangeLocations.size;
+
+            if (value.nodeParents.size != nodes ||
+                value.nodeEntries.size != nodes ||
+                value.entryFields.size != entries ||
+                value.entryRanges.size != entries ||
+                value.rangeLengths.size != ranges)
+                return false;
+
+            for (size_t i = 0; i < nodes; ++i) {
+                if (value.nodeParents[i] >= nodes ||
+                    value.nodeEntries[i] > entries ||
+                    (i > 0 && value.nodeEntries[i] < value.nodeEntries[i - 1]))
+                    return false;
+            }
+
+            for (size_t i = 0; i < entries; ++i) {
+                if (value.entryNodes[i] >= nodes || value.entryRanges[i] >= ranges)
+                    return false;
+            }
+
+            return true;
+        }
+
+    private:
+        const char* begin;
+        const char* end;
+
+        /** End of the last array checked */
+        const char* next;
+    };
+}
+
+const BinaryBlueprintImage* snowcrash::OpenBinaryBlueprint(const void* data, size_t size)
+{
+    const char* begin = static_cast<const char*>(data);
+
+    if (!data ||
+        reinterpret_cast<size_t>(data) % BinaryAlignment != 0 ||
+        size < sizeof(BinaryBlueprintImage))
+        return NULL;
+
+    const BinaryBlueprintImage* image = reinterpret_cast<const BinaryBlueprintImage*>(data);
+
+    if (image->magic != BinaryBlueprintMagic ||
+        image->version != BinaryBlueprintVersion ||
+        image->size < sizeof(BinaryBlueprintImage) ||
+        image->size > size)
+        return NULL;
+
+    BinaryImageChecker checker(begin, begin + image->size);
+
+    if (!checker.blueprint(image->blueprint))
+        return NULL;
+
+    bool hasSourceMap = (image->flags & SourceMapBinaryBlueprintFlag) != 0;
+
+    if (image->sourceMap.size != (hasSourceMap ? 1 : 0) ||
+        !checker.array(image->sourceMap) ||
+        (hasSourceMap && !checker.sourceMap(image->sourceMap[0])))
+        return NULL;
+
+    return image;
+}
+
+static std::string ReadString(const BinaryString& value)
+{
+    return std::string(value.c_str(), value.length);
+}
+
+static void ReadKeyValues(const BinaryArray<BinaryKeyValue>& records, Collection<KeyValuePair>::type& keyValues)
+{
+    keyValues.resize(records.size);
+
+    for (size_t i = 0; i < records.size; ++i) {
+        keyValues[i].first = ReadString(records[i].key);
+        keyValues[i].second = ReadString(records[i].value);
+    }
+}
+
+static void ReadParameters(const BinaryArray<BinaryParameter>& records, Parameters& parameters)
+{
+    parameters.resize(records.size);
+
+    for (size_t i = 0; i < records.size; ++i) {
+
+        const BinaryParameter& record = records[i];
+        Parameter& parameter = parameters[i];
+
+        parameter.name = ReadString(record.name);
+        parameter.description = ReadString(record.description);
+        parameter.type = ReadString(record.type);
+        parameter.use = static_cast<ParameterUse>(record.use);
+        parameter.defaultValue = ReadString(record.defaultValue);
+        parameter.exampleValue = ReadString(record.exampleValue);
+
+        parameter.values.resize(record.values.size);
+
+        for (size_t j = 0; j < record.values.size; ++j) {
+            parameter.values[j] = ReadString(record.values[j]);
+        }
+    }
+}
+
+static void ReadPayload(const BinaryPayload& record, Payload& payload)
+{
+    payload.name = ReadString(record.name);
+    payload.description = ReadString(record.description);
+    ReadParameters(record.parameters, payload.parameters);
+    ReadKeyValues(record.headers, payload.headers);
+    payload.body = ReadString(record.body);
+    payload.schema = ReadString(record.schema);
+    payload.reference.id = ReadString(record.reference.id);
+    payload.reference.type = static_cast<Reference::ReferenceType>(record.reference.type);
+}
+
+static void ReadPayloads(const BinaryArray<BinaryPayload>& records, Collection<Payload>::type& payloads)
+{
+    payloads.resize(records.size);
+
+    for (size_t i = 0; i < records.size; ++i) {
+        ReadPayload(records[i], payloads[i]);
+    }
+}
+
+static void ReadActions(const BinaryArray<BinaryAction>& records, Actions& actions)
+{
+    actions.resize(records.size);
+
+    for (size_t i = 0; i < records.size; ++i) {
+
+        const BinaryAction& record = records[i];
+        Action& action = actions[i];
+
+        action.method = ReadString(record.method);
+        action.name = ReadString(record.name);
+        action.description = ReadString(record.description);
+        ReadParameters(record.parameters, action.parameters);
+        ReadKeyValues(record.headers, action.headers);
+
+        action.examples.resize(record.examples.size);
+
+        for (size_t j = 0; j < record.examples.size; ++j) {
+            action.examples[j].name = ReadString(record.examples[j].name);
+            action.examples[j].description = ReadString(record.examples[j].description);
+            ReadPayloads(record.examples[j].requests, action.examples[j].requests);
+            ReadPayloads(record.examples[j].responses, action.examples[j].responses);
+        }
+    }
+}
+
+void snowcrash::ReadBinaryBlueprint(const BinaryBlueprintImage& image, Blueprint& blueprint)
+{
+    const BinaryBlueprint& record = image.blueprint;
+
+    ReadKeyValues(record.metadata, blueprint.metadata);
+    blueprint.name = ReadString(record.name);
+    blueprint.description = ReadString(record.description);
+
+    blueprint.resourceGroups.resize(record.resourceGroups.size);
+
+    for (size_t i = 0; i < record.resourceGroups.size; ++i) {
+
+        const BinaryResourceGroup& groupRecord = record.resourceGroups[i];
+        ResourceGroup& group = blueprint.resourceGroups[i];
+
+        group.name = ReadString(groupRecord.name);
+        group.description = ReadString(groupRecord.description);
+
+        group.resources.resize(groupRecord.resources.size);
+
+        for (size_t j = 0; j < groupRecord.resources.size; ++j) {
+
+            const BinaryResource& resourceRecord = groupRecord.resources[j];
+            Resource& resource = group.resources[j];
+
+            resource.uriTemplate = ReadString(resourceRecord.uriTemplate);
+            resource.name = ReadString(resourceRecord.name);
+            resource.description = ReadString(resourceRecord.description);
+            ReadPayload(resourceRecord.model, resource.model);
+            ReadParameters(resourceRecord.parameters, resource.parameters);
+            ReadKeyValues(resourceRecord.headers, resource.headers);
+            ReadActions(resourceRecord.actions, resource.actions);
+        }
+    }
+}
+
+/** Read a table of the compact source map */
+template<typename T, typename U>
+static void ReadTable(const BinaryArray<T>& records, std::vector<U>& table)
+{
+    table.assign(records.begin(), records.begin() + records.size);
+}
+
+bool snowcrash::ReadBinarySourceMap(const BinaryBlueprintImage& image, CompactSourceMap& sourceMap)
+{
+    sourceMap.clear();
+
+    if (image.sourceMap.empty())
+        return false;
+
+    const BinarySourceMap& record = image.sourceMap[0];
+
+    ReadTable(record.nodeKinds, sourceMap.nodeKinds);
+    ReadTable(record.nodeParents, sourceMap.nodeParents);
+    ReadTable(record.nodeEntries, sourceMap.nodeEntries);
+    ReadTable(record.entryNodes, sourceMap.entryNodes);
+    ReadTable(record.entryFields, sourceMap.entryFields);
+    ReadTable(record.entryRanges, sourceMap.entryRanges);
+    ReadTable(record.rangeLocations, sourceMap.rangeLocations);
+    ReadTable(record.rangeLengths, sourceMap.rangeLengths);
+
+    return true;
+}
@@ -0,0 +1,269 @@
+//
+//  BinaryBlueprint.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_BINARYBLUEPRINT_H
+#define SNOWCRASH_BINARYBLUEPRINT_H
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+#include "BlueprintSourcemap.h"
+#include "CompactSourceMap.h"
+
+/**
+ *  Binary API Blueprint AST
+ *  ------------------------
+ *
+ *  Versioned binary image of the API Blueprint AST which is read in place,
+ *  e.g. straight from a memory mapped file, without any deserialization.
+ *
+ *  The image starts with a `BinaryBlueprintImage` header followed by tables
+ *  of fixed size records and a pool of NUL-terminated strings. Records refer
+ *  to strings and to arrays of child records by 32-bit offsets relative to
+ *  the referring field itself, so the image can be mapped at any address.
+ *  Every record and table is aligned to 4 bytes, the image is written in
+ *  the host byte order.
+ *
+ *  An image can carry the source map of the AST as the tables of
+ *  `CompactSourceMap`.
+ */
+
+namespace snowcrash {
+
+    /** Binary image magic, "SCBA" in the little-endian byte order */
+    const unsigned int BinaryBlueprintMagic = 0x41424353;
+
+    /** Binary image format version */
+    const unsigned int BinaryBlueprintVersion = 1;
+
+    /** Binary image flags */
+    enum BinaryBlueprintFlag {
+        SourceMapBinaryBlueprintFlag = (1 << 0)     /// < Image contains source map
+    };
+
+    /** Reference to a NUL-terminated string relative to the reference */
+    struct BinaryString {
+
+        /** Offset of the string from this reference */
+        unsigned int offset;
+
+        /** Length of the string without the terminating NUL */
+        unsigned int length;
+
+        /** \return The string */
+        const char* c_str() const {
+            return reinterpret_cast<const char*>(this) + offset;
+        }
+    };
+
+    /** Reference to an array of records relative to the reference */
+    template<typename T>
+    struct BinaryArray {
+
+        /** Offset of the first record from this reference, 0 if empty */
+        unsigned int offset;
+
+        /** Number of records */
+        unsigned int size;
+
+        /** \return True if there are no records */
+        bool empty() const { return size == 0; }
+
+        /** \return The first record */
+        const T* begin() const {
+            return reinterpret_cast<const T*>(reinterpret_cast<const char*>(this) + offset);
+        }
+
+        /** \return Record at given index */
+        const T& operator[](size_t index) const {
+            return begin()[index];
+        }
+    };
+
+    /** Key-value pair record, Metadata or Header */
+    struct BinaryKeyValue {
+        BinaryString key;
+        BinaryString value;
+    };
+
+    /** Parameter record */
+    struct BinaryParameter {
+        BinaryString name;
+        BinaryString description;
+        BinaryString type;
+        unsigned int use;                       /// < ParameterUse
+        BinaryString defaultValue;
+        BinaryString exampleValue;
+        BinaryArray<BinaryString> values;
+    };
+
+    /** Reference record */
+    struct BinaryReference {
+        BinaryString id;
+        unsigned int type;                      /// < Reference::ReferenceType
+    };
+
+    /** Payload record */
+    struct BinaryPayload {
+        BinaryString name;
+        BinaryString description;
+        BinaryArray<BinaryParameter> parameters;
+        BinaryArray<BinaryKeyValue> headers;
+        BinaryString body;
+        BinaryString schema;
+        BinaryReference reference;
+    };
+
+    /** Transaction Example record */
+    struct BinaryTransactionExample {
+        BinaryString name;
+        BinaryString description;
+        BinaryArray<BinaryPayload> requests;
+        BinaryArray<BinaryPayload> responses;
+    };
+
+    /** Action record */
+    struct BinaryAction {
+        BinaryString method;
+        BinaryString name;
+        BinaryString description;
+        BinaryArray<BinaryParameter> parameters;
+        BinaryArray<BinaryKeyValue> headers;
+        BinaryArray<BinaryTransactionExample> examples;
+    };
+
+    /** Resource record */
+    struct BinaryResource {
+        BinaryString uriTemplate;
+        BinaryString name;
+        BinaryString description;
+        BinaryPayload model;
+        BinaryArray<BinaryParameter> parameters;
+        BinaryArray<BinaryKeyValue> headers;
+        BinaryArray<BinaryAction> actions;
+    };
+
+    /** Resource Group record */
+    struct BinaryResourceGroup {
+        BinaryString name;
+        BinaryString description;
+        BinaryArray<BinaryResource> resources;
+    };
+
+    /** Blueprint record */
+    struct BinaryBlueprint {
+        BinaryArray<BinaryKeyValue> metadata;
+        BinaryString name;
+        BinaryString description;
+        BinaryArray<BinaryResourceGroup> resourceGroups;
+    };
+
+    /**
+     *  \brief Source map record, tables of `CompactSourceMap`
+     *
+     *  Range locations and lengths are stored as 32-bit numbers.
+     */
+    struct BinarySourceMap {
+        BinaryArray<unsigned char> nodeKinds;
+        BinaryArray<unsigned int> nodeParents;
+        BinaryArray<unsigned int> nodeEntries;
+        BinaryArray<unsigned int> entryNodes;
+        BinaryArray<unsigned char> entryFields;
+        BinaryArray<unsigned int> entryRanges;
+        BinaryArray<unsigned int> rangeLocations;
+        BinaryArray<unsigned int> rangeLengths;
+    };
+
+    /** Binary image header */
+    struct BinaryBlueprintImage {
+
+        /** BinaryBlueprintMagic */
+        unsigned int magic;
+
+        /** BinaryBlueprintVersion */
+        unsigned int version;
+
+        /** Size of the whole image in bytes */
+        unsigned int size;
+
+        /** BinaryBlueprintFlag bits */
+        unsigned int flags;
+
+        /** The AST */
+        BinaryBlueprint blueprint;
+
+        /** Source map, one record if SourceMapBinaryBlueprintFlag is set */
+        BinaryArray<BinarySourceMap> sourceMap;
+    };
+
+    /**
+     *  \brief  Serialize API Blueprint AST into a binary image
+     *  \param  blueprint   A blueprint AST to serialize
+     *  \param  os          An output stream to serialize into
+     *
+     *  Nothing is written and the failbit of the stream is set if the image
+     *  does not fit the 32-bit offsets, see BuildBinaryBlueprint().
+     */
+    void SerializeBinaryBlueprint(const Blueprint& blueprint, std::ostream& os);
+
+    /**
+     *  \brief  Serialize API Blueprint AST and its source map into a binary image
+     *  \param  blueprint   A blueprint AST to serialize
+     *  \param  sourceMap   A source map of the blueprint
+     *  \param  os          An output stream to serialize into
+     *
+     *  Nothing is written and the failbit of the stream is set if the image
+     *  does not fit the 32-bit offsets, see BuildBinaryBlueprint().
+     */
+    void SerializeBinaryBlueprint(const Blueprint& blueprint,
+                                  const SourceMap<Blueprint>& sourceMap,
+                                  std::ostream& os);
+
+    /**
+     *  \brief  Build binary image of API Blueprint AST in memory
+     *  \param  blueprint   A blueprint AST to serialize
+     *  \param  sourceMap   A source map of the blueprint, NULL for an image without it
+     *  \param  image       Output image data, replaced
+     *  \return False if the image would be 4 GiB or larger or a source map range
+     *          does not fit 32 bits, the image is empty then
+     */
+    bool BuildBinaryBlueprint(const Blueprint& blueprint,
+                              const SourceMap<Blueprint>* sourceMap,
+                              std::vector<char>& image);
+
+    /**
+     *  \brief  Open a binary image in place
+     *  \param  data    Image data, aligned to 4 bytes
+     *  \param  size    Size of the data in bytes
+     *  \return Header of the image, NULL if the data is not a valid image
+     *
+     *  The version, bounds of all the strings and arrays and alignment of
+     *  the records are verified, the returned image is safe to traverse
+     *  as long as the data is valid. Arrays have to follow each other in the
+     *  order they are written by BuildBinaryBlueprint(), an image with
+     *  overlapping arrays is not valid.
+     */
+    const BinaryBlueprintImage* OpenBinaryBlueprint(const void* data, size_t size);
+
+    /**
+     *  \brief  Deserialize API Blueprint AST from an opened binary image
+     *  \param  image       An image as returned by OpenBinaryBlueprint()
+     *  \param  blueprint   Output blueprint AST
+     */
+    void ReadBinaryBlueprint(const BinaryBlueprintImage& image, Blueprint& blueprint);
+
+    /**
+     *  \brief  Read source map of an opened binary image
+     *  \param  image       An image as returned by OpenBinaryBlueprint()
+     *  \param  sourceMap   Output compact source map, cleared first
+     *  \return False if the image has no source map
+     */
+    bool ReadBinarySourceMap(const BinaryBlueprintImage& image, CompactSourceMap& sourceMap);
+}
+
+#endif
@@ -25,8 +25,8 @@ namespace snowcrash {
     /**
      * Blueprint processor
      */
-    template<>
-    struct SectionProcessor<Blueprint> : public SectionProcessorBase<Blueprint> {
+    template<typename Policy>
+    struct SectionProcessor<Blueprint, Policy> : public SectionProcessorBase<Blueprint, Policy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -39,17 +39,17 @@ namespace snowcrash {
             while (cur != siblings.end() &&
                    cur->type == mdp::ParagraphMarkdownNodeType) {
 
-                IntermediateParseResult<MetadataCollection> metadata(out.report);
+                IntermediateParseResult<MetadataCollection, Policy> metadata(out.report);
 
                 parseMetadata(cur, pd, metadata);
 
                 // First block is paragraph and is not metadata (no API name)
                 if (metadata.node.empty()) {
-                    return processDescription(cur, siblings, pd, out);
+                    return SectionProcessorBase<Blueprint, Policy>::processDescription(cur, siblings, pd, out);
                 } else {
                     out.node.metadata.insert(out.node.metadata.end(), metadata.node.begin(), metadata.node.end());
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         out.sourceMap.metadata.collection.insert(out.sourceMap.metadata.collection.end(),
                                                                  metadata.sourceMap.collection.begin(),
                                                                  metadata.sourceMap.collection.end());
@@ -77,13 +77,13 @@ namespace snowcrash {
                 out.node.name = cur->text;
                 TrimString(out.node.name);
 
-                if (pd.exportSourceMap() && !out.node.name.empty()) {
+                if (Policy::exportSourceMap(pd) && !out.node.name.empty()) {
                     out.sourceMap.name.sourceMap = cur->sourceMap;
                 }
             } else {
 
                 // Any other type of block, add to description
-                return processDescription(cur, siblings, pd, out);
+                return SectionProcessorBase<Blueprint, Policy>::processDescription(cur, siblings, pd, out);
             }
 
             return ++MarkdownNodeIterator(cur);
@@ -97,41 +97,51 @@ namespace snowcrash {
             if (pd.sectionContext() == ResourceGroupSectionType ||
                 pd.sectionContext() == ResourceSectionType) {
 
-                IntermediateParseResult<ResourceGroup> resourceGroup(out.report);
+                IntermediateParseResult<ResourceGroup, Policy> resourceGroup(out.report);
 
-                MarkdownNodeIterator cur = ResourceGroupParser::parse(node, siblings, pd, resourceGroup);
+                MarkdownNodeIterator cur = SectionParser<ResourceGroup, HeaderSectionAdapter, Policy>::parse(node, siblings, pd, resourceGroup);
 
-                ResourceGroupIterator duplicate = findResourceGroup(out.node.resourceGroups, resourceGroup.node);
+                addResourceGroup(node, pd, resourceGroup, out);
 
-                if (duplicate != out.node.resourceGroups.end()) {
+                return cur;
+            }
 
-                    // WARN: duplicate resource group
-                    std::stringstream ss;
+            return node;
+        }
 
-                    if (resourceGroup.node.name.empty()) {
-                        ss << "anonymous group";
-                    } else {
-                        ss << "group '" << resourceGroup.node.name << "'";
-                    }
+        /** Add parsed resource group starting at given node to the blueprint */
+        static void addResourceGroup(const MarkdownNodeIterator& node,
+                                     SectionParserData& pd,
+                                     const ParseResultRef<ResourceGroup>& resourceGroup,
+                                     const ParseResultRef<Blueprint>& out) {
 
-                    ss << " is already defined";
+            ResourceGroupIterator duplicate = findResourceGroup(out.node.resourceGroups, resourceGroup.node);
 
-                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-                    out.report.warnings.push_back(Warning(ss.str(),
-                                                          DuplicateWarning,
-                                                          sourceMap));
-                }
+            if (duplicate != out.node.resourceGroups.end() &&
+                pd.reportsWarning(out.report, DuplicateWarning)) {
 
-                out.node.resourceGroups.push_back(resourceGroup.node);
+                // WARN: duplicate resource group
+                std::stringstream ss;
 
-                if (pd.exportSourceMap()) {
-                    out.sourceMap.resourceGroups.collection.push_back(resourceGroup.sourceMap);
+                if (resourceGroup.node.name.empty()) {
+                    ss << "anonymous group";
+                } else {
+                    ss << "group '" << resourceGroup.node.name << "'";
                 }
 
-                return cur;
+                ss << " is already defined";
+
+                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                out.report.warnings.push_back(Warning(ss.str(),
+                                                      DuplicateWarning,
+                                                      sourceMap));
             }
 
-            return node;
+            out.node.resourceGroups.push_back(resourceGroup.node);
+
+            if (Policy::exportSourceMap(pd)) {
+                out.sourceMap.resourceGroups.collection.push_back(resourceGroup.sourceMap);
+            }
         }
 
         static SectionType sectionType(const MarkdownNodeIterator& node) {
@@ -144,14 +154,14 @@ namespace snowcrash {
             SectionType nestedType = UndefinedSectionType;
 
             // Check if Resource section
-            nestedType = SectionProcessor<Resource>::sectionType(node);
+            nestedType = SectionProcessor<Resource, Policy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if ResourceGroup section
-            nestedType = SectionProcessor<ResourceGroup>::sectionType(node);
+            nestedType = SectionProcessor<ResourceGroup, Policy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -165,7 +175,7 @@ namespace snowcrash {
 
             // Resource Group & descendants
             nested.push_back(ResourceGroupSectionType);
-            SectionTypes types = SectionProcessor<ResourceGroup>::nestedSectionTypes();
+            SectionTypes types = SectionProcessor<ResourceGroup, Policy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -189,7 +199,9 @@ namespace snowcrash {
                                          sourceMap);
 
             }
-            else if (!out.node.description.empty()) {
+            else if (!out.node.description.empty() &&
+                     pd.reportsWarning(out.report, APINameWarning)) {
+
                 mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
                 out.report.warnings.push_back(Warning(ExpectedAPINameMessage,
                                                       APINameWarning,
@@ -223,7 +235,7 @@ namespace snowcrash {
                 if (CodeBlockUtility::keyValueFromLine(*it, metadata)) {
                     out.node.push_back(metadata);
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         SourceMap<Metadata> metadataSM;
                         metadataSM.sourceMap = node->sourceMap;
                         out.sourceMap.collection.push_back(metadataSM);
@@ -253,6 +265,9 @@ namespace snowcrash {
 
                         duplicateKeys.push_back(it->first);
 
+                        if (!pd.reportsWarning(out.report, DuplicateWarning))
+                            continue;
+
                         // WARN: duplicate metadata definition
                         std::stringstream ss;
                         ss << "duplicate definition of '" << it->first << "'";
@@ -264,7 +279,8 @@ namespace snowcrash {
                     }
                 }
             }
-            else if (!out.node.empty()) {
+            else if (!out.node.empty() &&
+                     pd.reportsWarning(out.report, FormattingWarning)) {
 
                 // WARN: malformed metadata block
                 mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
@@ -293,7 +309,7 @@ namespace snowcrash {
 
             Collection<SourceMap<ResourceGroup> >::iterator resourceGroupSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 resourceGroupSourceMapIt = out.sourceMap.resourceGroups.collection.begin();
             }
 
@@ -303,7 +319,7 @@ namespace snowcrash {
 
                 checkResourceLazyReferencing(*resourceGroupIt, resourceGroupSourceMapIt, pd, out);
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     resourceGroupSourceMapIt++;
                 }
             }
@@ -317,7 +333,7 @@ namespace snowcrash {
 
             Collection<SourceMap<Resource> >::iterator resourceSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 resourceSourceMapIt = resourceGroupSourceMapIt->resources.collection.begin();
             }
 
@@ -327,7 +343,7 @@ namespace snowcrash {
 
                 checkActionLazyReferencing(*resourceIt, resourceSourceMapIt, pd, out);
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     resourceSourceMapIt++;
                 }
             }
@@ -341,7 +357,7 @@ namespace snowcrash {
 
             Collection<SourceMap<Action> >::iterator actionSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 actionSourceMapIt = resourceSourceMapIt->actions.collection.begin();
             }
 
@@ -351,7 +367,7 @@ namespace snowcrash {
 
                 checkExampleLazyReferencing(*actionIt, actionSourceMapIt, pd, out);
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     actionSourceMapIt++;
                 }
             }
@@ -365,7 +381,7 @@ namespace snowcrash {
 
             Collection<SourceMap<TransactionExample> >::iterator exampleSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 exampleSourceMapIt = actionSourceMapIt->examples.collection.begin();
             }
 
@@ -376,7 +392,7 @@ namespace snowcrash {
                 checkRequestLazyReferencing(*transactionExampleIt, exampleSourceMapIt, pd, out);
                 checkResponseLazyReferencing(*transactionExampleIt, exampleSourceMapIt, pd, out);
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     exampleSourceMapIt++;
                 }
             }
@@ -390,7 +406,7 @@ namespace snowcrash {
 
             Collection<SourceMap<Request> >::iterator requestSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 requestSourceMapIt = transactionExampleSourceMapIt->requests.collection.begin();
             }
 
@@ -401,20 +417,19 @@ namespace snowcrash {
                 if (!requestIt->reference.id.empty() &&
                     requestIt->reference.meta.state == Reference::StatePending) {
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
 
                         ParseResultRef<Payload> payload(out.report, *requestIt, *requestSourceMapIt);
                         resolvePendingSymbols(pd, payload);
                     }
                     else {
 
-                        SourceMap<Payload> tempSourceMap;
-                        ParseResultRef<Payload> payload(out.report, *requestIt, tempSourceMap);
+                        ParseResultRef<Payload> payload(out.report, *requestIt, NullSourceMap<Payload>());
                         resolvePendingSymbols(pd, payload);
                     }
                 }
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     requestSourceMapIt++;
                 }
             }
@@ -428,7 +443,7 @@ namespace snowcrash {
 
             Collection<SourceMap<Response> >::iterator responseSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 responseSourceMapIt = transactionExampleSourceMapIt->responses.collection.begin();
             }
 
@@ -439,20 +454,19 @@ namespace snowcrash {
                 if (!responseIt->reference.id.empty() &&
                     responseIt->reference.meta.state == Reference::StatePending) {
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
 
                         ParseResultRef<Payload> payload(out.report, *responseIt, *responseSourceMapIt);
                         resolvePendingSymbols(pd, payload);
                     }
                     else {
 
-                        SourceMap<Payload> tempSourceMap;
-                        ParseResultRef<Payload> payload(out.report, *responseIt, tempSourceMap);
+                        ParseResultRef<Payload> payload(out.report, *responseIt, NullSourceMap<Payload>());
                         resolvePendingSymbols(pd, payload);
                     }
                 }
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     responseSourceMapIt++;
                 }
             }
@@ -480,7 +494,7 @@ namespace snowcrash {
             else {
 
                 out.node.reference.meta.state = Reference::StateResolved;
-                SectionProcessor<Payload>::assingReferredPayload(pd, out);
+                SectionProcessor<Payload, Policy>::assingReferredPayload(pd, out);
             }
         }
     };
@@ -0,0 +1,585 @@
+//
+//  BlueprintVisitor.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_BLUEPRINTVISITOR_H
+#define SNOWCRASH_BLUEPRINTVISITOR_H
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include "BlueprintSourcemap.h"
+#include "Parallel.h"
+#include "Serialize.h"
+
+/**
+ *  API Blueprint AST Visitor
+ *  -------------------------
+ *
+ *  Walks an AST and its source map in one pass and sends the token events
+ *  of their serialized documents to two visitors, one per document. The
+ *  events are dispatched at compile time, a visitor is any class with
+ *  these members:
+ *
+ *      void beginObject(size_t size);              // object of `size` members
+ *      void endObject();
+ *      void beginArray(size_t size);               // array of `size` items
+ *      void endArray();
+ *      void key(const std::string& key);           // key of the next member
+ *      void string(const std::string& value);
+ *      void literal(const std::string& value);     // string which may be written unquoted
+ *      void boolean(bool value);
+ *      void sourceMap(const SourceMapBase& value); // byte ranges of a source map
+ *
+ *  To visit resource groups on the worker pool (ParallelSerializeOption)
+ *  a visitor also needs:
+ *
+ *      // Visitor of the `index`-th item of the current array of `parent`
+ *      Visitor(std::ostream& os, const Visitor& parent, size_t index);
+ *
+ *      // Append output of such visitor as the item
+ *      void append(const std::string& output);
+ *
+ *  Every item of an array is visited in the state the parent visitor
+ *  had when the array began, the output of an item visitor is what the
+ *  parent visitor would have written for the item.
+ */
+
+namespace snowcrash {
+
+    /** Index past all resource groups */
+    const size_t AllResourceGroups = static_cast<size_t>(-1);
+
+    /** Visitor ignoring all the events, of a document which is not written */
+    struct NullVisitor {
+
+        NullVisitor() {}
+        NullVisitor(std::ostream&, const NullVisitor&, size_t) {}
+
+        void beginObject(size_t) {}
+        void endObject() {}
+        void beginArray(size_t) {}
+        void endArray() {}
+        void key(const std::string&) {}
+        void string(const std::string&) {}
+        void literal(const std::string&) {}
+        void boolean(bool) {}
+        void sourceMap(const SourceMapBase&) {}
+        void append(const std::string&) {}
+    };
+
+    /** Empty node standing in for a node missing in one of the trees */
+    template<typename T>
+    struct EmptyNode {
+        static T node;
+    };
+
+    template<typename T>
+    T EmptyNode<T>::node;
+
+    /**
+     *  \brief Synchronized walk of an AST and its source map.
+     *
+     *  Both documents are visited in one walk of the two trees. A node
+     *  only in one of the trees is visited only in its document.
+     */
+    template<typename ASTVisitor, typename SourceMapVisitor>
+    class BlueprintWalker {
+    public:
+
+        /** Documents a node is visited in */
+        struct Documents {
+            bool ast;
+            bool sourceMap;
+        };
+
+        BlueprintWalker(ASTVisitor& astVisitor, SourceMapVisitor& sourceMapVisitor, SerializeOptions options = 0)
+        : m_ast(astVisitor), m_sourceMap(sourceMapVisitor), m_options(options) {}
+
+        /** \return Documents with the not selected ones dropped */
+        static Documents select(const Documents& documents, bool ast, bool sourceMap) {
+            Documents selected = { documents.ast && ast, documents.sourceMap && sourceMap };
+            return selected;
+        }
+
+        /**
+         *  \brief Visit a blueprint with a range of its resource groups.
+         *  \param blueprint    The blueprint to visit
+         *  \param sourceMap    Source map of the blueprint
+         *  \param documents    Documents to visit the blueprint in
+         *  \param firstGroup   First resource group to visit
+         *  \param lastGroup    Index past the last resource group to visit
+         */
+        void visit(const Blueprint& blueprint,
+                   const SourceMap<Blueprint>& sourceMap,
+                   const Documents& documents,
+                   size_t firstGroup = 0,
+                   size_t lastGroup = AllResourceGroups) {
+
+            beginObject(5, 4, documents);
+
+            if (documents.ast) {
+                m_ast.key(SerializeKey::ASTVersion);
+                m_ast.literal(AST_SERIALIZATION_VERSION);
+            }
+
+            key(SerializeKey::Metadata, documents);
+            visitCollection<KeyValuePair>(blueprint.metadata, sourceMap.metadata.collection, documents, &BlueprintWalker::visitKeyValue);
+
+            visit(SerializeKey::Name, blueprint.name, sourceMap.name, documents);
+            visit(SerializeKey::Description, blueprint.description, sourceMap.description, documents);
+
+            key(SerializeKey::ResourceGroups, documents);
+            visitResourceGroups(blueprint.resourceGroups, sourceMap.resourceGroups.collection, documents, firstGroup, lastGroup);
+
+            endObject(documents);
+        }
+
+        /** Visit a group of resources */
+        void visit(const ResourceGroup& resourceGroup, const SourceMap<ResourceGroup>& sourceMap, const Documents& documents) {
+
+            beginObject(3, 3, documents);
+
+            visit(SerializeKey::Name, resourceGroup.name, sourceMap.name, documents);
+            visit(SerializeKey::Description, resourceGroup.description, sourceMap.description, documents);
+
+            key(SerializeKey::Resources, documents);
+            visitCollection<Resource>(resourceGroup.resources, sourceMap.resources.collection, documents, &BlueprintWalker::visit);
+
+            endObject(documents);
+        }
+
+        /** Visit a resource */
+        void visit(const Resource& resource, const SourceMap<Resource>& sourceMap, const Documents& documents) {
+
+            beginObject(6, 6, documents);
+
+            visit(SerializeKey::Name, resource.name, sourceMap.name, documents);
+            visit(SerializeKey::Description, resource.description, sourceMap.description, documents);
+            visit(SerializeKey::URITemplate, resource.uriTemplate, sourceMap.uriTemplate, documents);
+
+            // Model, an empty object in a document without the model
+            Documents model = select(documents, !resource.model.name.empty(), !sourceMap.model.name.sourceMap.empty());
+            Documents noModel = select(documents, !model.ast, !model.sourceMap);
+
+            key(SerializeKey::Model, documents);
+            beginObject(0, 0, noModel);
+            endObject(noModel);
+            visit(resource.model, sourceMap.model, model);
+
+            visit(resource.parameters, sourceMap.parameters, documents);
+
+            key(SerializeKey::Actions, documents);
+            visitCollection<Action>(resource.actions, sourceMap.actions.collection, documents, &BlueprintWalker::visit);
+
+            endObject(documents);
+        }
+
+        /** Visit an action */
+        void visit(const Action& action, const SourceMap<Action>& sourceMap, const Documents& documents) {
+
+            beginObject(5, 5, documents);
+
+            visit(SerializeKey::Name, action.name, sourceMap.name, documents);
+            visit(SerializeKey::Description, action.description, sourceMap.description, documents);
+            visit(SerializeKey::Method, action.method, sourceMap.method, documents);
+            visit(action.parameters, sourceMap.parameters, documents);
+
+            key(SerializeKey::Examples, documents);
+            visitCollection<TransactionExample>(action.examples, sourceMap.examples.collection, documents, &BlueprintWalker::visit);
+
+            endObject(documents);
+        }
+
+        /** Visit a transaction example */
+        void visit(const TransactionExample& example, const SourceMap<TransactionExample>& sourceMap, const Documents& documents) {
+
+            beginObject(4, 4, documents);
+
+            visit(SerializeKey::Name, example.name, sourceMap.name, documents);
+            visit(SerializeKey::Description, example.description, sourceMap.description, documents);
+
+            key(SerializeKey::Requests, documents);
+            visitCollection<Request>(example.requests, sourceMap.requests.collection, documents, &BlueprintWalker::visit);
+
+            key(SerializeKey::Responses, documents);
+            visitCollection<Response>(example.responses, sourceMap.responses.collection, documents, &BlueprintWalker::visit);
+
+            endObject(documents);
+        }
+
+        /** Visit a payload, the reference is only in documents it is in */
+        void visit(const Payload& payload, const SourceMap<Payload>& sourceMap, const Documents& documents) {
+
+            bool astReference = !payload.reference.id.empty();
+            bool sourceMapReference = !sourceMap.reference.sourceMap.empty();
+
+            beginObject(astReference ? 6 : 5, sourceMapReference ? 6 : 5, documents);
+
+            visit(SerializeKey::Name, payload.name, sourceMap.name, documents);
+
+            if (documents.ast && astReference) {
+                m_ast.key(SerializeKey::Reference);
+                m_ast.beginObject(1);
+                m_ast.key(SerializeKey::Id);
+                m_ast.string(payload.reference.id);
+                m_ast.endObject();
+            }
+
+            if (documents.sourceMap && sourceMapReference) {
+                m_sourceMap.key(SerializeKey::Reference);
+                m_sourceMap.sourceMap(sourceMap.reference);
+            }
+
+            visit(SerializeKey::Description, payload.description, sourceMap.description, documents);
+
+            key(SerializeKey::Headers, documents);
+            visitCollection<KeyValuePair>(payload.headers, sourceMap.headers.collection, documents, &BlueprintWalker::visitKeyValue);
+
+            visit(SerializeKey::Body, payload.body, sourceMap.body, documents);
+            visit(SerializeKey::Schema, payload.schema, sourceMap.schema, documents);
+
+            endObject(documents);
+        }
+
+        /** Visit parameters */
+        void visit(const Parameters& parameters, const SourceMap<Parameters>& sourceMap, const Documents& documents) {
+
+            key(SerializeKey::Parameters, documents);
+            visitCollection<Parameter>(parameters, sourceMap.collection, documents, &BlueprintWalker::visit);
+        }
+
+        /** Visit a parameter */
+        void visit(const Parameter& parameter, const SourceMap<Parameter>& sourceMap, const Documents& documents) {
+
+            beginObject(7, 7, documents);
+
+            visit(SerializeKey::Name, parameter.name, sourceMap.name, documents);
+            visit(SerializeKey::Description, parameter.description, sourceMap.description, documents);
+            visit(SerializeKey::Type, parameter.type, sourceMap.type, documents);
+
+            key(SerializeKey::Required, documents);
+
+            if (documents.ast)
+                m_ast.boolean(parameter.use != OptionalParameterUse);
+
+            if (documents.sourceMap)
+                m_sourceMap.sourceMap(sourceMap.use);
+
+            visit(SerializeKey::Default, parameter.defaultValue, sourceMap.defaultValue, documents);
+            visit(SerializeKey::Example, parameter.exampleValue, sourceMap.exampleValue, documents);
+
+            key(SerializeKey::Values, documents);
+            visitCollection<Value>(parameter.values, sourceMap.values.collection, documents, &BlueprintWalker::visitValue);
+
+            endObject(documents);
+        }
+
+        /** Visit a value of a parameter, an object in the AST */
+        void visitValue(const Value& value, const SourceMap<Value>& sourceMap, const Documents& documents) {
+
+            if (documents.ast) {
+                m_ast.beginObject(1);
+                m_ast.key(SerializeKey::Value);
+                m_ast.string(value);
+                m_ast.endObject();
+            }
+
+            if (documents.sourceMap)
+                m_sourceMap.sourceMap(sourceMap);
+        }
+
+        /** Visit a key value pair, Metadata or HTTP header, an object in the AST */
+        void visitKeyValue(const KeyValuePair& pair, const SourceMap<KeyValuePair>& sourceMap, const Documents& documents) {
+
+            if (documents.ast) {
+                m_ast.beginObject(2);
+                m_ast.key(SerializeKey::Name);
+                m_ast.string(pair.first);
+                m_ast.key(SerializeKey::Value);
+                m_ast.string(pair.second);
+                m_ast.endObject();
+            }
+
+            if (documents.sourceMap)
+                m_sourceMap.sourceMap(sourceMap);
+        }
+
+    private:
+        ASTVisitor& m_ast;
+        SourceMapVisitor& m_sourceMap;
+        SerializeOptions m_options;
+
+        /** Visit a member with a string value and its source map */
+        void visit(const std::string& key, const std::string& value, const SourceMapBase& sourceMap, const Documents& documents) {
+
+            this->key(key, documents);
+
+            if (documents.ast)
+                m_ast.string(value);
+
+            if (documents.sourceMap)
+                m_sourceMap.sourceMap(sourceMap);
+        }
+
+        void key(const std::string& key, const Documents& documents) {
+
+            if (documents.ast)
+                m_ast.key(key);
+
+            if (documents.sourceMap)
+                m_sourceMap.key(key);
+        }
+
+        void beginObject(size_t astSize, size_t sourceMapSize, const Documents& documents) {
+
+            if (documents.ast)
+                m_ast.beginObject(astSize);
+
+            if (documents.sourceMap)
+                m_sourceMap.beginObject(sourceMapSize);
+        }
+
+        void endObject(const Documents& documents) {
+
+            if (documents.ast)
+                m_ast.endObject();
+
+            if (documents.sourceMap)
+                m_sourceMap.endObject();
+        }
+
+        void beginArray(size_t astSize, size_t sourceMapSize, const Documents& documents) {
+
+            if (documents.ast)
+                m_ast.beginArray(astSize);
+
+            if (documents.sourceMap)
+                m_sourceMap.beginArray(sourceMapSize);
+        }
+
+        void endArray(const Documents& documents) {
+
+            if (documents.ast)
+                m_ast.endArray();
+
+            if (documents.sourceMap)
+                m_sourceMap.endArray();
+        }
+
+        /**
+         *  \brief Visit an array of nodes and their source maps.
+         *
+         *  Every document gets as many items as its own collection has.
+         */
+        template<typename T>
+        void visitCollection(const typename Collection<T>::type& nodes,
+                             const typename Collection<SourceMap<T> >::type& sourceMaps,
+                             const Documents& documents,
+                             void (BlueprintWalker::*visitItem)(const T&, const SourceMap<T>&, const Documents&)) {
+
+            size_t astSize = (documents.ast) ? nodes.size() : 0;
+            size_t sourceMapSize = (documents.sourceMap) ? sourceMaps.size() : 0;
+            size_t size = (astSize > sourceMapSize) ? astSize : sourceMapSize;
+
+            beginArray(astSize, sourceMapSize, documents);
+
+            for (size_t i = 0; i < size; ++i) {
+
+                Documents item = select(documents, i < astSize, i < sourceMapSize);
+
+                (this->*visitItem)((item.ast) ? nodes[i] : EmptyNode<T>::node,
+                                   (item.sourceMap) ? sourceMaps[i] : EmptyNode<SourceMap<T> >::node,
+                                   item);
+            }
+
+            endArray(documents);
+        }
+
+        /**
+         *  \brief Resource groups visited on the worker pool.
+         *
+         *  Every group is visited by item visitors writing into its own
+         *  buffers, both documents then get the buffers in order.
+         */
+        struct ResourceGroupsVisit {
+            const ResourceGroups* resourceGroups;
+            const Collection<SourceMap<ResourceGroup> >::type* sourceMaps;
+            const ASTVisitor* ast;
+            const SourceMapVisitor* sourceMap;
+            size_t first;
+            size_t astEnd;
+            size_t sourceMapEnd;
+            std::vector<std::string> astOutput;
+            std::vector<std::string> sourceMapOutput;
+        };
+
+        /** Visit one resource group of a ResourceGroupsVisit, a ParallelTask */
+        static void visitResourceGroup(size_t index, void* context) {
+
+            ResourceGroupsVisit& groups = *static_cast<ResourceGroupsVisit*>(context);
+            size_t i = groups.first + index;
+
+            Documents documents = { i < groups.astEnd, i < groups.sourceMapEnd };
+
+            std::stringstream astStream;
+            std::stringstream sourceMapStream;
+
+            {
+                ASTVisitor astVisitor(astStream, *groups.ast, index);
+                SourceMapVisitor sourceMapVisitor(sourceMapStream, *groups.sourceMap, index);
+                BlueprintWalker walker(astVisitor, sourceMapVisitor);
+
+                walker.visit((documents.ast) ? (*groups.resourceGroups)[i] : EmptyNode<ResourceGroup>::node,
+                             (documents.sourceMap) ? (*groups.sourceMaps)[i] : EmptyNode<SourceMap<ResourceGroup> >::node,
+                             documents);
+            }
+
+            groups.astOutput[index] = astStream.str();
+            groups.sourceMapOutput[index] = sourceMapStream.str();
+        }
+
+        /** \return Index past the items of a range visited in a document, `first` if there are none */
+        static size_t rangeEnd(bool visited, size_t first, size_t last, size_t size) {
+
+            if (!visited || size <= first)
+                return first;
+
+            return (size < last) ? size : last;
+        }
+
+        /**
+         *  \brief Visit a range of resource groups and their source maps.
+         *
+         *  With ParallelSerializeOption the groups are visited on the
+         *  worker pool, the output is the same as when visited one by one.
+         */
+        void visitResourceGroups(const ResourceGroups& resourceGroups,
+                                 const Collection<SourceMap<ResourceGroup> >::type& sourceMaps,
+                                 const Documents& documents,
+                                 size_t first,
+                                 size_t last) {
+
+            size_t astEnd = rangeEnd(documents.ast, first, last, resourceGroups.size());
+            size_t sourceMapEnd = rangeEnd(documents.sourceMap, first, last, sourceMaps.size());
+            size_t end = (astEnd > sourceMapEnd) ? astEnd : sourceMapEnd;
+
+            beginArray(astEnd - first, sourceMapEnd - first, documents);
+
+            if ((m_options & ParallelSerializeOption) == 0 || end - first < 2) {
+
+                for (size_t i = first; i < end; ++i) {
+
+                    Documents item = select(documents, i < astEnd, i < sourceMapEnd);
+
+                    visit((item.ast) ? resourceGroups[i] : EmptyNode<ResourceGroup>::node,
+                          (item.sourceMap) ? sourceMaps[i] : EmptyNode<SourceMap<ResourceGroup> >::node,
+                          item);
+                }
+
+                endArray(documents);
+                return;
+            }
+
+            ResourceGroupsVisit groups;
+            groups.resourceGroups = &resourceGroups;
+            groups.sourceMaps = &sourceMaps;
+            groups.ast = &m_ast;
+            groups.sourceMap = &m_sourceMap;
+            groups.first = first;
+            groups.astEnd = astEnd;
+            groups.sourceMapEnd = sourceMapEnd;
+            groups.astOutput.resize(end - first);
+            groups.sourceMapOutput.resize(end - first);
+
+            ParallelFor(visitResourceGroup, &groups, end - first);
+
+            for (size_t i = first; i < astEnd; ++i) {
+                m_ast.append(groups.astOutput[i - first]);
+            }
+
+            for (size_t i = first; i < sourceMapEnd; ++i) {
+                m_sourceMap.append(groups.sourceMapOutput[i - first]);
+            }
+
+            endArray(documents);
+        }
+    };
+
+    /**
+     *  \brief  Visit an AST and its source map in one walk
+     *  \param  blueprint           A blueprint AST to visit
+     *  \param  sourceMap           A source map of the blueprint
+     *  \param  astVisitor          Visitor of the AST document
+     *  \param  sourceMapVisitor    Visitor of the source map document
+     *  \param  options             Serialization options, ParallelSerializeOption is used
+     *  \param  firstGroup          First resource group to visit
+     *  \param  lastGroup           Index past the last resource group to visit
+     */
+    template<typename ASTVisitor, typename SourceMapVisitor>
+    void VisitBlueprint(const Blueprint& blueprint,
+                        const SourceMap<Blueprint>& sourceMap,
+                        ASTVisitor& astVisitor,
+                        SourceMapVisitor& sourceMapVisitor,
+                        SerializeOptions options = 0,
+                        size_t firstGroup = 0,
+                        size_t lastGroup = AllResourceGroups)
+    {
+        typedef BlueprintWalker<ASTVisitor, SourceMapVisitor> Walker;
+
+        typename Walker::Documents documents = { true, true };
+        Walker walker(astVisitor, sourceMapVisitor, options);
+
+        walker.visit(blueprint, sourceMap, documents, firstGroup, lastGroup);
+    }
+
+    /**
+     *  \brief  Visit an AST
+     *  \param  blueprint   A blueprint AST to visit
+     *  \param  visitor     Visitor of the AST document
+     *  \param  options     Serialization options, ParallelSerializeOption is used
+     *  \param  firstGroup  First resource group to visit
+     *  \param  lastGroup   Index past the last resource group to visit
+     */
+    template<typename ASTVisitor>
+    void VisitBlueprint(const Blueprint& blueprint,
+                        ASTVisitor& visitor,
+                        SerializeOptions options = 0,
+                        size_t firstGroup = 0,
+                        size_t lastGroup = AllResourceGroups)
+    {
+        typedef BlueprintWalker<ASTVisitor, NullVisitor> Walker;
+
+        typename Walker::Documents documents = { true, false };
+        NullVisitor sourceMapVisitor;
+        Walker walker(visitor, sourceMapVisitor, options);
+
+        walker.visit(blueprint, EmptyNode<SourceMap<Blueprint> >::node, documents, firstGroup, lastGroup);
+    }
+
+    /**
+     *  \brief  Visit a source map of an AST
+     *  \param  sourceMap   A source map to visit
+     *  \param  visitor     Visitor of the source map document
+     *  \param  options     Serialization options, ParallelSerializeOption is used
+     */
+    template<typename SourceMapVisitor>
+    void VisitSourceMap(const SourceMap<Blueprint>& sourceMap,
+                        SourceMapVisitor& visitor,
+                        SerializeOptions options = 0)
+    {
+        typedef BlueprintWalker<NullVisitor, SourceMapVisitor> Walker;
+
+        typename Walker::Documents documents = { false, true };
+        NullVisitor astVisitor;
+        Walker walker(astVisitor, visitor, options);
+
+        walker.visit(EmptyNode<Blueprint>::node, sourceMap, documents);
+    }
+}
+
+#endif
@@ -0,0 +1,76 @@
+//
+//  BufferedWriter.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstring>
+#include "BufferedWriter.h"
+
+using namespace snowcrash;
+
+const size_t BufferedWriter::BufferSize;
+
+/** Indentation block, two spaces per level */
+static const char IndentSpaces[] = "                                                                ";
+static const size_t IndentSpacesLength = sizeof(IndentSpaces) - 1;
+
+BufferedWriter::BufferedWriter(std::ostream& stream)
+: os(stream), buffer(BufferSize), length(0)
+{
+}
+
+BufferedWriter::~BufferedWriter()
+{
+    flush();
+}
+
+void BufferedWriter::flush()
+{
+    if (length) {
+        os.write(&buffer[0], length);
+        length = 0;
+    }
+}
+
+void BufferedWriter::write(const char* data, size_t size)
+{
+    if (size > BufferSize - length) {
+        flush();
+
+        if (size >= BufferSize) {
+            os.write(data, size);
+            return;
+        }
+    }
+
+    ::memcpy(&buffer[length], data, size);
+    length += size;
+}
+
+void BufferedWriter::writeNumber(size_t value)
+{
+    char digits[24];
+    char* p = digits + sizeof(digits);
+
+    do {
+        *--p = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
+
+    write(p, digits + sizeof(digits) - p);
+}
+
+void BufferedWriter::writeIndent(size_t level)
+{
+    size_t size = level * 2;
+
+    while (size > IndentSpacesLength) {
+        write(IndentSpaces, IndentSpacesLength);
+        size -= IndentSpacesLength;
+    }
+
+    write(IndentSpaces, size);
+}
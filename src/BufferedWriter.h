@@ -0,0 +1,73 @@
+//
+//  BufferedWriter.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_BUFFEREDWRITER_H
+#define SNOWCRASH_BUFFEREDWRITER_H
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace snowcrash {
+
+    /**
+     *  \brief Buffered output writer.
+     *
+     *  Accumulates the output in an internal buffer and writes it into
+     *  the underlying stream only when the buffer is full, on flush()
+     *  or when the writer is destroyed. Base of the serialization writers.
+     */
+    class BufferedWriter {
+    public:
+
+        /** Size of the internal buffer */
+        static const size_t BufferSize = 64 * 1024;
+
+        /** Write the buffered output into the stream */
+        void flush();
+
+        /** Write already serialized output as is */
+        void append(const std::string& output) {
+            write(output.data(), output.size());
+        }
+
+    protected:
+        explicit BufferedWriter(std::ostream& os);
+
+        /** Flushes the remaining buffered output */
+        ~BufferedWriter();
+
+        /** Write one character */
+        void put(char c) {
+            if (length == BufferSize)
+                flush();
+
+            buffer[length++] = c;
+        }
+
+        /** Write characters */
+        void write(const char* data, size_t size);
+
+        /** Write an unsigned number */
+        void writeNumber(size_t value);
+
+        /** Write two spaces per indentation level */
+        void writeIndent(size_t level);
+
+    private:
+        std::ostream& os;
+        std::vector<char> buffer;
+        size_t length;
+
+        BufferedWriter(const BufferedWriter&);
+        BufferedWriter& operator=(const BufferedWriter&);
+    };
+}
+
+#endif
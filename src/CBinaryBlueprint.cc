@@ -0,0 +1,694 @@
+//
+//  CBinaryBlueprint.cc
+//  snowcrash
+//  C Implementation of BinaryBlueprint.h for binding purposes
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstdlib>
+#include <cstring>
+#include "CBinaryBlueprint.h"
+#include "BinaryBlueprint.h"
+#include "MappedFile.h"
+
+using namespace snowcrash;
+
+/** Memory mapped binary image file */
+struct BinaryFile {
+    MappedFile file;
+    const BinaryBlueprintImage* image;
+};
+
+SC_API const sc_bin_blueprint_t* sc_bin_blueprint_open(const void* data, size_t size)
+{
+    const BinaryBlueprintImage* image = OpenBinaryBlueprint(data, size);
+    if (!image)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_blueprint_t, &image->blueprint);
+}
+
+SC_API sc_bin_file_t* sc_bin_file_open(const char* path)
+{
+    if (!path)
+        return NULL;
+
+    BinaryFile* p = ::new BinaryFile;
+
+    if (!p->file.open(path)) {
+        ::delete p;
+        return NULL;
+    }
+
+    p->image = OpenBinaryBlueprint(p->file.data(), p->file.size());
+    return AS_TYPE(sc_bin_file_t, p);
+}
+
+SC_API void sc_bin_file_close(sc_bin_file_t* file)
+{
+    ::delete AS_TYPE(BinaryFile, file);
+}
+
+SC_API const sc_bin_blueprint_t* sc_bin_file_blueprint(const sc_bin_file_t* file)
+{
+    const BinaryFile* p = AS_CTYPE(BinaryFile, file);
+    if (!p || !p->image)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_blueprint_t, &p->image->blueprint);
+}
+
+SC_API void* sc_bin_image_export(const sc_blueprint_t* blueprint, const sc_sm_blueprint_t* sm_blueprint, size_t* size)
+{
+    const Blueprint* p = AS_CTYPE(Blueprint, blueprint);
+    if (!p)
+        return NULL;
+
+    std::vector<char> data;
+    if (!BuildBinaryBlueprint(*p, AS_CTYPE(SourceMap<Blueprint>, sm_blueprint), data))
+        return NULL;
+
+    // malloc() memory is aligned for any record
+    void* image = ::malloc(data.size());
+    if (!image)
+        return NULL;
+
+    ::memcpy(image, &data[0], data.size());
+    *size = data.size();
+
+    return image;
+}
+
+SC_API void sc_bin_image_free(void* image)
+{
+    ::free(image);
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const char* sc_bin_blueprint_name(const sc_bin_blueprint_t* blueprint)
+{
+    const BinaryBlueprint* p = AS_CTYPE(BinaryBlueprint, blueprint);
+    if (!p)
+        return "";
+
+    return p->name.c_str();
+}
+
+SC_API const char* sc_bin_blueprint_description(const sc_bin_blueprint_t* blueprint)
+{
+    const BinaryBlueprint* p = AS_CTYPE(BinaryBlueprint, blueprint);
+    if (!p)
+        return "";
+
+    return p->description.c_str();
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_metadata_collection_t* sc_bin_metadata_collection_handle(const sc_bin_blueprint_t* blueprint)
+{
+    const BinaryBlueprint* p = AS_CTYPE(BinaryBlueprint, blueprint);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_metadata_collection_t, &p->metadata);
+}
+
+SC_API size_t sc_bin_metadata_collection_size(const sc_bin_metadata_collection_t* metadata)
+{
+    const BinaryArray<BinaryKeyValue>* p = AS_CTYPE(BinaryArray<BinaryKeyValue>, metadata);
+    if (!p)
+        return 0;
+
+    return p->size;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_metadata_t* sc_bin_metadata_handle(const sc_bin_metadata_collection_t* metadata_col, size_t index)
+{
+    const BinaryArray<BinaryKeyValue>* p = AS_CTYPE(BinaryArray<BinaryKeyValue>, metadata_col);
+    if (!p || index >= p->size)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_metadata_t, &(*p)[index]);
+}
+
+SC_API const char* sc_bin_metadata_key(const sc_bin_metadata_t* metadata)
+{
+    const BinaryKeyValue* p = AS_CTYPE(BinaryKeyValue, metadata);
+    if (!p)
+        return "";
+
+    return p->key.c_str();
+}
+
+SC_API const char* sc_bin_metadata_value(const sc_bin_metadata_t* metadata)
+{
+    const BinaryKeyValue* p = AS_CTYPE(BinaryKeyValue, metadata);
+    if (!p)
+        return "";
+
+    return p->value.c_str();
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_resource_group_collection_t* sc_bin_resource_group_collection_handle(const sc_bin_blueprint_t* blueprint)
+{
+    const BinaryBlueprint* p = AS_CTYPE(BinaryBlueprint, blueprint);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_resource_group_collection_t, &p->resourceGroups);
+}
+
+SC_API size_t sc_bin_resource_group_collection_size(const sc_bin_resource_group_collection_t* resource)
+{
+    const BinaryArray<BinaryResourceGroup>* p = AS_CTYPE(BinaryArray<BinaryResourceGroup>, resource);
+    if (!p)
+        return 0;
+
+    return p->size;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_resource_group_t* sc_bin_resource_group_handle(const sc_bin_resource_group_collection_t* resource, size_t index)
+{
+    const BinaryArray<BinaryResourceGroup>* p = AS_CTYPE(BinaryArray<BinaryResourceGroup>, resource);
+    if (!p || index >= p->size)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_resource_group_t, &(*p)[index]);
+}
+
+SC_API const char* sc_bin_resource_group_name(const sc_bin_resource_group_t* handle)
+{
+    const BinaryResourceGroup* p = AS_CTYPE(BinaryResourceGroup, handle);
+    if (!p)
+        return "";
+
+    return p->name.c_str();
+}
+
+SC_API const char* sc_bin_resource_group_description(const sc_bin_resource_group_t* handle)
+{
+    const BinaryResourceGroup* p = AS_CTYPE(BinaryResourceGroup, handle);
+    if (!p)
+        return "";
+
+    return p->description.c_str();
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_resource_collection_t* sc_bin_resource_collection_handle(const sc_bin_resource_group_t* handle)
+{
+    const BinaryResourceGroup* p = AS_CTYPE(BinaryResourceGroup, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_resource_collection_t, &p->resources);
+}
+
+SC_API size_t sc_bin_resource_collection_size(const sc_bin_resource_collection_t* resource)
+{
+    const BinaryArray<BinaryResource>* p = AS_CTYPE(BinaryArray<BinaryResource>, resource);
+    if (!p)
+        return 0;
+
+    return p->size;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_resource_t* sc_bin_resource_handle(const sc_bin_resource_collection_t* resource, size_t index)
+{
+    const BinaryArray<BinaryResource>* p = AS_CTYPE(BinaryArray<BinaryResource>, resource);
+    if (!p || index >= p->size)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_resource_t, &(*p)[index]);
+}
+
+SC_API const char* sc_bin_resource_uritemplate(const sc_bin_resource_t* handle)
+{
+    const BinaryResource* p = AS_CTYPE(BinaryResource, handle);
+    if (!p)
+        return "";
+
+    return p->uriTemplate.c_str();
+}
+
+SC_API const char* sc_bin_resource_name(const sc_bin_resource_t* handle)
+{
+    const BinaryResource* p = AS_CTYPE(BinaryResource, handle);
+    if (!p)
+        return "";
+
+    return p->name.c_str();
+}
+
+SC_API const char* sc_bin_resource_description(const sc_bin_resource_t* handle)
+{
+    const BinaryResource* p = AS_CTYPE(BinaryResource, handle);
+    if (!p)
+        return "";
+
+    return p->description.c_str();
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_payload_collection_t* sc_bin_payload_collection_handle_requests(const sc_bin_transaction_example_t* handle)
+{
+    const BinaryTransactionExample* p = AS_CTYPE(BinaryTransactionExample, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_payload_collection_t, &p->requests);
+}
+
+SC_API const sc_bin_payload_collection_t* sc_bin_payload_collection_handle_responses(const sc_bin_transaction_example_t* handle)
+{
+    const BinaryTransactionExample* p = AS_CTYPE(BinaryTransactionExample, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_payload_collection_t, &p->responses);
+}
+
+SC_API size_t sc_bin_payload_collection_size(const sc_bin_payload_collection_t* handle)
+{
+    const BinaryArray<BinaryPayload>* p = AS_CTYPE(BinaryArray<BinaryPayload>, handle);
+    if (!p)
+        return 0;
+
+    return p->size;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_payload_t* sc_bin_payload_handle(const sc_bin_payload_collection_t* handle, size_t index)
+{
+    const BinaryArray<BinaryPayload>* p = AS_CTYPE(BinaryArray<BinaryPayload>, handle);
+    if (!p || index >= p->size)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_payload_t, &(*p)[index]);
+}
+
+SC_API const sc_bin_payload_t* sc_bin_payload_handle_resource(const sc_bin_resource_t* handle)
+{
+    const BinaryResource* p = AS_CTYPE(BinaryResource, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_payload_t, &p->model);
+}
+
+SC_API const char* sc_bin_payload_name(const sc_bin_payload_t* handle)
+{
+    const BinaryPayload* p = AS_CTYPE(BinaryPayload, handle);
+    if (!p)
+        return "";
+
+    return p->name.c_str();
+}
+
+SC_API const char* sc_bin_payload_description(const sc_bin_payload_t* handle)
+{
+    const BinaryPayload* p = AS_CTYPE(BinaryPayload, handle);
+    if (!p)
+        return "";
+
+    return p->description.c_str();
+}
+
+SC_API const char* sc_bin_payload_body(const sc_bin_payload_t* handle)
+{
+    const BinaryPayload* p = AS_CTYPE(BinaryPayload, handle);
+    if (!p)
+        return "";
+
+    return p->body.c_str();
+}
+
+SC_API const char* sc_bin_payload_schema(const sc_bin_payload_t* handle)
+{
+    const BinaryPayload* p = AS_CTYPE(BinaryPayload, handle);
+    if (!p)
+        return "";
+
+    return p->schema.c_str();
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_reference_t* sc_bin_reference_handle_payload(const sc_bin_payload_t* handle)
+{
+    const BinaryPayload* p = AS_CTYPE(BinaryPayload, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_reference_t, &p->reference);
+}
+
+SC_API const char* sc_bin_reference_id(const sc_bin_reference_t* handle)
+{
+    const BinaryReference* p = AS_CTYPE(BinaryReference, handle);
+    if (!p)
+        return "";
+
+    return p->id.c_str();
+}
+
+SC_API sc_reference_type_t sc_bin_reference_type(const sc_bin_reference_t* handle)
+{
+    const BinaryReference* p = AS_CTYPE(BinaryReference, handle);
+    if (!p)
+        return SC_TYPE_SYMBOL_REFERENCE;
+
+    return (sc_reference_type_t)p->type;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_parameter_collection_t* sc_bin_parameter_collection_handle_payload(const sc_bin_payload_t* handle)
+{
+    const BinaryPayload* p = AS_CTYPE(BinaryPayload, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_parameter_collection_t, &p->parameters);
+}
+
+SC_API const sc_bin_parameter_collection_t* sc_bin_parameter_collection_handle_resource(const sc_bin_resource_t* handle)
+{
+    const BinaryResource* p = AS_CTYPE(BinaryResource, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_parameter_collection_t, &p->parameters);
+}
+
+SC_API const sc_bin_parameter_collection_t* sc_bin_parameter_collection_handle_action(const sc_bin_action_t* handle)
+{
+    const BinaryAction* p = AS_CTYPE(BinaryAction, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_parameter_collection_t, &p->parameters);
+}
+
+SC_API size_t sc_bin_parameter_collection_size(const sc_bin_parameter_collection_t* handle)
+{
+    const BinaryArray<BinaryParameter>* p = AS_CTYPE(BinaryArray<BinaryParameter>, handle);
+    if (!p)
+        return 0;
+
+    return p->size;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_parameter_t* sc_bin_parameter_handle(const sc_bin_parameter_collection_t* handle, size_t index)
+{
+    const BinaryArray<BinaryParameter>* p = AS_CTYPE(BinaryArray<BinaryParameter>, handle);
+    if (!p || index >= p->size)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_parameter_t, &(*p)[index]);
+}
+
+SC_API const char* sc_bin_parameter_name(const sc_bin_parameter_t* handle)
+{
+    const BinaryParameter* p = AS_CTYPE(BinaryParameter, handle);
+    if (!p)
+        return "";
+
+    return p->name.c_str();
+}
+
+SC_API const char* sc_bin_parameter_description(const sc_bin_parameter_t* handle)
+{
+    const BinaryParameter* p = AS_CTYPE(BinaryParameter, handle);
+    if (!p)
+        return "";
+
+    return p->description.c_str();
+}
+
+SC_API const char* sc_bin_parameter_type(const sc_bin_parameter_t* handle)
+{
+    const BinaryParameter* p = AS_CTYPE(BinaryParameter, handle);
+    if (!p)
+        return "";
+
+    return p->type.c_str();
+}
+
+SC_API sc_parameter_use sc_bin_parameter_parameter_use(const sc_bin_parameter_t* handle)
+{
+    const BinaryParameter* p = AS_CTYPE(BinaryParameter, handle);
+    if (!p)
+        return SC_UNDEFINED_PARAMETER_USE;
+
+    return (sc_parameter_use)p->use;
+}
+
+SC_API const char* sc_bin_parameter_default_value(const sc_bin_parameter_t* handle)
+{
+    const BinaryParameter* p = AS_CTYPE(BinaryParameter, handle);
+    if (!p)
+        return "";
+
+    return p->defaultValue.c_str();
+}
+
+SC_API const char* sc_bin_parameter_example_value(const sc_bin_parameter_t* handle)
+{
+    const BinaryParameter* p = AS_CTYPE(BinaryParameter, handle);
+    if (!p)
+        return "";
+
+    return p->exampleValue.c_str();
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_value_collection_t* sc_bin_value_collection_handle(const sc_bin_parameter_t* handle)
+{
+    const BinaryParameter* p = AS_CTYPE(BinaryParameter, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_value_collection_t, &p->values);
+}
+
+SC_API size_t sc_bin_value_collection_size(const sc_bin_value_collection_t* handle)
+{
+    const BinaryArray<BinaryString>* p = AS_CTYPE(BinaryArray<BinaryString>, handle);
+    if (!p)
+        return 0;
+
+    return p->size;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_value_t* sc_bin_value_handle(const sc_bin_value_collection_t* handle, size_t index)
+{
+    const BinaryArray<BinaryString>* p = AS_CTYPE(BinaryArray<BinaryString>, handle);
+    if (!p || index >= p->size)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_value_t, &(*p)[index]);
+}
+
+SC_API const char* sc_bin_value(const sc_bin_value_t* handle)
+{
+    const BinaryString* p = AS_CTYPE(BinaryString, handle);
+    if (!p)
+        return "";
+
+    return p->c_str();
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_header_collection_t* sc_bin_header_collection_handle_payload(const sc_bin_payload_t* handle)
+{
+    const BinaryPayload* p = AS_CTYPE(BinaryPayload, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_header_collection_t, &p->headers);
+}
+
+SC_API const sc_bin_header_collection_t* sc_bin_header_collection_handle_resource(const sc_bin_resource_t* handle)
+{
+    const BinaryResource* p = AS_CTYPE(BinaryResource, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_header_collection_t, &p->headers);
+}
+
+SC_API const sc_bin_header_collection_t* sc_bin_header_collection_handle_action(const sc_bin_action_t* handle)
+{
+    const BinaryAction* p = AS_CTYPE(BinaryAction, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_header_collection_t, &p->headers);
+}
+
+SC_API size_t sc_bin_header_collection_size(const sc_bin_header_collection_t* handle)
+{
+    const BinaryArray<BinaryKeyValue>* p = AS_CTYPE(BinaryArray<BinaryKeyValue>, handle);
+    if (!p)
+        return 0;
+
+    return p->size;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_header_t* sc_bin_header_handle(const sc_bin_header_collection_t* handle, size_t index)
+{
+    const BinaryArray<BinaryKeyValue>* p = AS_CTYPE(BinaryArray<BinaryKeyValue>, handle);
+    if (!p || index >= p->size)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_header_t, &(*p)[index]);
+}
+
+SC_API const char* sc_bin_header_key(const sc_bin_header_t* handle)
+{
+    const BinaryKeyValue* p = AS_CTYPE(BinaryKeyValue, handle);
+    if (!p)
+        return "";
+
+    return p->key.c_str();
+}
+
+SC_API const char* sc_bin_header_value(const sc_bin_header_t* handle)
+{
+    const BinaryKeyValue* p = AS_CTYPE(BinaryKeyValue, handle);
+    if (!p)
+        return "";
+
+    return p->value.c_str();
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_action_collection_t* sc_bin_action_collection_handle(const sc_bin_resource_t* handle)
+{
+    const BinaryResource* p = AS_CTYPE(BinaryResource, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_action_collection_t, &p->actions);
+}
+
+SC_API size_t sc_bin_action_collection_size(const sc_bin_action_collection_t* handle)
+{
+    const BinaryArray<BinaryAction>* p = AS_CTYPE(BinaryArray<BinaryAction>, handle);
+    if (!p)
+        return 0;
+
+    return p->size;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_action_t* sc_bin_action_handle(const sc_bin_action_collection_t* handle, size_t index)
+{
+    const BinaryArray<BinaryAction>* p = AS_CTYPE(BinaryArray<BinaryAction>, handle);
+    if (!p || index >= p->size)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_action_t, &(*p)[index]);
+}
+
+SC_API const char* sc_bin_action_httpmethod(const sc_bin_action_t* handle)
+{
+    const BinaryAction* p = AS_CTYPE(BinaryAction, handle);
+    if (!p)
+        return "";
+
+    return p->method.c_str();
+}
+
+SC_API const char* sc_bin_action_name(const sc_bin_action_t* handle)
+{
+    const BinaryAction* p = AS_CTYPE(BinaryAction, handle);
+    if (!p)
+        return "";
+
+    return p->name.c_str();
+}
+
+SC_API const char* sc_bin_action_description(const sc_bin_action_t* handle)
+{
+    const BinaryAction* p = AS_CTYPE(BinaryAction, handle);
+    if (!p)
+        return "";
+
+    return p->description.c_str();
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_transaction_example_collection_t* sc_bin_transaction_example_collection_handle(const sc_bin_action_t* handle)
+{
+    const BinaryAction* p = AS_CTYPE(BinaryAction, handle);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_transaction_example_collection_t, &p->examples);
+}
+
+SC_API size_t sc_bin_transaction_example_collection_size(const sc_bin_transaction_example_collection_t* handle)
+{
+    const BinaryArray<BinaryTransactionExample>* p = AS_CTYPE(BinaryArray<BinaryTransactionExample>, handle);
+    if (!p)
+        return 0;
+
+    return p->size;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API const sc_bin_transaction_example_t* sc_bin_transaction_example_handle(const sc_bin_transaction_example_collection_t* handle, size_t index)
+{
+    const BinaryArray<BinaryTransactionExample>* p = AS_CTYPE(BinaryArray<BinaryTransactionExample>, handle);
+    if (!p || index >= p->size)
+        return NULL;
+
+    return AS_CTYPE(sc_bin_transaction_example_t, &(*p)[index]);
+}
+
+SC_API const char* sc_bin_transaction_example_name(const sc_bin_transaction_example_t* handle)
+{
+    const BinaryTransactionExample* p = AS_CTYPE(BinaryTransactionExample, handle);
+    if (!p)
+        return "";
+
+    return p->name.c_str();
+}
+
+SC_API const char* sc_bin_transaction_example_description(const sc_bin_transaction_example_t* handle)
+{
+    const BinaryTransactionExample* p = AS_CTYPE(BinaryTransactionExample, handle);
+    if (!p)
+        return "";
+
+    return p->description.c_str();
+}
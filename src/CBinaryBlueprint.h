@@ -0,0 +1,366 @@
+//
+//  CBinaryBlueprint.h
+//  snowcrash
+//  C Implementation of BinaryBlueprint.h for binding purposes
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SC_C_BINARYBLUEPRINT_H
+#define SC_C_BINARYBLUEPRINT_H
+
+#include "CBlueprint.h"
+#include "CBlueprintSourcemap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /** Memory mapped binary image file wrapper */
+    struct sc_bin_file_s;
+    typedef struct sc_bin_file_s sc_bin_file_t;
+
+    /** Binary Blueprint record */
+    struct sc_bin_blueprint_s;
+    typedef struct sc_bin_blueprint_s sc_bin_blueprint_t;
+
+    /** Binary Metadata array */
+    struct sc_bin_metadata_collection_s;
+    typedef struct sc_bin_metadata_collection_s sc_bin_metadata_collection_t;
+
+    /** Binary Metadata record */
+    struct sc_bin_metadata_s;
+    typedef struct sc_bin_metadata_s sc_bin_metadata_t;
+
+    /** Binary Resource Group array */
+    struct sc_bin_resource_group_collection_s;
+    typedef struct sc_bin_resource_group_collection_s sc_bin_resource_group_collection_t;
+
+    /** Binary Resource Group record */
+    struct sc_bin_resource_group_s;
+    typedef struct sc_bin_resource_group_s sc_bin_resource_group_t;
+
+    /** Binary Resource array */
+    struct sc_bin_resource_collection_s;
+    typedef struct sc_bin_resource_collection_s sc_bin_resource_collection_t;
+
+    /** Binary Resource record */
+    struct sc_bin_resource_s;
+    typedef struct sc_bin_resource_s sc_bin_resource_t;
+
+    /** Binary Payload array */
+    struct sc_bin_payload_collection_s;
+    typedef struct sc_bin_payload_collection_s sc_bin_payload_collection_t;
+
+    /** Binary Payload record */
+    struct sc_bin_payload_s;
+    typedef struct sc_bin_payload_s sc_bin_payload_t;
+
+    /** Binary Reference record */
+    struct sc_bin_reference_s;
+    typedef struct sc_bin_reference_s sc_bin_reference_t;
+
+    /** Binary Parameter array */
+    struct sc_bin_parameter_collection_s;
+    typedef struct sc_bin_parameter_collection_s sc_bin_parameter_collection_t;
+
+    /** Binary Parameter record */
+    struct sc_bin_parameter_s;
+    typedef struct sc_bin_parameter_s sc_bin_parameter_t;
+
+    /** Binary Header array */
+    struct sc_bin_header_collection_s;
+    typedef struct sc_bin_header_collection_s sc_bin_header_collection_t;
+
+    /** Binary Header record */
+    struct sc_bin_header_s;
+    typedef struct sc_bin_header_s sc_bin_header_t;
+
+    /** Binary Value array */
+    struct sc_bin_value_collection_s;
+    typedef struct sc_bin_value_collection_s sc_bin_value_collection_t;
+
+    /** Binary Value record */
+    struct sc_bin_value_s;
+    typedef struct sc_bin_value_s sc_bin_value_t;
+
+    /** Binary Action array */
+    struct sc_bin_action_collection_s;
+    typedef struct sc_bin_action_collection_s sc_bin_action_collection_t;
+
+    /** Binary Action record */
+    struct sc_bin_action_s;
+    typedef struct sc_bin_action_s sc_bin_action_t;
+
+    /** Binary Transaction Example array */
+    struct sc_bin_transaction_example_collection_s;
+    typedef struct sc_bin_transaction_example_collection_s sc_bin_transaction_example_collection_t;
+
+    /** Binary Transaction Example record */
+    struct sc_bin_transaction_example_s;
+    typedef struct sc_bin_transaction_example_s sc_bin_transaction_example_t;
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Blueprint of binary image `data` in place, NULL if the image is not valid */
+    SC_API const sc_bin_blueprint_t* sc_bin_blueprint_open(const void* data, size_t size);
+
+    /** \returns Memory mapped binary image file, NULL if the file can't be mapped */
+    SC_API sc_bin_file_t* sc_bin_file_open(const char* path);
+
+    /** \deallocate Memory mapped binary image file */
+    SC_API void sc_bin_file_close(sc_bin_file_t* file);
+
+    /** \returns Blueprint of memory mapped binary image, NULL if the image is not valid */
+    SC_API const sc_bin_blueprint_t* sc_bin_file_blueprint(const sc_bin_file_t* file);
+
+    /**
+     *  \returns Binary image of `blueprint` and of `sm_blueprint` unless it is NULL,
+     *  in one buffer of `size` bytes aligned for the image records
+     *
+     *  The image is opened by `sc_bin_blueprint_open` or read directly, the layout
+     *  of its records is described in BinaryBlueprint.h. NULL if out of memory or
+     *  if the image does not fit the 32-bit offsets of the records.
+     */
+    SC_API void* sc_bin_image_export(const sc_blueprint_t* blueprint, const sc_sm_blueprint_t* sm_blueprint, size_t* size);
+
+    /** \deallocate Binary image of `sc_bin_image_export` */
+    SC_API void sc_bin_image_free(void* image);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Blueprint name */
+    SC_API const char* sc_bin_blueprint_name(const sc_bin_blueprint_t* blueprint);
+
+    /** \returns Blueprint description */
+    SC_API const char* sc_bin_blueprint_description(const sc_bin_blueprint_t* blueprint);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Metadata array handle */
+    SC_API const sc_bin_metadata_collection_t* sc_bin_metadata_collection_handle(const sc_bin_blueprint_t* blueprint);
+
+    /** \returns size of Metadata array */
+    SC_API size_t sc_bin_metadata_collection_size(const sc_bin_metadata_collection_t* metadata);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Metadata at `index` handle */
+    SC_API const sc_bin_metadata_t* sc_bin_metadata_handle(const sc_bin_metadata_collection_t* metadata_col, size_t index);
+
+    /** \returns Metadata key */
+    SC_API const char* sc_bin_metadata_key(const sc_bin_metadata_t* metadata);
+
+    /** \returns Metadata value */
+    SC_API const char* sc_bin_metadata_value(const sc_bin_metadata_t* metadata);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Resource Group Collection array handle */
+    SC_API const sc_bin_resource_group_collection_t* sc_bin_resource_group_collection_handle(const sc_bin_blueprint_t* blueprint);
+
+    /** \returns size of Resource Group Collection array */
+    SC_API size_t sc_bin_resource_group_collection_size(const sc_bin_resource_group_collection_t* resource);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Resource Group handle */
+    SC_API const sc_bin_resource_group_t* sc_bin_resource_group_handle(const sc_bin_resource_group_collection_t* resource, size_t index);
+
+    /** \returns Resource Group name */
+    SC_API const char* sc_bin_resource_group_name(const sc_bin_resource_group_t* handle);
+
+    /** \returns Resource Group description */
+    SC_API const char* sc_bin_resource_group_description(const sc_bin_resource_group_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Resource array handle */
+    SC_API const sc_bin_resource_collection_t* sc_bin_resource_collection_handle(const sc_bin_resource_group_t* handle);
+
+    /** \returns Resource array size */
+    SC_API size_t sc_bin_resource_collection_size(const sc_bin_resource_collection_t* resource);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Resource handle */
+    SC_API const sc_bin_resource_t* sc_bin_resource_handle(const sc_bin_resource_collection_t* resource, size_t index);
+
+    /** \returns Resource URITemplate */
+    SC_API const char* sc_bin_resource_uritemplate(const sc_bin_resource_t* handle);
+
+    /** \returns Resource name */
+    SC_API const char* sc_bin_resource_name(const sc_bin_resource_t* handle);
+
+    /** \returns Resource description */
+    SC_API const char* sc_bin_resource_description(const sc_bin_resource_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Payload Collection array handle from TransactionExample for requests*/
+    SC_API const sc_bin_payload_collection_t* sc_bin_payload_collection_handle_requests(const sc_bin_transaction_example_t* handle);
+
+    /** \returns Payload Collection array handle from TransactionExample for responses*/
+    SC_API const sc_bin_payload_collection_t* sc_bin_payload_collection_handle_responses(const sc_bin_transaction_example_t* handle);
+
+    /** \returns Payload Collection array size */
+    SC_API size_t sc_bin_payload_collection_size(const sc_bin_payload_collection_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Payload at `index` handle */
+    SC_API const sc_bin_payload_t* sc_bin_payload_handle(const sc_bin_payload_collection_t* handle, size_t index);
+
+    /** \returns Payload handle from resource */
+    SC_API const sc_bin_payload_t* sc_bin_payload_handle_resource(const sc_bin_resource_t* handle);
+
+    /** \returns Payload name */
+    SC_API const char* sc_bin_payload_name(const sc_bin_payload_t* handle);
+
+    /** \returns Payload description */
+    SC_API const char* sc_bin_payload_description(const sc_bin_payload_t* handle);
+
+    /** \returns Payload body */
+    SC_API const char* sc_bin_payload_body(const sc_bin_payload_t* handle);
+
+    /** \returns Payload schema */
+    SC_API const char* sc_bin_payload_schema(const sc_bin_payload_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Reference handle from payload */
+    SC_API const sc_bin_reference_t* sc_bin_reference_handle_payload(const sc_bin_payload_t* handle);
+
+    /** \returns Reference identifier */
+    SC_API const char* sc_bin_reference_id(const sc_bin_reference_t* handle);
+
+    /** \returns Reference type */
+    SC_API sc_reference_type_t sc_bin_reference_type(const sc_bin_reference_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Parameter Collection handle from Payload */
+    SC_API const sc_bin_parameter_collection_t* sc_bin_parameter_collection_handle_payload(const sc_bin_payload_t* handle);
+
+    /** \returns Parameter Collection handle from Resource */
+    SC_API const sc_bin_parameter_collection_t* sc_bin_parameter_collection_handle_resource(const sc_bin_resource_t* handle);
+
+    /** \returns Parameter Collection handle from Action */
+    SC_API const sc_bin_parameter_collection_t* sc_bin_parameter_collection_handle_action(const sc_bin_action_t* handle);
+
+    /** \returns Parameter Collection size */
+    SC_API size_t sc_bin_parameter_collection_size(const sc_bin_parameter_collection_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Parameter handle */
+    SC_API const sc_bin_parameter_t* sc_bin_parameter_handle(const sc_bin_parameter_collection_t* handle, size_t index);
+
+    /** \returns Parameter name */
+    SC_API const char* sc_bin_parameter_name(const sc_bin_parameter_t* handle);
+
+    /** \returns Parameter description */
+    SC_API const char* sc_bin_parameter_description(const sc_bin_parameter_t* handle);
+
+    /** \returns Parameter type */
+    SC_API const char* sc_bin_parameter_type(const sc_bin_parameter_t* handle);
+
+    /** \returns Parameter use */
+    SC_API sc_parameter_use sc_bin_parameter_parameter_use(const sc_bin_parameter_t* handle);
+
+    /** \returns Parameter default value */
+    SC_API const char* sc_bin_parameter_default_value(const sc_bin_parameter_t* handle);
+
+    /** \returns Parameter example value */
+    SC_API const char* sc_bin_parameter_example_value(const sc_bin_parameter_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Value Collection array handle */
+    SC_API const sc_bin_value_collection_t* sc_bin_value_collection_handle(const sc_bin_parameter_t* handle);
+
+    /** \returns Value Collection array size */
+    SC_API size_t sc_bin_value_collection_size(const sc_bin_value_collection_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Value handle */
+    SC_API const sc_bin_value_t* sc_bin_value_handle(const sc_bin_value_collection_t* handle, size_t index);
+
+    /** \returns Value string */
+    SC_API const char* sc_bin_value(const sc_bin_value_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Header Collection array handle from Payload */
+    SC_API const sc_bin_header_collection_t* sc_bin_header_collection_handle_payload(const sc_bin_payload_t* handle);
+
+    /** \returns Header Collection array handle from Resource */
+    SC_API const sc_bin_header_collection_t* sc_bin_header_collection_handle_resource(const sc_bin_resource_t* handle);
+
+    /** \returns Header Collection array handle from Action */
+    SC_API const sc_bin_header_collection_t* sc_bin_header_collection_handle_action(const sc_bin_action_t* handle);
+
+    /** \returns Header Collection array size */
+    SC_API size_t sc_bin_header_collection_size(const sc_bin_header_collection_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Header handle */
+    SC_API const sc_bin_header_t* sc_bin_header_handle(const sc_bin_header_collection_t* handle, size_t index);
+
+    /** \returns Header Key */
+    SC_API const char* sc_bin_header_key(const sc_bin_header_t* handle);
+
+    /** \returns Header Value */
+    SC_API const char* sc_bin_header_value(const sc_bin_header_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Action Collection array handle */
+    SC_API const sc_bin_action_collection_t* sc_bin_action_collection_handle(const sc_bin_resource_t* handle);
+
+    /** \returns Action Collection array size */
+    SC_API size_t sc_bin_action_collection_size(const sc_bin_action_collection_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Action handle */
+    SC_API const sc_bin_action_t* sc_bin_action_handle(const sc_bin_action_collection_t* handle, size_t index);
+
+    /** \returns Action HTTPMethod */
+    SC_API const char* sc_bin_action_httpmethod(const sc_bin_action_t* handle);
+
+    /** \returns Action name */
+    SC_API const char* sc_bin_action_name(const sc_bin_action_t* handle);
+
+    /** \returns Action description */
+    SC_API const char* sc_bin_action_description(const sc_bin_action_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Transaction Example Collection array handle */
+    SC_API const sc_bin_transaction_example_collection_t* sc_bin_transaction_example_collection_handle(const sc_bin_action_t* handle);
+
+    /** \returns Transaction Example Collection array size */
+    SC_API size_t sc_bin_transaction_example_collection_size(const sc_bin_transaction_example_collection_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns Transaction Example handle */
+    SC_API const sc_bin_transaction_example_t* sc_bin_transaction_example_handle(const sc_bin_transaction_example_collection_t* handle, size_t index);
+
+    /** \returns Transaction Example name */
+    SC_API const char* sc_bin_transaction_example_name(const sc_bin_transaction_example_t* handle);
+
+    /** \returns Transaction Example description */
+    SC_API const char* sc_bin_transaction_example_description(const sc_bin_transaction_example_t* handle);
+
+    /*----------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
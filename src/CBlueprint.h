@@ -24,7 +24,9 @@ extern "C" {
     enum sc_blueprint_parser_option {
         SC_RENDER_DESCRIPTIONS_OPTION = (1 << 0),       /// < Render Markdown in description.
         SC_REQUIRE_BLUEPRINT_NAME_OPTION = (1 << 1),    /// < Treat missing blueprint name as error
-        SC_EXPORT_SORUCEMAP_OPTION = (1 << 2)           /// < Export source maps AST
+        SC_EXPORT_SORUCEMAP_OPTION = (1 << 2),          /// < Export source maps AST
+        SC_ABORT_ON_ERROR_OPTION = (1 << 3),            /// < Stop parsing on the first error
+        SC_VALIDATE_ONLY_OPTION = (1 << 4)              /// < Produce the report only, the AST is incomplete
     };
 
     /** Parameter Use flag */
@@ -68,6 +68,9 @@ namespace snowcrash {
             // Other blocks, process & warn
             content += mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
 
+            if (!pd.reportsWarning(report, IndentationWarning))
+                return;
+
             // WARN: Not a preformatted code block
             size_t level = codeBlockIndentationLevel(pd.parentSectionContext());
             std::stringstream ss;
@@ -101,6 +104,9 @@ namespace snowcrash {
             content += remainingContent;
             content += "\n";
 
+            if (!pd.reportsWarning(report, IndentationWarning))
+                return;
+
             // WARN: Not a preformatted code block but multiline signature
             size_t level = codeBlockIndentationLevel(pd.parentSectionContext());
             std::stringstream ss;
@@ -129,6 +135,9 @@ namespace snowcrash {
                                               const SectionParserData& pd,
                                               Report& report) {
 
+            if (!pd.reportsWarning(report, IndentationWarning))
+                return false;
+
             // Check for possible superfluous indentation of a recognized list items.
             mdp::ByteBuffer r;
             mdp::ByteBuffer line = GetFirstLine(node->text, r);
@@ -226,7 +235,7 @@ namespace snowcrash {
 
             checkPossibleReference(node, pd, report);
 
-            if (level) {
+            if (level && pd.reportsWarning(report, IndentationWarning)) {
                 // WARN: Dangling asset
                 std::stringstream ss;
                 ss << "dangling message-body asset, expected a pre-formatted code block, ";
@@ -256,14 +265,17 @@ namespace snowcrash {
 
             if(GetSymbolReference(source, symbol)) {
 
-                std::stringstream ss;
-                ss << "found a possible '" << symbol << "' model reference, ";
-                ss << "a reference must be directly in the " << SectionName(pd.sectionContext()) << " section, indented by 4 spaces or 1 tab, without any additional sections";
+                if (pd.reportsWarning(report, IgnoringWarning)) {
 
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-                report.warnings.push_back(Warning(ss.str(),
-                                                  IgnoringWarning,
-                                                  sourceMap));
+                    std::stringstream ss;
+                    ss << "found a possible '" << symbol << "' model reference, ";
+                    ss << "a reference must be directly in the " << SectionName(pd.sectionContext()) << " section, indented by 4 spaces or 1 tab, without any additional sections";
+
+                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                    report.warnings.push_back(Warning(ss.str(),
+                                                      IgnoringWarning,
+                                                      sourceMap));
+                }
 
                 return true;
             }
@@ -0,0 +1,500 @@
+//
+//  CompactSourceMap.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <map>
+#include "CompactSourceMap.h"
+
+using namespace snowcrash;
+
+typedef CompactSourceMap::NodeId NodeId;
+typedef CompactSourceMap::RangeId RangeId;
+
+/** Range pool lookup, (location, length) to range id */
+typedef std::map<std::pair<size_t, size_t>, RangeId> RangeIndex;
+
+/** State of compact source map building */
+struct CompactBuilder {
+
+    CompactBuilder(CompactSourceMap& compact_) : compact(compact_) {}
+
+    CompactSourceMap& compact;
+    RangeIndex rangeIndex;
+
+    /** Open a new node, subsequent entries belong to this node */
+    NodeId node(SourceMapNodeKind kind, NodeId parent) {
+
+        NodeId id = static_cast<NodeId>(compact.nodeKinds.size());
+
+        compact.nodeKinds.push_back(static_cast<unsigned char>(kind));
+        compact.nodeParents.push_back(parent);
+        compact.nodeEntries.push_back(static_cast<unsigned int>(compact.entryNodes.size()));
+
+        return id;
+    }
+
+    /** Add an entry for every (coalesced) range of a range set */
+    void entries(NodeId node, SourceMapField field, const mdp::BytesRangeSet& sourceMap) {
+
+        mdp::BytesRangeSet::const_iterator it = sourceMap.begin();
+
+        while (it != sourceMap.end()) {
+
+            size_t location = it->location;
+            size_t length = it->length;
+
+            // Coalesce adjacent ranges
+            for (++it; it != sourceMap.end() && location + length == it->location; ++it) {
+                length += it->length;
+            }
+
+            compact.entryNodes.push_back(node);
+            compact.entryFields.push_back(static_cast<unsigned char>(field));
+            compact.entryRanges.push_back(range(location, length));
+        }
+    }
+
+    /** Find or insert a range into the pool */
+    RangeId range(size_t location, size_t length) {
+
+        std::pair<RangeIndex::iterator, bool> inserted =
+            rangeIndex.insert(RangeIndex::value_type(std::make_pair(location, length),
+                                                     static_cast<RangeId>(compact.rangeLocations.size())));
+
+        if (inserted.second) {
+            compact.rangeLocations.push_back(location);
+            compact.rangeLengths.push_back(length);
+        }
+
+        return inserted.first->second;
+    }
+};
+
+/** Headers or Metadata */
+static void compactKeyValues(const Collection<SourceMap<Header> >::type& collection,
+                             SourceMapNodeKind kind,
+                             NodeId parent,
+                             CompactBuilder& builder)
+{
+    for (Collection<SourceMap<Header> >::const_iterator it = collection.begin();
+         it != collection.end();
+         ++it) {
+
+        NodeId id = builder.node(kind, parent);
+        builder.entries(id, NodeSourceMapField, it->sourceMap);
+    }
+}
+
+/** Parameters */
+static void compactParameters(const SourceMap<Parameters>& parameters,
+                              NodeId parent,
+                              CompactBuilder& builder)
+{
+    for (Collection<SourceMap<Parameter> >::const_iterator it = parameters.collection.begin();
+         it != parameters.collection.end();
+         ++it) {
+
+        NodeId id = builder.node(ParameterSourceMapNodeKind, parent);
+
+        builder.entries(id, NodeSourceMapField, it->sourceMap);
+        builder.entries(id, NameSourceMapField, it->name.sourceMap);
+        builder.entries(id, DescriptionSourceMapField, it->description.sourceMap);
+        builder.entries(id, TypeSourceMapField, it->type.sourceMap);
+        builder.entries(id, UseSourceMapField, it->use.sourceMap);
+        builder.entries(id, DefaultValueSourceMapField, it->defaultValue.sourceMap);
+        builder.entries(id, ExampleValueSourceMapField, it->exampleValue.sourceMap);
+
+        for (Collection<SourceMap<Value> >::const_iterator valueIt = it->values.collection.begin();
+             valueIt != it->values.collection.end();
+             ++valueIt) {
+
+            NodeId valueId = builder.node(ValueSourceMapNodeKind, id);
+            builder.entries(valueId, NodeSourceMapField, valueIt->sourceMap);
+        }
+    }
+}
+
+/** Request, Response or Model */
+static void compactPayload(const SourceMap<Payload>& payload,
+                           SourceMapNodeKind kind,
+                           NodeId parent,
+                           CompactBuilder& builder)
+{
+    NodeId id = builder.node(kind, parent);
+
+    builder.entries(id, NodeSourceMapField, payload.sourceMap);
+    builder.entries(id, NameSourceMapField, payload.name.sourceMap);
+    builder.entries(id, DescriptionSourceMapField, payload.description.sourceMap);
+    builder.entries(id, BodySourceMapField, payload.body.sourceMap);
+    builder.entries(id, SchemaSourceMapField, payload.schema.sourceMap);
+    builder.entries(id, ReferenceSourceMapField, payload.reference.sourceMap);
+
+    compactParameters(payload.parameters, id, builder);
+    compactKeyValues(payload.headers.collection, HeaderSourceMapNodeKind, id, builder);
+}
+
+/** Transaction Example */
+static void compactTransactionExample(const SourceMap<TransactionExample>& example,
+                                      NodeId parent,
+                                      CompactBuilder& builder)
+{
+    NodeId id = builder.node(TransactionExampleSourceMapNodeKind, parent);
+
+    builder.entries(id, NodeSourceMapField, example.sourceMap);
+    builder.entries(id, NameSourceMapField, example.name.sourceMap);
+    builder.entries(id, DescriptionSourceMapField, example.description.sourceMap);
+
+    for (Collection<SourceMap<Request> >::const_iterator it = example.requests.collection.begin();
+         it != example.requests.collection.end();
+         ++it) {
+
+        compactPayload(*it, RequestSourceMapNodeKind, id, builder);
+    }
+
+    for (Collection<SourceMap<Response> >::const_iterator it = example.responses.collection.begin();
+         it != example.responses.collection.end();
+         ++it) {
+
+        compactPayload(*it, ResponseSourceMapNodeKind, id, builder);
+    }
+}
+
+/** Action */
+static void compactAction(const SourceMap<Action>& action,
+                          NodeId parent,
+                          CompactBuilder& builder)
+{
+    NodeId id = builder.node(ActionSourceMapNodeKind, parent);
+
+    builder.entries(id, NodeSourceMapField, action.sourceMap);
+    builder.entries(id, NameSourceMapField, action.name.sourceMap);
+    builder.entries(id, DescriptionSourceMapField, action.description.sourceMap);
+    builder.entries(id, MethodSourceMapField, action.method.sourceMap);
+
+    compactParameters(action.parameters, id, builder);
+    compactKeyValues(action.headers.collection, HeaderSourceMapNodeKind, id, builder);
+
+    for (Collection<SourceMap<TransactionExample> >::const_iterator it = action.examples.collection.begin();
+         it != action.examples.collection.end();
+         ++it) {
+
+        compactTransactionExample(*it, id, builder);
+    }
+}
+
+/** Resource */
+static void compactResource(const SourceMap<Resource>& resource,
+                            NodeId parent,
+                            CompactBuilder& builder)
+{
+    NodeId id = builder.node(ResourceSourceMapNodeKind, parent);
+
+    builder.entries(id, NodeSourceMapField, resource.sourceMap);
+    builder.entries(id, NameSourceMapField, resource.name.sourceMap);
+    builder.entries(id, DescriptionSourceMapField, resource.description.sourceMap);
+    builder.entries(id, URITemplateSourceMapField, resource.uriTemplate.sourceMap);
+
+    compactPayload(resource.model, ModelSourceMapNodeKind, id, builder);
+    compactParameters(resource.parameters, id, builder);
+    compactKeyValues(resource.headers.collection, HeaderSourceMapNodeKind, id, builder);
+
+    for (Collection<SourceMap<Action> >::const_iterator it = resource.actions.collection.begin();
+         it != resource.actions.collection.end();
+         ++it) {
+
+        compactAction(*it, id, builder);
+    }
+}
+
+/** Resource Group */
+static void compactResourceGroup(const SourceMap<ResourceGroup>& group,
+                                 NodeId parent,
+                                 CompactBuilder& builder)
+{
+    NodeId id = builder.node(ResourceGroupSourceMapNodeKind, parent);
+
+    builder.entries(id, NodeSourceMapField, group.sourceMap);
+    builder.entries(id, NameSourceMapField, group.name.sourceMap);
+    builder.entries(id, DescriptionSourceMapField, group.description.sourceMap);
+
+    for (Collection<SourceMap<Resource> >::const_iterator it = group.resources.collection.begin();
+         it != group.resources.collection.end();
+         ++it) {
+
+        compactResource(*it, id, builder);
+    }
+}
+
+void snowcrash::BuildCompactSourceMap(const SourceMap<Blueprint>& sourceMap,
+                                      CompactSourceMap& compact)
+{
+    compact.clear();
+
+    CompactBuilder builder(compact);
+    NodeId id = builder.node(BlueprintSourceMapNodeKind, 0);
+
+    builder.entries(id, NodeSourceMapField, sourceMap.sourceMap);
+    builder.entries(id, NameSourceMapField, sourceMap.name.sourceMap);
+    builder.entries(id, DescriptionSourceMapField, sourceMap.description.sourceMap);
+
+    compactKeyValues(sourceMap.metadata.collection, MetadataSourceMapNodeKind, id, builder);
+
+    for (Collection<SourceMap<ResourceGroup> >::const_iterator it = sourceMap.resourceGroups.collection.begin();
+         it != sourceMap.resourceGroups.collection.end();
+         ++it) {
+
+        compactResourceGroup(*it, id, builder);
+    }
+}
+
+void CompactSourceMap::clear()
+{
+    nodeKinds.clear();
+    nodeParents.clear();
+    nodeEntries.clear();
+    entryNodes.clear();
+    entryFields.clear();
+    entryRanges.clear();
+    rangeLocations.clear();
+    rangeLengths.clear();
+}
+
+mdp::BytesRangeSet CompactSourceMap::sourceMap(NodeId node, SourceMapField field) const
+{
+    mdp::BytesRangeSet result;
+
+    if (node >= nodeKinds.size())
+        return result;
+
+    size_t end = (node + 1 < nodeEntries.size()) ? nodeEntries[node + 1] : entryNodes.size();
+
+    for (size_t i = nodeEntries[node]; i < end; ++i) {
+
+        if (entryFields[i] != field)
+            continue;
+
+        RangeId range = entryRanges[i];
+        result.push_back(mdp::BytesRange(rangeLocations[range], rangeLengths[range]));
+    }
+
+    return result;
+}
+
+size_t CompactSourceMap::memoryUsage() const
+{
+    return nodeKinds.capacity() * sizeof(unsigned char)
+         + nodeParents.capacity() * sizeof(NodeId)
+         + nodeEntries.capacity() * sizeof(unsigned int)
+         + entryNodes.capacity() * sizeof(NodeId)
+         + entryFields.capacity() * sizeof(unsigned char)
+         + entryRanges.capacity() * sizeof(RangeId)
+         + rangeLocations.capacity() * sizeof(size_t)
+         + rangeLengths.capacity() * sizeof(size_t);
+}
+
+/** Cursor of compact source map expansion */
+struct CompactReader {
+
+    CompactReader(const CompactSourceMap& compact_) : compact(compact_), current(0) {}
+
+    const CompactSourceMap& compact;
+    NodeId current;
+
+    /** \return True if the next node is of given kind and parent */
+    bool next(SourceMapNodeKind kind, NodeId parent) const {
+        return current < compact.size()
+            && compact.nodeKinds[current] == kind
+            && compact.nodeParents[current] == parent;
+    }
+
+    /** Consume next node */
+    NodeId node() {
+        return current++;
+    }
+
+    /** Retrieve source map of a node field */
+    void read(NodeId node, SourceMapField field, mdp::BytesRangeSet& sourceMap) const {
+        sourceMap = compact.sourceMap(node, field);
+    }
+};
+
+/** Headers or Metadata */
+static void expandKeyValues(SourceMapNodeKind kind,
+                            NodeId parent,
+                            CompactReader& reader,
+                            Collection<SourceMap<Header> >::type& collection)
+{
+    while (reader.next(kind, parent)) {
+
+        SourceMap<Header> keyValue;
+        reader.read(reader.node(), NodeSourceMapField, keyValue.sourceMap);
+        collection.push_back(keyValue);
+    }
+}
+
+/** Parameters */
+static void expandParameters(NodeId parent,
+                             CompactReader& reader,
+                             SourceMap<Parameters>& parameters)
+{
+    while (reader.next(ParameterSourceMapNodeKind, parent)) {
+
+        NodeId id = reader.node();
+        SourceMap<Parameter> parameter;
+
+        reader.read(id, NodeSourceMapField, parameter.sourceMap);
+        reader.read(id, NameSourceMapField, parameter.name.sourceMap);
+        reader.read(id, DescriptionSourceMapField, parameter.description.sourceMap);
+        reader.read(id, TypeSourceMapField, parameter.type.sourceMap);
+        reader.read(id, UseSourceMapField, parameter.use.sourceMap);
+        reader.read(id, DefaultValueSourceMapField, parameter.defaultValue.sourceMap);
+        reader.read(id, ExampleValueSourceMapField, parameter.exampleValue.sourceMap);
+
+        while (reader.next(ValueSourceMapNodeKind, id)) {
+
+            SourceMap<Value> value;
+            reader.read(reader.node(), NodeSourceMapField, value.sourceMap);
+            parameter.values.collection.push_back(value);
+        }
+
+        parameters.collection.push_back(parameter);
+    }
+}
+
+/** Request, Response or Model */
+static void expandPayload(CompactReader& reader,
+                          SourceMap<Payload>& payload)
+{
+    NodeId id = reader.node();
+
+    reader.read(id, NodeSourceMapField, payload.sourceMap);
+    reader.read(id, NameSourceMapField, payload.name.sourceMap);
+    reader.read(id, DescriptionSourceMapField, payload.description.sourceMap);
+    reader.read(id, BodySourceMapField, payload.body.sourceMap);
+    reader.read(id, SchemaSourceMapField, payload.schema.sourceMap);
+    reader.read(id, ReferenceSourceMapField, payload.reference.sourceMap);
+
+    expandParameters(id, reader, payload.parameters);
+    expandKeyValues(HeaderSourceMapNodeKind, id, reader, payload.headers.collection);
+}
+
+/** Transaction Example */
+static void expandTransactionExample(CompactReader& reader,
+                                     SourceMap<TransactionExample>& example)
+{
+    NodeId id = reader.node();
+
+    reader.read(id, NodeSourceMapField, example.sourceMap);
+    reader.read(id, NameSourceMapField, example.name.sourceMap);
+    reader.read(id, DescriptionSourceMapField, example.description.sourceMap);
+
+    while (reader.next(RequestSourceMapNodeKind, id)) {
+
+        SourceMap<Request> request;
+        expandPayload(reader, request);
+        example.requests.collection.push_back(request);
+    }
+
+    while (reader.next(ResponseSourceMapNodeKind, id)) {
+
+        SourceMap<Response> response;
+        expandPayload(reader, response);
+        example.responses.collection.push_back(response);
+    }
+}
+
+/** Action */
+static void expandAction(CompactReader& reader,
+                         SourceMap<Action>& action)
+{
+    NodeId id = reader.node();
+
+    reader.read(id, NodeSourceMapField, action.sourceMap);
+    reader.read(id, NameSourceMapField, action.name.sourceMap);
+    reader.read(id, DescriptionSourceMapField, action.description.sourceMap);
+    reader.read(id, MethodSourceMapField, action.method.sourceMap);
+
+    expandParameters(id, reader, action.parameters);
+    expandKeyValues(HeaderSourceMapNodeKind, id, reader, action.headers.collection);
+
+    while (reader.next(TransactionExampleSourceMapNodeKind, id)) {
+
+        SourceMap<TransactionExample> example;
+        expandTransactionExample(reader, example);
+        action.examples.collection.push_back(example);
+    }
+}
+
+/** Resource */
+static void expandResource(CompactReader& reader,
+                           SourceMap<Resource>& resource)
+{
+    NodeId id = reader.node();
+
+    reader.read(id, NodeSourceMapField, resource.sourceMap);
+    reader.read(id, NameSourceMapField, resource.name.sourceMap);
+    reader.read(id, DescriptionSourceMapField, resource.description.sourceMap);
+    reader.read(id, URITemplateSourceMapField, resource.uriTemplate.sourceMap);
+
+    if (reader.next(ModelSourceMapNodeKind, id)) {
+        expandPayload(reader, resource.model);
+    }
+
+    expandParameters(id, reader, resource.parameters);
+    expandKeyValues(HeaderSourceMapNodeKind, id, reader, resource.headers.collection);
+
+    while (reader.next(ActionSourceMapNodeKind, id)) {
+
+        SourceMap<Action> action;
+        expandAction(reader, action);
+        resource.actions.collection.push_back(action);
+    }
+}
+
+/** Resource Group */
+static void expandResourceGroup(CompactReader& reader,
+                                SourceMap<ResourceGroup>& group)
+{
+    NodeId id = reader.node();
+
+    reader.read(id, NodeSourceMapField, group.sourceMap);
+    reader.read(id, NameSourceMapField, group.name.sourceMap);
+    reader.read(id, DescriptionSourceMapField, group.description.sourceMap);
+
+    while (reader.next(ResourceSourceMapNodeKind, id)) {
+
+        SourceMap<Resource> resource;
+        expandResource(reader, resource);
+        group.resources.collection.push_back(resource);
+    }
+}
+
+void snowcrash::ExpandCompactSourceMap(const CompactSourceMap& compact,
+                                       SourceMap<Blueprint>& sourceMap)
+{
+    sourceMap = SourceMap<Blueprint>();
+
+    CompactReader reader(compact);
+
+    if (!reader.next(BlueprintSourceMapNodeKind, 0))
+        return;
+
+    NodeId id = reader.node();
+
+    reader.read(id, NodeSourceMapField, sourceMap.sourceMap);
+    reader.read(id, NameSourceMapField, sourceMap.name.sourceMap);
+    reader.read(id, DescriptionSourceMapField, sourceMap.description.sourceMap);
+
+    expandKeyValues(MetadataSourceMapNodeKind, id, reader, sourceMap.metadata.collection);
+
+    while (reader.next(ResourceGroupSourceMapNodeKind, id)) {
+
+        SourceMap<ResourceGroup> group;
+        expandResourceGroup(reader, group);
+        sourceMap.resourceGroups.collection.push_back(group);
+    }
+}
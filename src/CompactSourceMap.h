@@ -0,0 +1,155 @@
+//
+//  CompactSourceMap.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_COMPACTSOURCEMAP_H
+#define SNOWCRASH_COMPACTSOURCEMAP_H
+
+#include <vector>
+#include "BlueprintSourcemap.h"
+
+/**
+ *  Compact API Blueprint Sourcemap
+ *  -------------------------------
+ *
+ *  Flat, struct-of-arrays alternative to the nested `SourceMap<Blueprint>`.
+ *
+ *  Every sourcemap node (blueprint, resource group, resource, ...) gets a node id
+ *  in pre-order of the `SourceMap<Blueprint>` traversal. Source map ranges of
+ *  the node fields are stored in one table of (node id, field, range id) rows.
+ *  Adjacent ranges are coalesced and identical ranges are stored only once in
+ *  the range pool.
+ *
+ *  The compact sourcemap is converted from a `SourceMap<Blueprint>` once the
+ *  parse is done. The parser still builds the nested sourcemap, so the peak
+ *  memory of a parse exporting sourcemap is not reduced, only the memory of
+ *  the sourcemap kept afterwards.
+ */
+
+namespace snowcrash {
+
+    /** Kind of a compact sourcemap node */
+    enum SourceMapNodeKind {
+        BlueprintSourceMapNodeKind = 0,         /// < Blueprint
+        MetadataSourceMapNodeKind,              /// < One Metadata
+        ResourceGroupSourceMapNodeKind,         /// < Resource group
+        ResourceSourceMapNodeKind,              /// < Resource
+        ModelSourceMapNodeKind,                 /// < Resource model
+        ParameterSourceMapNodeKind,             /// < Parameter
+        ValueSourceMapNodeKind,                 /// < One Parameter value
+        HeaderSourceMapNodeKind,                /// < One Header
+        ActionSourceMapNodeKind,                /// < Action
+        TransactionExampleSourceMapNodeKind,    /// < Transaction example
+        RequestSourceMapNodeKind,               /// < Request
+        ResponseSourceMapNodeKind               /// < Response
+    };
+
+    /** Field of a compact sourcemap node */
+    enum SourceMapField {
+        NodeSourceMapField = 0,         /// < The node itself
+        NameSourceMapField,             /// < Name
+        DescriptionSourceMapField,      /// < Description
+        URITemplateSourceMapField,      /// < URI template
+        MethodSourceMapField,           /// < HTTP method
+        BodySourceMapField,             /// < Payload body
+        SchemaSourceMapField,           /// < Payload schema
+        ReferenceSourceMapField,        /// < Payload symbol reference
+        TypeSourceMapField,             /// < Parameter type
+        UseSourceMapField,              /// < Parameter required flag
+        DefaultValueSourceMapField,     /// < Parameter default value
+        ExampleValueSourceMapField      /// < Parameter example value
+    };
+
+    /**
+     *  \brief Flat sourcemap table
+     *
+     *  Nodes are listed in the following pre-order:
+     *
+     *  - Blueprint, its Metadata, then Resource Groups
+     *  - Resource Group, then its Resources
+     *  - Resource, its Model, Parameters, Headers and Actions
+     *  - Parameter, then its Values
+     *  - Action, its Parameters, Headers and Transaction Examples
+     *  - Transaction Example, its Requests and Responses
+     *  - Request / Response / Model, its Parameters and Headers
+     */
+    struct CompactSourceMap {
+
+        /** Node identifier, index into the node table */
+        typedef unsigned int NodeId;
+
+        /** Range identifier, index into the range pool */
+        typedef unsigned int RangeId;
+
+        /** Node table, kinds of nodes */
+        std::vector<unsigned char> nodeKinds;
+
+        /** Node table, parent of a node (root is its own parent) */
+        std::vector<NodeId> nodeParents;
+
+        /** Node table, index of the first entry of a node */
+        std::vector<unsigned int> nodeEntries;
+
+        /** Entry table, owning node */
+        std::vector<NodeId> entryNodes;
+
+        /** Entry table, node field */
+        std::vector<unsigned char> entryFields;
+
+        /** Entry table, range */
+        std::vector<RangeId> entryRanges;
+
+        /** Range pool, range locations */
+        std::vector<size_t> rangeLocations;
+
+        /** Range pool, range lengths */
+        std::vector<size_t> rangeLengths;
+
+        /** \return Number of nodes */
+        size_t size() const { return nodeKinds.size(); }
+
+        /** \return True if there are no nodes */
+        bool empty() const { return nodeKinds.empty(); }
+
+        /** Release all the nodes, entries and ranges */
+        void clear();
+
+        /**
+         *  \brief  Retrieve source map of a node field
+         *  \param  node    A node to query
+         *  \param  field   A field of the node to query
+         *  \return Source map of the field, empty if not mapped
+         */
+        mdp::BytesRangeSet sourceMap(NodeId node, SourceMapField field) const;
+
+        /** \return Approximate number of bytes allocated by the table */
+        size_t memoryUsage() const;
+    };
+
+    /**
+     *  \brief  Build compact sourcemap from sourcemap AST
+     *  \param  sourceMap   A sourcemap to compact
+     *  \param  compact     Output compact sourcemap, cleared first
+     *
+     *  The sourcemap AST is only read, release it afterwards to keep the
+     *  compact sourcemap alone.
+     */
+    void BuildCompactSourceMap(const SourceMap<Blueprint>& sourceMap,
+                               CompactSourceMap& compact);
+
+    /**
+     *  \brief  Expand compact sourcemap into sourcemap AST
+     *  \param  compact     A compact sourcemap as built by BuildCompactSourceMap()
+     *  \param  sourceMap   Output sourcemap AST
+     *
+     *  Ranges of the expanded sourcemap are coalesced.
+     */
+    void ExpandCompactSourceMap(const CompactSourceMap& compact,
+                                SourceMap<Blueprint>& sourceMap);
+}
+
+#endif
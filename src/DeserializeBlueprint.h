@@ -0,0 +1,521 @@
+//
+//  DeserializeBlueprint.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_DESERIALIZEBLUEPRINT_H
+#define SNOWCRASH_DESERIALIZEBLUEPRINT_H
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include "BlueprintSourcemap.h"
+#include "Serialize.h"
+#include "SourceAnnotation.h"
+
+/**
+ *  API Blueprint AST Deserialization
+ *  ---------------------------------
+ *
+ *  Reads an AST or its source map from any serialization with the
+ *  structure of SerializeJSON(), driving a pull reader of the format.
+ *  A reader is any class with these members, dispatched at compile time:
+ *
+ *      void beginObject();
+ *      bool nextMember(std::string& key);  // false at the end of the object
+ *      void beginArray();
+ *      bool nextItem();                    // false at the end of the array
+ *      void readString(std::string& value);
+ *      bool readBoolean();
+ *      size_t readNumber();                // non-negative integer
+ *      void skipValue();
+ *      void finish();                      // verify there is no more input
+ *      size_t offset() const;              // offset of the current byte
+ *
+ *  A reader throws an `Error` on malformed input or an unexpected type.
+ */
+
+namespace snowcrash {
+
+    /**
+     *  \brief Deserialization of an AST or its source map driving a reader.
+     */
+    template<typename Reader>
+    class BlueprintDeserializer {
+    public:
+
+        /**
+         *  \brief  Read an AST or its source map, recording a read error in the report
+         *  \param  reader  A reader of the serialization
+         *  \param  out     Output blueprint or its source map, replaced
+         *  \param  report  Output report, error is set if the input can't be read
+         *  \param  text    Source text to express the error location in its characters,
+         *                  NULL for the location in bytes
+         *  \return Error code
+         */
+        template<typename T>
+        static int read(Reader& reader, T& out, Report& report, const mdp::ByteBuffer* text = NULL)
+        {
+            try {
+                out = T();
+                deserialize(reader, out);
+                reader.finish();
+            }
+            catch (const Error& e) {
+
+                size_t offset = reader.offset();
+
+                if (text) {
+                    mdp::BytesRangeSet rangeSet;
+                    rangeSet.push_back(mdp::BytesRange(offset, offset < text->size() ? 1 : 0));
+                    report.error = Error(e.message, e.code, mdp::BytesRangeSetToCharactersRangeSet(rangeSet, *text));
+                }
+                else {
+                    mdp::CharactersRangeSet location;
+                    location.push_back(mdp::CharactersRange(offset, 1));
+                    report.error = Error(e.message, e.code, location);
+                }
+            }
+            catch (const std::exception& e) {
+
+                std::stringstream ss;
+                ss << "deserialization exception: '" << e.what() << "'";
+                report.error = Error(ss.str(), ApplicationError);
+            }
+
+            return report.error.code;
+        }
+
+    private:
+
+        /**
+         *  \brief Deserialize an array into a collection.
+         *  \param reader       A reader to read from
+         *  \param collection   Output collection, replaced
+         */
+        template<typename T>
+        static void deserializeCollection(Reader& reader, std::vector<T>& collection)
+        {
+            collection.clear();
+            reader.beginArray();
+
+            while (reader.nextItem()) {
+                collection.push_back(T());
+                deserialize(reader, collection.back());
+            }
+        }
+
+        /** Read the next item of an array which has to be there */
+        static void expectItem(Reader& reader, const char* message)
+        {
+            if (!reader.nextItem())
+                throw Error(message, BusinessError);
+        }
+
+        static void deserialize(Reader& reader, KeyValuePair& keyValue)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    reader.readString(keyValue.first);
+                else if (key == SerializeKey::Value)
+                    reader.readString(keyValue.second);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserializeValues(Reader& reader, Values& values)
+        {
+            std::string key;
+
+            values.clear();
+            reader.beginArray();
+
+            while (reader.nextItem()) {
+
+                values.push_back(Value());
+                reader.beginObject();
+
+                while (reader.nextMember(key)) {
+
+                    if (key == SerializeKey::Value)
+                        reader.readString(values.back());
+                    else
+                        reader.skipValue();
+                }
+            }
+        }
+
+        static void deserialize(Reader& reader, Parameter& parameter)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    reader.readString(parameter.name);
+                else if (key == SerializeKey::Description)
+                    reader.readString(parameter.description);
+                else if (key == SerializeKey::Type)
+                    reader.readString(parameter.type);
+                else if (key == SerializeKey::Required)
+                    parameter.use = reader.readBoolean() ? RequiredParameterUse : OptionalParameterUse;
+                else if (key == SerializeKey::Default)
+                    reader.readString(parameter.defaultValue);
+                else if (key == SerializeKey::Example)
+                    reader.readString(parameter.exampleValue);
+                else if (key == SerializeKey::Values)
+                    deserializeValues(reader, parameter.values);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, Reference& reference)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Id)
+                    reader.readString(reference.id);
+                else
+                    reader.skipValue();
+            }
+
+            // The serialized payload already carries the referenced content
+            reference.type = Reference::SymbolReference;
+            reference.meta.state = Reference::StateResolved;
+        }
+
+        static void deserialize(Reader& reader, Payload& payload)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    reader.readString(payload.name);
+                else if (key == SerializeKey::Reference)
+                    deserialize(reader, payload.reference);
+                else if (key == SerializeKey::Description)
+                    reader.readString(payload.description);
+                else if (key == SerializeKey::Headers)
+                    deserializeCollection(reader, payload.headers);
+                else if (key == SerializeKey::Body)
+                    reader.readString(payload.body);
+                else if (key == SerializeKey::Schema)
+                    reader.readString(payload.schema);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, TransactionExample& example)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    reader.readString(example.name);
+                else if (key == SerializeKey::Description)
+                    reader.readString(example.description);
+                else if (key == SerializeKey::Requests)
+                    deserializeCollection(reader, example.requests);
+                else if (key == SerializeKey::Responses)
+                    deserializeCollection(reader, example.responses);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, Action& action)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    reader.readString(action.name);
+                else if (key == SerializeKey::Description)
+                    reader.readString(action.description);
+                else if (key == SerializeKey::Method)
+                    reader.readString(action.method);
+                else if (key == SerializeKey::Parameters)
+                    deserializeCollection(reader, action.parameters);
+                else if (key == SerializeKey::Examples)
+                    deserializeCollection(reader, action.examples);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, Resource& resource)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    reader.readString(resource.name);
+                else if (key == SerializeKey::Description)
+                    reader.readString(resource.description);
+                else if (key == SerializeKey::URITemplate)
+                    reader.readString(resource.uriTemplate);
+                else if (key == SerializeKey::Model)
+                    deserialize(reader, resource.model);
+                else if (key == SerializeKey::Parameters)
+                    deserializeCollection(reader, resource.parameters);
+                else if (key == SerializeKey::Actions)
+                    deserializeCollection(reader, resource.actions);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, ResourceGroup& resourceGroup)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    reader.readString(resourceGroup.name);
+                else if (key == SerializeKey::Description)
+                    reader.readString(resourceGroup.description);
+                else if (key == SerializeKey::Resources)
+                    deserializeCollection(reader, resourceGroup.resources);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, Blueprint& blueprint)
+        {
+            std::string key;
+            std::string version;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::ASTVersion) {
+                    reader.readString(version);
+
+                    if (version != AST_SERIALIZATION_VERSION) {
+                        std::stringstream ss;
+                        ss << "unsupported AST serialization version '" << version << "', expected '" << AST_SERIALIZATION_VERSION << "'";
+                        throw Error(ss.str(), BusinessError);
+                    }
+                }
+                else if (key == SerializeKey::Metadata)
+                    deserializeCollection(reader, blueprint.metadata);
+                else if (key == SerializeKey::Name)
+                    reader.readString(blueprint.name);
+                else if (key == SerializeKey::Description)
+                    reader.readString(blueprint.description);
+                else if (key == SerializeKey::ResourceGroups)
+                    deserializeCollection(reader, blueprint.resourceGroups);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        /**
+         *  \brief Deserialize a set of source map ranges.
+         *
+         *  Ranges are serialized as arrays of [location, length] arrays.
+         */
+        static void deserialize(Reader& reader, SourceMapBase& sourceMap)
+        {
+            sourceMap.sourceMap.clear();
+            reader.beginArray();
+
+            while (reader.nextItem()) {
+
+                reader.beginArray();
+
+                expectItem(reader, "expected source map range location");
+                size_t location = reader.readNumber();
+
+                expectItem(reader, "expected source map range length");
+                size_t length = reader.readNumber();
+
+                if (reader.nextItem())
+                    throw Error("expected end of source map range", BusinessError);
+
+                sourceMap.sourceMap.push_back(mdp::BytesRange(location, length));
+            }
+        }
+
+        static void deserialize(Reader& reader, SourceMap<Parameter>& parameter)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    deserialize(reader, parameter.name);
+                else if (key == SerializeKey::Description)
+                    deserialize(reader, parameter.description);
+                else if (key == SerializeKey::Type)
+                    deserialize(reader, parameter.type);
+                else if (key == SerializeKey::Required)
+                    deserialize(reader, parameter.use);
+                else if (key == SerializeKey::Default)
+                    deserialize(reader, parameter.defaultValue);
+                else if (key == SerializeKey::Example)
+                    deserialize(reader, parameter.exampleValue);
+                else if (key == SerializeKey::Values)
+                    deserializeCollection(reader, parameter.values.collection);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, SourceMap<Payload>& payload)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    deserialize(reader, payload.name);
+                else if (key == SerializeKey::Reference)
+                    deserialize(reader, payload.reference);
+                else if (key == SerializeKey::Description)
+                    deserialize(reader, payload.description);
+                else if (key == SerializeKey::Headers)
+                    deserializeCollection(reader, payload.headers.collection);
+                else if (key == SerializeKey::Body)
+                    deserialize(reader, payload.body);
+                else if (key == SerializeKey::Schema)
+                    deserialize(reader, payload.schema);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, SourceMap<TransactionExample>& example)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    deserialize(reader, example.name);
+                else if (key == SerializeKey::Description)
+                    deserialize(reader, example.description);
+                else if (key == SerializeKey::Requests)
+                    deserializeCollection(reader, example.requests.collection);
+                else if (key == SerializeKey::Responses)
+                    deserializeCollection(reader, example.responses.collection);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, SourceMap<Action>& action)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    deserialize(reader, action.name);
+                else if (key == SerializeKey::Description)
+                    deserialize(reader, action.description);
+                else if (key == SerializeKey::Method)
+                    deserialize(reader, action.method);
+                else if (key == SerializeKey::Parameters)
+                    deserializeCollection(reader, action.parameters.collection);
+                else if (key == SerializeKey::Examples)
+                    deserializeCollection(reader, action.examples.collection);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, SourceMap<Resource>& resource)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    deserialize(reader, resource.name);
+                else if (key == SerializeKey::Description)
+                    deserialize(reader, resource.description);
+                else if (key == SerializeKey::URITemplate)
+                    deserialize(reader, resource.uriTemplate);
+                else if (key == SerializeKey::Model)
+                    deserialize(reader, resource.model);
+                else if (key == SerializeKey::Parameters)
+                    deserializeCollection(reader, resource.parameters.collection);
+                else if (key == SerializeKey::Actions)
+                    deserializeCollection(reader, resource.actions.collection);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, SourceMap<ResourceGroup>& resourceGroup)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Name)
+                    deserialize(reader, resourceGroup.name);
+                else if (key == SerializeKey::Description)
+                    deserialize(reader, resourceGroup.description);
+                else if (key == SerializeKey::Resources)
+                    deserializeCollection(reader, resourceGroup.resources.collection);
+                else
+                    reader.skipValue();
+            }
+        }
+
+        static void deserialize(Reader& reader, SourceMap<Blueprint>& blueprint)
+        {
+            std::string key;
+            reader.beginObject();
+
+            while (reader.nextMember(key)) {
+
+                if (key == SerializeKey::Metadata)
+                    deserializeCollection(reader, blueprint.metadata.collection);
+                else if (key == SerializeKey::Name)
+                    deserialize(reader, blueprint.name);
+                else if (key == SerializeKey::Description)
+                    deserialize(reader, blueprint.description);
+                else if (key == SerializeKey::ResourceGroups)
+                    deserializeCollection(reader, blueprint.resourceGroups.collection);
+                else
+                    reader.skipValue();
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,29 @@
+//
+//  DeserializeJSON.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "DeserializeJSON.h"
+#include "DeserializeBlueprint.h"
+#include "JSONReader.h"
+
+using namespace snowcrash;
+
+int snowcrash::DeserializeJSON(const mdp::ByteBuffer& source,
+                               Blueprint& blueprint,
+                               Report& report)
+{
+    JSONReader reader(source.data(), source.size());
+    return BlueprintDeserializer<JSONReader>::read(reader, blueprint, report, &source);
+}
+
+int snowcrash::DeserializeSourceMapJSON(const mdp::ByteBuffer& source,
+                                        SourceMap<Blueprint>& sourceMap,
+                                        Report& report)
+{
+    JSONReader reader(source.data(), source.size());
+    return BlueprintDeserializer<JSONReader>::read(reader, sourceMap, report, &source);
+}
@@ -0,0 +1,44 @@
+//
+//  DeserializeJSON.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_DESERIALIZE_JSON_H
+#define SNOWCRASH_DESERIALIZE_JSON_H
+
+#include "BlueprintSourcemap.h"
+#include "SourceAnnotation.h"
+
+namespace snowcrash {
+
+    /**
+     *  \brief  Deserialize API Blueprint AST from its JSON serialization
+     *  \param  source      JSON as produced by SerializeJSON()
+     *  \param  blueprint   Output blueprint AST
+     *  \param  report      Output report, error is set if the source can't be read
+     *  \return Error code
+     *
+     *  Only the AST serialization version AST_SERIALIZATION_VERSION is accepted.
+     *  Parameter use is restored from the "required" flag, hence undefined
+     *  parameter use is read back as required. Unknown keys are skipped.
+     */
+    int DeserializeJSON(const mdp::ByteBuffer& source,
+                        Blueprint& blueprint,
+                        Report& report);
+
+    /**
+     *  \brief  Deserialize source map of API Blueprint AST from its JSON serialization
+     *  \param  source      JSON as produced by SerializeSourceMapJSON()
+     *  \param  sourceMap   Output source map
+     *  \param  report      Output report, error is set if the source can't be read
+     *  \return Error code
+     */
+    int DeserializeSourceMapJSON(const mdp::ByteBuffer& source,
+                                 SourceMap<Blueprint>& sourceMap,
+                                 Report& report);
+}
+
+#endif
@@ -0,0 +1,31 @@
+//
+//  Directory.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_DIRECTORY_H
+#define SNOWCRASH_DIRECTORY_H
+
+#include <string>
+#include <vector>
+
+namespace snowcrash {
+
+    /** \return True if the path names a directory */
+    bool IsDirectory(const std::string& path);
+
+    /**
+     *  \brief  List files of a directory and its subdirectories
+     *  \param  path    A path of the directory
+     *  \param  files   Output paths of the files, appended in no particular order
+     *  \return True on success
+     *
+     *  Hidden entries and symbolic links to directories are skipped.
+     */
+    bool ListDirectory(const std::string& path, std::vector<std::string>& files);
+}
+
+#endif
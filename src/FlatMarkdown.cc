@@ -0,0 +1,157 @@
+//
+//  FlatMarkdown.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include "FlatMarkdown.h"
+
+using namespace snowcrash;
+
+/** Orders the collections of siblings by their address */
+static bool SiblingsLess(const std::pair<const mdp::MarkdownNodes*, size_t>& lhs,
+                         const std::pair<const mdp::MarkdownNodes*, size_t>& rhs)
+{
+    return std::less<const mdp::MarkdownNodes*>()(lhs.first, rhs.first);
+}
+
+/** \return Source bytes spanned by a source map */
+static mdp::BytesRange SourceMapHull(const mdp::BytesRangeSet& sourceMap)
+{
+    if (sourceMap.empty())
+        return mdp::BytesRange();
+
+    size_t begin = sourceMap.front().location;
+    size_t end = begin;
+
+    for (mdp::BytesRangeSet::const_iterator it = sourceMap.begin(); it != sourceMap.end(); ++it) {
+        begin = std::min(begin, it->location);
+        end = std::max(end, it->location + it->length);
+    }
+
+    return mdp::BytesRange(begin, end - begin);
+}
+
+void FlatMarkdown::build(mdp::MarkdownNode& root)
+{
+    nodes.clear();
+    text.clear();
+    childTable.clear();
+    siblingsParents.clear();
+
+    append(root, NoFlatNode, 0);
+
+    // Unvisited children of the nodes on the path from the root, depth first
+    std::vector<std::pair<size_t, size_t> > stack(1, std::make_pair(0, 0));
+
+    while (!stack.empty()) {
+
+        size_t parent = stack.back().first;
+        size_t position = stack.back().second;
+        mdp::MarkdownNodes& siblings = nodes[parent].node->children();
+
+        if (position == siblings.size()) {
+            stack.pop_back();
+            continue;
+        }
+
+        ++stack.back().second;
+
+        size_t index = append(siblings[position], parent, position);
+
+        if (!siblings[position].children().empty())
+            stack.push_back(std::make_pair(index, 0));
+    }
+
+    std::sort(siblingsParents.begin(), siblingsParents.end(), SiblingsLess);
+}
+
+size_t FlatMarkdown::append(mdp::MarkdownNode& node, size_t parent, size_t position)
+{
+    FlatMarkdownNode flatNode;
+
+    flatNode.type = node.type;
+    flatNode.textBegin = text.length();
+    flatNode.textLength = node.text.length();
+    flatNode.range = SourceMapHull(node.sourceMap);
+    flatNode.parent = parent;
+    flatNode.firstChild = NoFlatNode;
+    flatNode.nextSibling = NoFlatNode;
+    flatNode.position = position;
+    flatNode.childrenBegin = childTable.size();
+    flatNode.node = &node;
+
+    size_t index = nodes.size();
+
+    nodes.push_back(flatNode);
+    text.append(node.text);
+    childTable.resize(childTable.size() + node.children().size(), NoFlatNode);
+
+    // The root is looked up even with no children, e.g. for an empty blueprint
+    if (!node.children().empty() || parent == NoFlatNode)
+        siblingsParents.push_back(std::make_pair(&node.children(), index));
+
+    if (parent == NoFlatNode)
+        return index;
+
+    childTable[nodes[parent].childrenBegin + position] = index;
+
+    if (position == 0)
+        nodes[parent].firstChild = index;
+    else
+        nodes[childTable[nodes[parent].childrenBegin + position - 1]].nextSibling = index;
+
+    return index;
+}
+
+size_t FlatMarkdown::parentOf(const mdp::MarkdownNodes& siblings) const
+{
+    SiblingsParent key(&siblings, 0);
+    std::vector<SiblingsParent>::const_iterator it = std::lower_bound(siblingsParents.begin(),
+                                                                      siblingsParents.end(),
+                                                                      key,
+                                                                      SiblingsLess);
+
+    if (it == siblingsParents.end() || it->first != &siblings)
+        throw std::logic_error("markdown nodes out of the flattened markdown");
+
+    return it->second;
+}
+
+size_t FlatMarkdown::indexOf(size_t parent, const mdp::MarkdownNodeIterator& child) const
+{
+    mdp::MarkdownNodes& siblings = children(parent);
+
+    if (child == siblings.end())
+        return NoFlatNode;
+
+    return childTable[nodes[parent].childrenBegin + (child - siblings.begin())];
+}
+
+mdp::MarkdownNodeIterator FlatMarkdown::iterator(size_t parent, size_t child) const
+{
+    mdp::MarkdownNodes& siblings = children(parent);
+
+    if (child == NoFlatNode)
+        return siblings.end();
+
+    return siblings.begin() + nodes[child].position;
+}
+
+mdp::MarkdownNodes& FlatMarkdown::children(size_t parent) const
+{
+    return nodes[parent].node->children();
+}
+
+void FlatMarkdown::swap(FlatMarkdown& other)
+{
+    nodes.swap(other.nodes);
+    text.swap(other.text);
+    childTable.swap(other.childTable);
+    siblingsParents.swap(other.siblingsParents);
+}
@@ -0,0 +1,91 @@
+//
+//  FlatMarkdown.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_FLATMARKDOWN_H
+#define SNOWCRASH_FLATMARKDOWN_H
+
+#include <utility>
+#include <vector>
+#include "MarkdownNode.h"
+
+namespace snowcrash {
+
+    /** Index of no node, e.g. past the last of the siblings */
+    static const size_t NoFlatNode = static_cast<size_t>(-1);
+
+    /**
+     *  \brief Node of a flattened Markdown AST
+     *
+     *  Nodes refer to each other by their indexes in FlatMarkdown::nodes.
+     */
+    struct FlatMarkdownNode {
+        mdp::MarkdownNodeType type;     /// Type of the node
+        size_t textBegin;               /// Offset of the text of the node in FlatMarkdown::text
+        size_t textLength;              /// Length of the text of the node
+        mdp::BytesRange range;          /// Source bytes spanned by the node
+        size_t parent;                  /// Parent node, NoFlatNode for the root
+        size_t firstChild;              /// First child, NoFlatNode if none
+        size_t nextSibling;             /// Next sibling, NoFlatNode for the last one
+        size_t position;                /// Position among the siblings
+        size_t childrenBegin;           /// Offset of the children in the child table
+        mdp::MarkdownNode* node;        /// Node of the Markdown AST
+    };
+
+    /**
+     *  \brief Markdown AST flattened in pre-order
+     *
+     *  Built once the Markdown is parsed, section parsers walk the nodes by
+     *  their indexes and convert them to MarkdownNodeIterator only to call
+     *  the section processors. The flattened AST refers to the nodes of the
+     *  Markdown AST, it is valid until the Markdown AST is changed.
+     */
+    class FlatMarkdown {
+    public:
+
+        /** Nodes in pre-order, the root first */
+        std::vector<FlatMarkdownNode> nodes;
+
+        /** Text of the nodes in pre-order */
+        mdp::ByteBuffer text;
+
+        /** Flatten a Markdown AST, the capacity of the previous one is kept */
+        void build(mdp::MarkdownNode& root);
+
+        /**
+         *  \brief  Find the node of a collection of siblings
+         *  \param  siblings    Children of a node of the Markdown AST
+         *  \return Index of the node whose children are the siblings
+         */
+        size_t parentOf(const mdp::MarkdownNodes& siblings) const;
+
+        /** \return Index of a child of the parent, NoFlatNode for the end of the children */
+        size_t indexOf(size_t parent, const mdp::MarkdownNodeIterator& child) const;
+
+        /** \return Iterator of a child of the parent, the end of the children for NoFlatNode */
+        mdp::MarkdownNodeIterator iterator(size_t parent, size_t child) const;
+
+        /** \return Children of a node in the Markdown AST */
+        mdp::MarkdownNodes& children(size_t parent) const;
+
+        /** Swap the content with other flattened AST */
+        void swap(FlatMarkdown& other);
+
+    private:
+        /** Indexes of the children of each node, see FlatMarkdownNode::childrenBegin */
+        std::vector<size_t> childTable;
+
+        /** Collections of siblings and the index of their parent, sorted by the collection */
+        typedef std::pair<const mdp::MarkdownNodes*, size_t> SiblingsParent;
+        std::vector<SiblingsParent> siblingsParents;
+
+        /** Append a node and \return its index */
+        size_t append(mdp::MarkdownNode& node, size_t parent, size_t position);
+    };
+}
+
+#endif
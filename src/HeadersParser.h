@@ -26,8 +26,8 @@ namespace snowcrash {
     /**
      *  Headers Section Processor
      */
-    template<>
-    struct SectionProcessor<Headers> : public SectionProcessorBase<Headers> {
+    template<typename Policy>
+    struct SectionProcessor<Headers, Policy> : public SectionProcessorBase<Headers, Policy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -98,7 +98,8 @@ namespace snowcrash {
                              SectionParserData& pd,
                              const ParseResultRef<Headers>& out) {
 
-            if (out.node.empty()) {
+            if (out.node.empty() &&
+                pd.reportsWarning(out.report, FormattingWarning)) {
 
                 // WARN: No headers defined
                 mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
@@ -127,7 +128,10 @@ namespace snowcrash {
                 Header header;
 
                 if (CodeBlockUtility::keyValueFromLine(*line, header)) {
-                    if (findHeader(out.node, header) != out.node.end() && !isAllowedMultipleDefinition(header)) {
+                    if (pd.reportsWarning(out.report, DuplicateWarning) &&
+                        findHeader(out.node, header) != out.node.end() &&
+                        !isAllowedMultipleDefinition(header)) {
+
                         // WARN: duplicate header on this level
                         std::stringstream ss;
 
@@ -141,12 +145,12 @@ namespace snowcrash {
 
                     out.node.push_back(header);
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         SourceMap<Header> headerSM;
                         headerSM.sourceMap = node->sourceMap;
                         out.sourceMap.collection.push_back(headerSM);
                     }
-                } else {
+                } else if (pd.reportsWarning(out.report, FormattingWarning)) {
                     // WARN: unable to parse header
                     mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
                     out.report.warnings.push_back(Warning("unable to parse HTTP header, expected '<header name> : <header value>', one header per line",
@@ -166,7 +170,7 @@ namespace snowcrash {
             Collection<TransactionExample>::iterator exampleIt = examples.begin();
             Collection<SourceMap<TransactionExample> >::iterator exampleSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 exampleSourceMapIt = examplesSM.collection.begin();
             }
 
@@ -175,7 +179,7 @@ namespace snowcrash {
                 Collection<Request>::iterator requestIt = exampleIt->requests.begin();
                 Collection<SourceMap<Request> >::iterator requestSourceMapIt;
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     requestSourceMapIt = exampleSourceMapIt->requests.collection.begin();
                 }
 
@@ -185,7 +189,7 @@ namespace snowcrash {
                      requestIt->headers.insert(requestIt->headers.begin(), headers.begin(), headers.end());
                      ++requestIt;
 
-                     if (pd.exportSourceMap()) {
+                     if (Policy::exportSourceMap(pd)) {
                          requestSourceMapIt->headers.collection.insert(requestSourceMapIt->headers.collection.begin(),
                                                                        headersSM.collection.begin(),
                                                                        headersSM.collection.end());
@@ -196,7 +200,7 @@ namespace snowcrash {
                 Collection<Response>::iterator responseIt = exampleIt->responses.begin();
                 Collection<SourceMap<Response> >::iterator responseSourceMapIt;
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     responseSourceMapIt = exampleSourceMapIt->responses.collection.begin();
                 }
 
@@ -206,7 +210,7 @@ namespace snowcrash {
                     responseIt->headers.insert(responseIt->headers.begin(), headers.begin(), headers.end());
                     ++responseIt;
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         responseSourceMapIt->headers.collection.insert(responseSourceMapIt->headers.collection.begin(),
                                                                        headersSM.collection.begin(),
                                                                        headersSM.collection.end());
@@ -216,7 +220,7 @@ namespace snowcrash {
 
                 ++exampleIt;
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     ++exampleSourceMapIt;
                 }
             }
@@ -0,0 +1,431 @@
+//
+//  JSONReader.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstring>
+#include "JSONReader.h"
+#include "SourceAnnotation.h"
+
+using namespace snowcrash;
+
+/** Maximum nesting of arrays and objects */
+static const size_t MaxNestingDepth = 512;
+
+static bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/** \return Value of a hexadecimal digit, -1 if not a digit */
+static int HexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+
+    return -1;
+}
+
+/** Append code point encoded in UTF-8 */
+static void AppendUTF8(unsigned long codePoint, std::string& value)
+{
+    if (codePoint < 0x80) {
+        value += static_cast<char>(codePoint);
+    }
+    else if (codePoint < 0x800) {
+        value += static_cast<char>(0xC0 | (codePoint >> 6));
+        value += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000) {
+        value += static_cast<char>(0xE0 | (codePoint >> 12));
+        value += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        value += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else {
+        value += static_cast<char>(0xF0 | (codePoint >> 18));
+        value += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        value += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        value += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+JSONReader::JSONReader(const char* data, size_t size)
+: begin(data), end(data + size), p(data)
+{
+}
+
+void JSONReader::fail(const std::string& message)
+{
+    throw Error(message, BusinessError);
+}
+
+void JSONReader::skipWhitespace()
+{
+    while (p != end && (*p == ' ' || *p == '\n' || *p == '\t' || *p == '\r'))
+        ++p;
+}
+
+void JSONReader::expect(char c)
+{
+    skipWhitespace();
+
+    if (p == end || *p != c) {
+        std::string message = "expected '";
+        message += c;
+        message += "'";
+        fail(message);
+    }
+
+    ++p;
+}
+
+JSONReader::ValueType JSONReader::peek()
+{
+    skipWhitespace();
+
+    if (p == end)
+        return UndefinedValueType;
+
+    switch (*p) {
+        case 'n':
+            return NullValueType;
+
+        case 't':
+        case 'f':
+            return BooleanValueType;
+
+        case '"':
+            return StringValueType;
+
+        case '[':
+            return ArrayValueType;
+
+        case '{':
+            return ObjectValueType;
+
+        default:
+            if (*p == '-' || IsDigit(*p))
+                return NumberValueType;
+
+            return UndefinedValueType;
+    }
+}
+
+void JSONReader::beginContainer(char c)
+{
+    if (containers.size() == MaxNestingDepth)
+        fail("maximum nesting depth exceeded");
+
+    expect(c);
+    containers.push_back(false);
+}
+
+bool JSONReader::nextInContainer(char close)
+{
+    skipWhitespace();
+
+    if (p != end && *p == close) {
+        ++p;
+        containers.pop_back();
+        return false;
+    }
+
+    if (containers.back())
+        expect(',');
+
+    containers.back() = true;
+    return true;
+}
+
+void JSONReader::beginObject()
+{
+    beginContainer('{');
+}
+
+bool JSONReader::nextMember(std::string& key)
+{
+    if (!nextInContainer('}'))
+        return false;
+
+    readString(key);
+    expect(':');
+
+    return true;
+}
+
+void JSONReader::beginArray()
+{
+    beginContainer('[');
+}
+
+bool JSONReader::nextItem()
+{
+    return nextInContainer(']');
+}
+
+void JSONReader::readString(std::string& value)
+{
+    expect('"');
+    value.clear();
+
+    for (;;) {
+
+        const char* chunk = p;
+
+        while (p != end && *p != '"' && *p != '\\' && static_cast<unsigned char>(*p) >= 0x20)
+            ++p;
+
+        value.append(chunk, p - chunk);
+
+        if (p == end)
+            fail("unterminated string");
+
+        if (*p == '"') {
+            ++p;
+            return;
+        }
+
+        if (*p != '\\')
+            fail("unescaped control character in string");
+
+        readEscape(value);
+    }
+}
+
+void JSONReader::readEscape(std::string& value)
+{
+    // Skip the backslash
+    ++p;
+
+    if (p == end)
+        fail("unterminated string");
+
+    char c = *p++;
+
+    switch (c) {
+        case '"':
+        case '\\':
+        case '/':
+            value += c;
+            return;
+
+        case 'b':
+            value += '\b';
+            return;
+
+        case 'f':
+            value += '\f';
+            return;
+
+        case 'n':
+            value += '\n';
+            return;
+
+        case 'r':
+            value += '\r';
+            return;
+
+        case 't':
+            value += '\t';
+            return;
+
+        case 'u':
+            break;
+
+        default:
+            --p;
+            fail("invalid escape sequence");
+    }
+
+    unsigned long codePoint = 0;
+
+    for (int surrogate = 0; surrogate < 2; ++surrogate) {
+
+        unsigned long unit = 0;
+
+        for (int i = 0; i < 4; ++i, ++p) {
+
+            int digit = (p != end) ? HexValue(*p) : -1;
+
+            if (digit < 0)
+                fail("invalid unicode escape sequence");
+
+            unit = (unit << 4) | digit;
+        }
+
+        if (surrogate == 0) {
+
+            codePoint = unit;
+
+            if (unit < 0xD800 || unit > 0xDFFF)
+                break;
+
+            if (unit > 0xDBFF || end - p < 2 || p[0] != '\\' || p[1] != 'u')
+                fail("invalid unicode surrogate pair");
+
+            p += 2;
+        }
+        else {
+
+            if (unit < 0xDC00 || unit > 0xDFFF)
+                fail("invalid unicode surrogate pair");
+
+            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (unit - 0xDC00);
+        }
+    }
+
+    AppendUTF8(codePoint, value);
+}
+
+void JSONReader::readLiteral(const char* literal)
+{
+    skipWhitespace();
+
+    size_t length = ::strlen(literal);
+
+    if (static_cast<size_t>(end - p) < length || ::memcmp(p, literal, length) != 0) {
+        std::string message = "expected '";
+        message += literal;
+        message += "'";
+        fail(message);
+    }
+
+    p += length;
+}
+
+bool JSONReader::readBoolean()
+{
+    if (peek() == BooleanValueType && *p == 't') {
+        readLiteral("true");
+        return true;
+    }
+
+    readLiteral("false");
+    return false;
+}
+
+size_t JSONReader::readNumber()
+{
+    skipWhitespace();
+
+    if (p == end || !IsDigit(*p))
+        fail("expected non-negative integer");
+
+    size_t value = 0;
+
+    for (; p != end && IsDigit(*p); ++p) {
+
+        size_t next = value * 10 + (*p - '0');
+
+        if (next / 10 != value)
+            fail("integer overflow");
+
+        value = next;
+    }
+
+    if (p != end && (*p == '.' || *p == 'e' || *p == 'E'))
+        fail("expected non-negative integer");
+
+    return value;
+}
+
+void JSONReader::skipNumber()
+{
+    skipWhitespace();
+
+    if (p != end && *p == '-')
+        ++p;
+
+    if (p == end || !IsDigit(*p))
+        fail("invalid number");
+
+    while (p != end && IsDigit(*p))
+        ++p;
+
+    if (p != end && *p == '.') {
+        ++p;
+
+        if (p == end || !IsDigit(*p))
+            fail("invalid number");
+
+        while (p != end && IsDigit(*p))
+            ++p;
+    }
+
+    if (p != end && (*p == 'e' || *p == 'E')) {
+        ++p;
+
+        if (p != end && (*p == '+' || *p == '-'))
+            ++p;
+
+        if (p == end || !IsDigit(*p))
+            fail("invalid number");
+
+        while (p != end && IsDigit(*p))
+            ++p;
+    }
+}
+
+void JSONReader::skipValue()
+{
+    switch (peek()) {
+        case NullValueType:
+            readLiteral("null");
+            break;
+
+        case BooleanValueType:
+            readBoolean();
+            break;
+
+        case NumberValueType:
+            skipNumber();
+            break;
+
+        case StringValueType:
+        {
+            // Read to verify escape sequences
+            std::string value;
+            readString(value);
+            break;
+        }
+
+        case ArrayValueType:
+            beginArray();
+
+            while (nextItem())
+                skipValue();
+
+            break;
+
+        case ObjectValueType:
+        {
+            std::string key;
+            beginObject();
+
+            while (nextMember(key))
+                skipValue();
+
+            break;
+        }
+
+        default:
+            fail("expected value");
+    }
+}
+
+void JSONReader::finish()
+{
+    skipWhitespace();
+
+    if (p != end)
+        fail("unexpected data after JSON value");
+}
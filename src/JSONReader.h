@@ -0,0 +1,98 @@
+//
+//  JSONReader.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_JSONREADER_H
+#define SNOWCRASH_JSONREADER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace snowcrash {
+
+    /**
+     *  \brief Pull JSON reader.
+     *
+     *  Reads JSON text in place, value by value, as driven by the caller.
+     *  Nothing is allocated except the strings read and the nesting stack.
+     *  Malformed input throws an `Error`, offset() then points at the
+     *  offending byte.
+     */
+    class JSONReader {
+    public:
+
+        /** Type of a JSON value */
+        enum ValueType {
+            UndefinedValueType = 0, /// < End of the input or malformed value
+            NullValueType,          /// < null
+            BooleanValueType,       /// < true or false
+            NumberValueType,        /// < Number
+            StringValueType,        /// < String
+            ArrayValueType,         /// < Array
+            ObjectValueType         /// < Object
+        };
+
+        JSONReader(const char* data, size_t size);
+
+        /** \return Type of the next value */
+        ValueType peek();
+
+        /** Read the opening brace of an object */
+        void beginObject();
+
+        /**
+         *  \brief  Read the key of the next object member
+         *  \param  key     Output key of the member
+         *  \return False if the closing brace of the object has been read instead
+         */
+        bool nextMember(std::string& key);
+
+        /** Read the opening bracket of an array */
+        void beginArray();
+
+        /** \return False if the closing bracket of the array has been read instead of a next item */
+        bool nextItem();
+
+        /** Read a string value, the value is replaced */
+        void readString(std::string& value);
+
+        /** Read a boolean value */
+        bool readBoolean();
+
+        /** Read a non-negative integer value */
+        size_t readNumber();
+
+        /** Skip a value of any type */
+        void skipValue();
+
+        /** Verify only whitespace is left in the input */
+        void finish();
+
+        /** \return Offset of the current byte of the input */
+        size_t offset() const { return p - begin; }
+
+    private:
+        const char* begin;
+        const char* end;
+        const char* p;
+
+        /** Opened containers, true if a member or item has been read */
+        std::vector<bool> containers;
+
+        void skipWhitespace();
+        void expect(char c);
+        void beginContainer(char c);
+        bool nextInContainer(char close);
+        void readLiteral(const char* literal);
+        void skipNumber();
+        void readEscape(std::string& value);
+        void fail(const std::string& message);
+    };
+}
+
+#endif
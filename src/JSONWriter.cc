@@ -0,0 +1,134 @@
+//
+//  JSONWriter.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstring>
+#include "JSONWriter.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace snowcrash;
+
+/**
+ *  Escape sequence character for every byte, 0 if the byte is written as is,
+ *  'u' if it is written as an `\u00XX` sequence.
+ */
+static const char EscapeTable[256] = {
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'b', 't', 'n', 'u', 'f', 'r', 'u', 'u',
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+    0,   0,   '"', 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   '\\',0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const char HexDigits[] = "0123456789abcdef";
+
+/**
+ *  \brief  Find the first character to be escaped.
+ *  \return Pointer to the character or `end` if there is none.
+ */
+static const char* FindEscape(const char* begin, const char* end)
+{
+    const char* p = begin;
+
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control = _mm_set1_epi8(0x1F);
+
+    for (; end - p >= 16; p += 16) {
+
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+        // max(c, 0x1F) == 0x1F for every c <= 0x1F
+        __m128i mask = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                                 _mm_cmpeq_epi8(chunk, backslash)),
+                                    _mm_cmpeq_epi8(_mm_max_epu8(chunk, control), control));
+
+        if (_mm_movemask_epi8(mask) != 0)
+            break;
+    }
+#endif
+
+    for (; p != end; ++p) {
+        if (EscapeTable[static_cast<unsigned char>(*p)])
+            return p;
+    }
+
+    return end;
+}
+
+JSONWriter::JSONWriter(std::ostream& stream, bool compactOutput)
+: BufferedWriter(stream), compact(compactOutput)
+{
+}
+
+JSONWriter& JSONWriter::operator<<(const char* value)
+{
+    write(value, ::strlen(value));
+    return *this;
+}
+
+JSONWriter& JSONWriter::operator<<(const std::string& value)
+{
+    write(value.data(), value.size());
+    return *this;
+}
+
+void JSONWriter::indent(size_t level)
+{
+    if (!compact)
+        writeIndent(level);
+}
+
+void JSONWriter::string(const std::string& value)
+{
+    put('"');
+
+    const char* p = value.data();
+    const char* end = p + value.size();
+
+    while (p != end) {
+
+        const char* escape = FindEscape(p, end);
+        write(p, escape - p);
+
+        if (escape == end)
+            break;
+
+        unsigned char c = static_cast<unsigned char>(*escape);
+        char sequence = EscapeTable[c];
+
+        put('\\');
+
+        if (sequence == 'u') {
+            write("u00", 3);
+            put(HexDigits[c >> 4]);
+            put(HexDigits[c & 0xF]);
+        }
+        else {
+            put(sequence);
+        }
+
+        p = escape + 1;
+    }
+
+    put('"');
+}
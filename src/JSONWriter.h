@@ -0,0 +1,74 @@
+//
+//  JSONWriter.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_JSONWRITER_H
+#define SNOWCRASH_JSONWRITER_H
+
+#include <string>
+#include "BufferedWriter.h"
+
+namespace snowcrash {
+
+    /**
+     *  \brief Buffered JSON output writer.
+     *
+     *  Raw writes are written as they are. The whitespace between JSON
+     *  tokens is written by newLine(), space() and indent(), a compact
+     *  writer leaves it out.
+     */
+    class JSONWriter : public BufferedWriter {
+    public:
+        explicit JSONWriter(std::ostream& os, bool compact = false);
+
+        /** Write raw characters, no escaping is done */
+        JSONWriter& operator<<(const char* value);
+
+        /** Write raw string, no escaping is done */
+        JSONWriter& operator<<(const std::string& value);
+
+        /** Write one raw character */
+        JSONWriter& operator<<(char value) {
+            put(value);
+            return *this;
+        }
+
+        /** Write an unsigned number */
+        JSONWriter& operator<<(size_t value) {
+            writeNumber(value);
+            return *this;
+        }
+
+        /** Write a new line, nothing if compact */
+        void newLine() {
+            if (!compact)
+                put('\n');
+        }
+
+        /** Write a space, nothing if compact */
+        void space() {
+            if (!compact)
+                put(' ');
+        }
+
+        /** Write indentation of given level, nothing if compact */
+        void indent(size_t level);
+
+        /**
+         *  \brief Write a JSON string.
+         *
+         *  The value is enclosed in double quotes and escaped in one pass,
+         *  quotes, backslashes and control characters are escaped.
+         */
+        void string(const std::string& value);
+
+    private:
+        bool compact;
+    };
+}
+
+#endif
@@ -0,0 +1,52 @@
+//
+//  MappedFile.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_MAPPEDFILE_H
+#define SNOWCRASH_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace snowcrash {
+
+    /**
+     *  \brief Read-only memory mapped file
+     *
+     *  The mapping is released when the file is closed or destroyed.
+     */
+    class MappedFile {
+    public:
+        MappedFile();
+        ~MappedFile();
+
+        /**
+         *  \brief  Map a file into memory, closing previously mapped file
+         *  \param  path    A path of the file to map
+         *  \return True on success, an empty file is mapped with no data
+         */
+        bool open(const std::string& path);
+
+        /** Release the mapping */
+        void close();
+
+        /** \return Mapped data, page aligned */
+        const void* data() const { return address; }
+
+        /** \return Size of the mapped data in bytes */
+        size_t size() const { return length; }
+
+    private:
+        void* address;
+        size_t length;
+
+        MappedFile(const MappedFile&);
+        MappedFile& operator=(const MappedFile&);
+    };
+}
+
+#endif
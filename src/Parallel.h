@@ -0,0 +1,41 @@
+//
+//  Parallel.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_PARALLEL_H
+#define SNOWCRASH_PARALLEL_H
+
+#include <cstddef>
+
+namespace snowcrash {
+
+    /**
+     *  \brief Task of a parallel loop
+     *  \param index    Index of the iteration
+     *  \param context  Context of the loop
+     */
+    typedef void (*ParallelTask)(size_t index, void* context);
+
+    /**
+     *  \brief  Run a task for every index of a loop on a pool of worker threads
+     *  \param  task        Task to run
+     *  \param  context     Context passed to the task
+     *  \param  count       Number of iterations
+     *  \param  workers     Maximum number of threads, 0 for the number of processors
+     *
+     *  The calling thread is one of the workers, iterations are picked up
+     *  in order and the call returns when all of them are done. If a task
+     *  throws, no more iterations are started and `std::runtime_error` is
+     *  thrown once the running ones are finished.
+     */
+    void ParallelFor(ParallelTask task, void* context, size_t count, size_t workers = 0);
+
+    /** \return Number of online processors, at least 1 */
+    size_t ProcessorCount();
+}
+
+#endif
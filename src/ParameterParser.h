@@ -52,8 +52,8 @@ namespace snowcrash {
     /**
      * Parameter section processor
      */
-    template<>
-    struct SectionProcessor<Parameter> : public SectionProcessorBase<Parameter> {
+    template<typename Policy>
+    struct SectionProcessor<Parameter, Policy> : public SectionProcessorBase<Parameter, Policy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -69,7 +69,7 @@ namespace snowcrash {
             if (!remainingContent.empty()) {
                 out.node.description += "\n" + remainingContent + "\n";
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     out.sourceMap.description.sourceMap.append(node->sourceMap);
                 }
             }
@@ -88,7 +88,8 @@ namespace snowcrash {
             }
 
             // Check redefinition
-            if (!out.node.values.empty()) {
+            if (!out.node.values.empty() &&
+                pd.reportsWarning(out.report, RedefinitionWarning)) {
                 // WARN: parameter values are already defined
                 std::stringstream ss;
                 ss << "overshadowing previous 'values' definition";
@@ -103,14 +104,15 @@ namespace snowcrash {
             // Clear any previous values
             out.node.values.clear();
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 out.sourceMap.values.collection.clear();
             }
 
             ParseResultRef<Values> values(out.report, out.node.values, out.sourceMap.values);
-            ValuesParser::parse(node, siblings, pd, values);
+            SectionParser<Values, ListSectionAdapter, Policy>::parse(node, siblings, pd, values);
 
-            if (out.node.values.empty()) {
+            if (out.node.values.empty() &&
+                pd.reportsWarning(out.report, EmptyDefinitionWarning)) {
                 // WARN: empty definition
                 std::stringstream ss;
                 ss << "no possible values specified for parameter '" << out.node.name << "'";
@@ -149,7 +151,7 @@ namespace snowcrash {
 
         static SectionType nestedSectionType(const MarkdownNodeIterator& node) {
 
-            return SectionProcessor<Values>::sectionType(node);
+            return SectionProcessor<Values, Policy>::sectionType(node);
         }
 
         static SectionTypes nestedSectionTypes() {
@@ -224,7 +226,7 @@ namespace snowcrash {
                     }
                 }
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     if (!out.node.name.empty()) {
                         out.sourceMap.name.sourceMap = node->sourceMap;
                     }
@@ -240,7 +242,8 @@ namespace snowcrash {
 
                 // Check possible required vs default clash
                 if (out.node.use != OptionalParameterUse &&
-                    !out.node.defaultValue.empty()) {
+                    !out.node.defaultValue.empty() &&
+                    pd.reportsWarning(out.report, LogicalErrorWarning)) {
 
                     // WARN: Required vs default clash
                     std::stringstream ss;
@@ -281,7 +284,7 @@ namespace snowcrash {
                     traits.replace(pos, captureGroups[0].length(), std::string());
                 }
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     out.sourceMap.exampleValue.sourceMap = node->sourceMap;
                 }
              }
@@ -299,7 +302,7 @@ namespace snowcrash {
                     traits.replace(pos, captureGroups[0].length(), std::string());
                 }
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     out.sourceMap.use.sourceMap = node->sourceMap;
                 }
             }
@@ -317,7 +320,7 @@ namespace snowcrash {
                     traits.replace(pos, captureGroups[0].length(), std::string());
                 }
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     out.sourceMap.type.sourceMap = node->sourceMap;
                 }
             }
@@ -327,21 +330,24 @@ namespace snowcrash {
 
             if (!traits.empty()) {
                 // WARN: Additional parameters traits warning
-                std::stringstream ss;
-                ss << "unable to parse additional parameter traits";
-                ss << ", expected '([required | optional], [<type>], [`<example value>`])'";
-                ss << ", e.g. '(optional, string, `Hello World`)'";
+                if (pd.reportsWarning(out.report, FormattingWarning)) {
 
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-                out.report.warnings.push_back(Warning(ss.str(),
-                                                      FormattingWarning,
-                                                      sourceMap));
+                    std::stringstream ss;
+                    ss << "unable to parse additional parameter traits";
+                    ss << ", expected '([required | optional], [<type>], [`<example value>`])'";
+                    ss << ", e.g. '(optional, string, `Hello World`)'";
+
+                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                    out.report.warnings.push_back(Warning(ss.str(),
+                                                          FormattingWarning,
+                                                          sourceMap));
+                }
 
                 out.node.type.clear();
                 out.node.exampleValue.clear();
                 out.node.use = UndefinedParameterUse;
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     out.sourceMap.type.sourceMap.clear();
                     out.sourceMap.exampleValue.sourceMap.clear();
                     out.sourceMap.use.sourceMap.clear();
@@ -353,6 +359,9 @@ namespace snowcrash {
                                                 SectionParserData& pd,
                                                 const ParseResultRef<Parameter>& out) {
 
+            if (!pd.reportsWarning(out.report, LogicalErrorWarning))
+                return;
+
             bool isExampleFound = false;
             bool isDefaultFound = false;
 
@@ -29,8 +29,8 @@ namespace snowcrash {
     /**
      * Parameters section processor
      */
-    template<>
-    struct SectionProcessor<Parameters> : public SectionProcessorBase<Parameters> {
+    template<typename Policy>
+    struct SectionProcessor<Parameters, Policy> : public SectionProcessorBase<Parameters, Policy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -42,7 +42,8 @@ namespace snowcrash {
 
             GetFirstLine(node->text, remainingContent);
 
-            if (!remainingContent.empty()) {
+            if (!remainingContent.empty() &&
+                pd.reportsWarning(out.report, IgnoringWarning)) {
 
                 // WARN: Extra content in parameters section
                 std::stringstream ss;
@@ -75,11 +76,12 @@ namespace snowcrash {
                 return node;
             }
 
-            IntermediateParseResult<Parameter> parameter(out.report);
+            IntermediateParseResult<Parameter, Policy> parameter(out.report);
 
-            ParameterParser::parse(node, siblings, pd, parameter);
+            SectionParser<Parameter, ListSectionAdapter, Policy>::parse(node, siblings, pd, parameter);
 
-            if (!out.node.empty()) {
+            if (!out.node.empty() &&
+                pd.reportsWarning(out.report, RedefinitionWarning)) {
 
                 ParameterIterator duplicate = findParameter(out.node, parameter.node);
 
@@ -98,7 +100,7 @@ namespace snowcrash {
 
             out.node.push_back(parameter.node);
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 out.sourceMap.collection.push_back(parameter.sourceMap);
             }
 
@@ -131,7 +133,7 @@ namespace snowcrash {
 
         static SectionType nestedSectionType(const MarkdownNodeIterator& node) {
 
-            return SectionProcessor<Parameter>::sectionType(node);
+            return SectionProcessor<Parameter, Policy>::sectionType(node);
         }
 
         static SectionTypes nestedSectionTypes() {
@@ -139,7 +141,7 @@ namespace snowcrash {
 
             // Parameter & descendants
             nested.push_back(ParameterSectionType);
-            SectionTypes types = SectionProcessor<Parameter>::nestedSectionTypes();
+            SectionTypes types = SectionProcessor<Parameter, Policy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -149,7 +151,8 @@ namespace snowcrash {
                              SectionParserData& pd,
                              const ParseResultRef<Parameters>& out) {
 
-            if (out.node.empty()) {
+            if (out.node.empty() &&
+                pd.reportsWarning(out.report, FormattingWarning)) {
 
                 // WARN: No parameters defined
                 mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
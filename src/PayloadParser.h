@@ -45,8 +45,8 @@ namespace snowcrash {
     /**
      * Payload Section Processor
      */
-    template<>
-    struct SectionProcessor<Payload> : public SectionProcessorBase<Payload> {
+    template<typename Policy>
+    struct SectionProcessor<Payload, Policy> : public SectionProcessorBase<Payload, Policy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -63,10 +63,13 @@ namespace snowcrash {
             if (out.node.name.empty() &&
                 (pd.sectionContext() == ResponseSectionType || pd.sectionContext() == ResponseBodySectionType)) {
 
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-                out.report.warnings.push_back(Warning("missing response HTTP status code, assuming 'Response 200'",
-                                                      EmptyDefinitionWarning,
-                                                      sourceMap));
+                if (pd.reportsWarning(out.report, EmptyDefinitionWarning)) {
+                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                    out.report.warnings.push_back(Warning("missing response HTTP status code, assuming 'Response 200'",
+                                                          EmptyDefinitionWarning,
+                                                          sourceMap));
+                }
+
                 out.node.name = "200";
             }
 
@@ -74,7 +77,7 @@ namespace snowcrash {
                 if (!isAbbreviated(pd.sectionContext())) {
                     out.node.description = remainingContent;
 
-                    if (pd.exportSourceMap() && !out.node.description.empty()) {
+                    if (Policy::exportSourceMap(pd) && !out.node.description.empty()) {
                         out.sourceMap.description.sourceMap.append(node->sourceMap);
                     }
                 } else if (!parseSymbolReference(node, pd, remainingContent, out)) {
@@ -85,7 +88,7 @@ namespace snowcrash {
                     CodeBlockUtility::signatureContentAsCodeBlock(node, pd, out.report, out.node.body);
                     pd.sectionsContext.pop_back();
 
-                    if (pd.exportSourceMap() && !out.node.body.empty()) {
+                    if (Policy::exportSourceMap(pd) && !out.node.body.empty()) {
                         out.sourceMap.body.sourceMap.append(node->sourceMap);
                     }
                 }
@@ -103,15 +106,18 @@ namespace snowcrash {
 
             if (!out.node.reference.id.empty()) {
                 //WARN: ignoring extraneous content after symbol reference
-                std::stringstream ss;
+                if (pd.reportsWarning(out.report, IgnoringWarning)) {
 
-                ss << "ignoring extraneous content after symbol reference";
-                ss << ", expected symbol reference only e.g. '[" << out.node.reference.id << "][]'";
+                    std::stringstream ss;
 
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-                out.report.warnings.push_back(Warning(ss.str(),
-                                                      IgnoringWarning,
-                                                      sourceMap));
+                    ss << "ignoring extraneous content after symbol reference";
+                    ss << ", expected symbol reference only e.g. '[" << out.node.reference.id << "][]'";
+
+                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                    out.report.warnings.push_back(Warning(ss.str(),
+                                                          IgnoringWarning,
+                                                          sourceMap));
+                }
             } else {
 
                 if (!out.node.body.empty() ||
@@ -126,7 +132,7 @@ namespace snowcrash {
 
                     out.node.body += content;
 
-                    if (pd.exportSourceMap() && !content.empty()) {
+                    if (Policy::exportSourceMap(pd) && !content.empty()) {
                         out.sourceMap.body.sourceMap.append(node->sourceMap);
                     }
                 }
@@ -144,12 +150,13 @@ namespace snowcrash {
                 case HeadersSectionType:
                 {
                     ParseResultRef<Headers> headers(out.report, out.node.headers, out.sourceMap.headers);
-                    return HeadersParser::parse(node, siblings, pd, headers);
+                    return SectionParser<Headers, ListSectionAdapter, Policy>::parse(node, siblings, pd, headers);
                 }
 
                 case BodySectionType:
                 {
-                    if (!out.node.body.empty()) {
+                    if (!out.node.body.empty() &&
+                        pd.reportsWarning(out.report, RedefinitionWarning)) {
                         // WARN: Multiple body section
                         mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
                         out.report.warnings.push_back(Warning("ignoring additional 'body' content, it is already defined",
@@ -158,12 +165,13 @@ namespace snowcrash {
                     }
 
                     ParseResultRef<Asset> asset(out.report, out.node.body, out.sourceMap.body);
-                    return AssetParser::parse(node, siblings, pd, asset);
+                    return SectionParser<Asset, ListSectionAdapter, Policy>::parse(node, siblings, pd, asset);
                 }
 
                 case SchemaSectionType:
                 {
-                    if (!out.node.schema.empty()) {
+                    if (!out.node.schema.empty() &&
+                        pd.reportsWarning(out.report, RedefinitionWarning)) {
                         // WARN: Multiple schema section
                         mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
                         out.report.warnings.push_back(Warning("ignoring additional 'schema' content, it is already defined",
@@ -172,7 +180,7 @@ namespace snowcrash {
                     }
 
                     ParseResultRef<Asset> asset(out.report, out.node.schema, out.sourceMap.schema);
-                    return AssetParser::parse(node, siblings, pd, asset);
+                    return SectionParser<Asset, ListSectionAdapter, Policy>::parse(node, siblings, pd, asset);
                 }
 
                 default:
@@ -194,21 +202,21 @@ namespace snowcrash {
 
                 mdp::ByteBuffer content = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, out.node.body);
 
-                if (pd.exportSourceMap() && !content.empty()) {
+                if (Policy::exportSourceMap(pd) && !content.empty()) {
                     out.sourceMap.body.sourceMap.append(node->sourceMap);
                 }
 
                 return ++MarkdownNodeIterator(node);
             }
 
-            return SectionProcessorBase<Payload>::processUnexpectedNode(node, siblings, pd, sectionType, out);
+            return SectionProcessorBase<Payload, Policy>::processUnexpectedNode(node, siblings, pd, sectionType, out);
         }
 
         static bool isDescriptionNode(const MarkdownNodeIterator& node,
                                       SectionType sectionType) {
 
             if (!isAbbreviated(sectionType) &&
-                SectionProcessorBase<Payload>::isDescriptionNode(node, sectionType)) {
+                SectionProcessorBase<Payload, Policy>::isDescriptionNode(node, sectionType)) {
 
                 return true;
             }
@@ -263,14 +271,14 @@ namespace snowcrash {
             SectionType nestedType = UndefinedSectionType;
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = SectionProcessor<Headers, Policy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if asset section
-            nestedType = SectionProcessor<Asset>::sectionType(node);
+            nestedType = SectionProcessor<Asset, Policy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -288,7 +296,7 @@ namespace snowcrash {
 
             // Parameters & descendants
             nested.push_back(ParametersSectionType);
-            types = SectionProcessor<Parameters>::nestedSectionTypes();
+            types = SectionProcessor<Parameters, Policy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -298,6 +306,9 @@ namespace snowcrash {
                              SectionParserData& pd,
                              const ParseResultRef<Payload>& out) {
 
+            if (!pd.reportsWarning(out.report, EmptyDefinitionWarning))
+                return;
+
             bool warnEmptyBody = false;
 
             mdp::ByteBuffer contentLength;
@@ -461,33 +472,35 @@ namespace snowcrash {
 
                 if (!target.empty()) {
                     // WARN: unable to parse payload signature
-                    std::stringstream ss;
-                    ss << "unable to parse " << SectionName(pd.sectionContext()) << " signature, expected ";
-
-                    switch (pd.sectionContext()) {
-                        case RequestSectionType:
-                        case RequestBodySectionType:
-                            ss << "'request [<identifier>] [(<media type>)]'";
-                            break;
-
-                        case ResponseBodySectionType:
-                        case ResponseSectionType:
-                            ss << "'response [<HTTP status code>] [(<media type>)]'";
-                            break;
-
-                        case ModelSectionType:
-                        case ModelBodySectionType:
-                            ss << "'model [(<media type>)]'";
-                            break;
-
-                        default:
-                            return false;
-                    }
+                    if (pd.reportsWarning(out.report, FormattingWarning)) {
+                        std::stringstream ss;
+                        ss << "unable to parse " << SectionName(pd.sectionContext()) << " signature, expected ";
+
+                        switch (pd.sectionContext()) {
+                            case RequestSectionType:
+                            case RequestBodySectionType:
+                                ss << "'request [<identifier>] [(<media type>)]'";
+                                break;
+
+                            case ResponseBodySectionType:
+                            case ResponseSectionType:
+                                ss << "'response [<HTTP status code>] [(<media type>)]'";
+                                break;
+
+                            case ModelSectionType:
+                            case ModelBodySectionType:
+                                ss << "'model [(<media type>)]'";
+                                break;
+
+                            default:
+                                return false;
+                        }
 
-                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-                    out.report.warnings.push_back(Warning(ss.str(),
-                                                          FormattingWarning,
-                                                          sourceMap));
+                        mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                        out.report.warnings.push_back(Warning(ss.str(),
+                                                              FormattingWarning,
+                                                              sourceMap));
+                    }
 
                     return false;
                 }
@@ -505,7 +518,7 @@ namespace snowcrash {
                 TrimString(out.node.name);
                 TrimString(mediaType);
 
-                if (pd.exportSourceMap() && !out.node.name.empty()) {
+                if (Policy::exportSourceMap(pd) && !out.node.name.empty()) {
                     out.sourceMap.name.sourceMap = node->sourceMap;
                 }
 
@@ -513,7 +526,7 @@ namespace snowcrash {
                     Header header = std::make_pair(HTTPHeaderName::ContentType, mediaType);
                     out.node.headers.push_back(header);
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         SourceMap<Header> headerSM;
                         headerSM.sourceMap = node->sourceMap;
                         out.sourceMap.headers.collection.push_back(headerSM);
@@ -540,7 +553,7 @@ namespace snowcrash {
                 out.node.reference.meta.node = node;
                 out.node.reference.type = Reference::SymbolReference;
 
-                if (pd.exportSourceMap() && !symbol.empty()) {
+                if (Policy::exportSourceMap(pd) && !symbol.empty()) {
                     out.sourceMap.reference.sourceMap = node->sourceMap;
                 }
 
@@ -570,12 +583,12 @@ namespace snowcrash {
         static void assingReferredPayload(SectionParserData& pd,
                                           const ParseResultRef<Payload>& out) {
 
-            SourceMap<ResourceModel> modelSM;
-            ResourceModel model = pd.symbolTable.resourceModels.at(out.node.reference.id);
+            const ResourceModel& model = pd.symbolTable.resourceModels.at(out.node.reference.id);
 
-
-            out.node.description = model.description;
-            out.node.parameters = model.parameters;
+            if (!pd.validateOnly()) {
+                out.node.description = model.description;
+                out.node.parameters = model.parameters;
+            }
 
             HeaderIterator modelContentTypeIt = std::find_if(model.headers.begin(),
                                                              model.headers.end(),
@@ -585,7 +598,8 @@ namespace snowcrash {
             bool isPayloadContentType = !out.node.headers.empty();
             bool isModelContentType = modelContentTypeIt != model.headers.end();
 
-            if (isPayloadContentType && isModelContentType) {
+            if (isPayloadContentType && isModelContentType &&
+                pd.reportsWarning(out.report, IgnoringWarning)) {
 
                 // WARN: Ignoring payload content-type, when referencing a model with headers
                 std::stringstream ss;
@@ -605,12 +619,19 @@ namespace snowcrash {
                 out.node.headers = model.headers;
             }
 
-            out.node.body = model.body;
-            out.node.schema = model.schema;
+            if (pd.validateOnly()) {
+
+                // Validation checks only presence of the body, one character stands for it
+                out.node.body = model.body.substr(0, 1);
+            }
+            else {
+                out.node.body = model.body;
+                out.node.schema = model.schema;
+            }
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
 
-                modelSM = pd.symbolSourceMapTable.resourceModels.at(out.node.reference.id);
+                const SourceMap<ResourceModel>& modelSM = pd.symbolSourceMapTable.resourceModels.at(out.node.reference.id);
 
                 out.sourceMap.description = modelSM.description;
                 out.sourceMap.parameters = modelSM.parameters;
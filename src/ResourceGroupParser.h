@@ -26,8 +26,8 @@ namespace snowcrash {
     /**
      * ResourceGroup Section processor
      */
-    template<>
-    struct SectionProcessor<ResourceGroup> : public SectionProcessorBase<ResourceGroup> {
+    template<typename Policy>
+    struct SectionProcessor<ResourceGroup, Policy> : public SectionProcessorBase<ResourceGroup, Policy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -51,7 +51,7 @@ namespace snowcrash {
                 TrimString(out.node.name);
             }
 
-            if (pd.exportSourceMap() && !out.node.name.empty()) {
+            if (Policy::exportSourceMap(pd) && !out.node.name.empty()) {
                 out.sourceMap.name.sourceMap = node->sourceMap;
             }
 
@@ -65,11 +65,27 @@ namespace snowcrash {
 
             if (pd.sectionContext() == ResourceSectionType) {
 
-                IntermediateParseResult<Resource> resource(out.report);
+                IntermediateParseResult<Resource, Policy> resource(out.report);
 
-                MarkdownNodeIterator cur = ResourceParser::parse(node, siblings, pd, resource);
+                MarkdownNodeIterator cur = SectionParser<Resource, HeaderSectionAdapter, Policy>::parse(node, siblings, pd, resource);
 
-                ResourceIterator duplicate = SectionProcessor<Resource>::findResource(out.node.resources, resource.node);
+                addResource(node, pd, resource, out);
+
+                return cur;
+            }
+
+            return node;
+        }
+
+        /** Add parsed resource starting at given node to the resource group */
+        static void addResource(const MarkdownNodeIterator& node,
+                                SectionParserData& pd,
+                                const ParseResultRef<Resource>& resource,
+                                const ParseResultRef<ResourceGroup>& out) {
+
+            if (pd.reportsWarning(out.report, DuplicateWarning)) {
+
+                ResourceIterator duplicate = SectionProcessor<Resource, Policy>::findResource(out.node.resources, resource.node);
                 ResourceIteratorPair globalDuplicate;
 
                 if (duplicate == out.node.resources.end()) {
@@ -85,17 +101,13 @@ namespace snowcrash {
                                                           DuplicateWarning,
                                                           sourceMap));
                 }
+            }
 
-                out.node.resources.push_back(resource.node);
+            out.node.resources.push_back(resource.node);
 
-                if (pd.exportSourceMap()) {
-                    out.sourceMap.resources.collection.push_back(resource.sourceMap);
-                }
-
-                return cur;
+            if (Policy::exportSourceMap(pd)) {
+                out.sourceMap.resources.collection.push_back(resource.sourceMap);
             }
-
-            return node;
         }
 
         static MarkdownNodeIterator processUnexpectedNode(const MarkdownNodeIterator& node,
@@ -104,28 +116,31 @@ namespace snowcrash {
                                                           SectionType& lastSectionType,
                                                           const ParseResultRef<ResourceGroup>& out) {
 
-            if (SectionProcessor<Action>::actionType(node) == DependentActionType &&
+            if (SectionProcessor<Action, Policy>::actionType(node) == DependentActionType &&
                 !out.node.resources.empty()) {
 
-                mdp::ByteBuffer method;
-                mdp::ByteBuffer name;
+                // WARN: Unexpected action
+                if (pd.reportsWarning(out.report, IgnoringWarning)) {
+
+                    mdp::ByteBuffer method;
+                    mdp::ByteBuffer name;
 
-                SectionProcessor<Action>::actionHTTPMethodAndName(node, method, name);
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                    SectionProcessor<Action, Policy>::actionHTTPMethodAndName(node, method, name);
+                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
 
-                // WARN: Unexpected action
-                std::stringstream ss;
-                ss << "unexpected action '" << method << "', to define multiple actions for the '" << out.node.resources.back().uriTemplate;
-                ss << "' resource omit the HTTP method in its definition, e.g. '# /resource'";
+                    std::stringstream ss;
+                    ss << "unexpected action '" << method << "', to define multiple actions for the '" << out.node.resources.back().uriTemplate;
+                    ss << "' resource omit the HTTP method in its definition, e.g. '# /resource'";
 
-                out.report.warnings.push_back(Warning(ss.str(),
-                                                      IgnoringWarning,
-                                                      sourceMap));
+                    out.report.warnings.push_back(Warning(ss.str(),
+                                                          IgnoringWarning,
+                                                          sourceMap));
+                }
 
                 return ++MarkdownNodeIterator(node);
             }
 
-            return SectionProcessorBase<ResourceGroup>::processUnexpectedNode(node, siblings, pd, lastSectionType, out);
+            return SectionProcessorBase<ResourceGroup, Policy>::processUnexpectedNode(node, siblings, pd, lastSectionType, out);
         }
 
         static SectionType sectionType(const MarkdownNodeIterator& node) {
@@ -147,7 +162,7 @@ namespace snowcrash {
         static SectionType nestedSectionType(const MarkdownNodeIterator& node) {
 
             // Return ResourceSectionType or UndefinedSectionType
-            return SectionProcessor<Resource>::sectionType(node);
+            return SectionProcessor<Resource, Policy>::sectionType(node);
         }
 
         static SectionTypes nestedSectionTypes() {
@@ -155,7 +170,7 @@ namespace snowcrash {
 
             // Resource & descendants
             nested.push_back(ResourceSectionType);
-            SectionTypes types = SectionProcessor<Resource>::nestedSectionTypes();
+            SectionTypes types = SectionProcessor<Resource, Policy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -166,21 +181,21 @@ namespace snowcrash {
 
             mdp::ByteBuffer method;
 
-            if (SectionProcessor<Action>::actionType(node) == CompleteActionType) {
+            if (SectionProcessor<Action, Policy>::actionType(node) == CompleteActionType) {
                 return false;
             }
 
-            return SectionProcessorBase<ResourceGroup>::isDescriptionNode(node, sectionType);
+            return SectionProcessorBase<ResourceGroup, Policy>::isDescriptionNode(node, sectionType);
         }
 
         static bool isUnexpectedNode(const MarkdownNodeIterator& node,
                                      SectionType sectionType) {
 
-            if (SectionProcessor<Action>::actionType(node) == DependentActionType) {
+            if (SectionProcessor<Action, Policy>::actionType(node) == DependentActionType) {
                 return true;
             }
 
-            return SectionProcessorBase<ResourceGroup>::isUnexpectedNode(node, sectionType);
+            return SectionProcessorBase<ResourceGroup, Policy>::isUnexpectedNode(node, sectionType);
         }
 
         /** Finds a resource in blueprint by its URI template */
@@ -191,7 +206,7 @@ namespace snowcrash {
                   it != blueprint.resourceGroups.end();
                   ++it) {
 
-                ResourceIterator match = SectionProcessor<Resource>::findResource(it->resources, resource);
+                ResourceIterator match = SectionProcessor<Resource, Policy>::findResource(it->resources, resource);
 
                 if (match != it->resources.end()) {
                     return std::make_pair(it, match);
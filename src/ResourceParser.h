@@ -30,8 +30,8 @@ namespace snowcrash {
     /**
      * Resource Section processor
      */
-    template<>
-    struct SectionProcessor<Resource> : public SectionProcessorBase<Resource> {
+    template<typename Policy>
+    struct SectionProcessor<Resource, Policy> : public SectionProcessorBase<Resource, Policy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -49,14 +49,14 @@ namespace snowcrash {
                 // Make this section an action
                 if (!captureGroups[2].empty()) {
 
-                    IntermediateParseResult<Action> action(out.report);
+                    IntermediateParseResult<Action, Policy> action(out.report);
 
-                    MarkdownNodeIterator cur = ActionParser::parse(node, node->parent().children(), pd, action);
+                    MarkdownNodeIterator cur = SectionParser<Action, HeaderSectionAdapter, Policy>::parse(node, node->parent().children(), pd, action);
 
                     out.node.actions.push_back(action.node);
                     layout = RedirectSectionLayout;
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         out.sourceMap.actions.collection.push_back(action.sourceMap);
                         out.sourceMap.uriTemplate.sourceMap = node->sourceMap;
                     }
@@ -70,7 +70,7 @@ namespace snowcrash {
                 out.node.uriTemplate = captureGroups[2];
             }
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 if (!out.node.uriTemplate.empty()) {
                     out.sourceMap.uriTemplate.sourceMap = node->sourceMap;
                 }
@@ -102,7 +102,7 @@ namespace snowcrash {
                 case HeadersSectionType:
                 {
                     ParseResultRef<Headers> headers(out.report, out.node.headers, out.sourceMap.headers);
-                    return SectionProcessor<Action>::handleDeprecatedHeaders(node, siblings, pd, headers);
+                    return SectionProcessor<Action, Policy>::handleDeprecatedHeaders(node, siblings, pd, headers);
                 }
 
                 default:
@@ -125,7 +125,7 @@ namespace snowcrash {
 
                 mdp::ByteBuffer content = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, out.node.model.body);
 
-                if (pd.exportSourceMap() && !content.empty()) {
+                if (Policy::exportSourceMap(pd) && !content.empty()) {
                     out.sourceMap.model.body.sourceMap.append(node->sourceMap);
                 }
 
@@ -135,7 +135,7 @@ namespace snowcrash {
                 if (it != pd.symbolTable.resourceModels.end()) {
                     it->second.body = out.node.model.body;
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         pd.symbolSourceMapTable.resourceModels[out.node.model.name].body = out.sourceMap.model.body;
                     }
                 }
@@ -143,17 +143,17 @@ namespace snowcrash {
                 return ++MarkdownNodeIterator(node);
             }
 
-            return SectionProcessorBase<Resource>::processUnexpectedNode(node, siblings, pd, sectionType, out);
+            return SectionProcessorBase<Resource, Policy>::processUnexpectedNode(node, siblings, pd, sectionType, out);
         }
 
         static bool isDescriptionNode(const MarkdownNodeIterator& node,
                                       SectionType sectionType) {
 
-            if (SectionProcessor<Action>::actionType(node) == CompleteActionType) {
+            if (SectionProcessor<Action, Policy>::actionType(node) == CompleteActionType) {
                 return false;
             }
 
-            return SectionProcessorBase<Resource>::isDescriptionNode(node, sectionType);
+            return SectionProcessorBase<Resource, Policy>::isDescriptionNode(node, sectionType);
         }
 
         static SectionType sectionType(const MarkdownNodeIterator& node) {
@@ -180,21 +180,21 @@ namespace snowcrash {
             SectionType nestedType = UndefinedSectionType;
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = SectionProcessor<Parameters, Policy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = SectionProcessor<Headers, Policy>::sectionType(node);
 
             if (nestedType == HeadersSectionType) {
                 return nestedType;
             }
 
             // Check if model section
-            nestedType = SectionProcessor<Payload>::sectionType(node);
+            nestedType = SectionProcessor<Payload, Policy>::sectionType(node);
 
             if (nestedType == ModelSectionType ||
                 nestedType == ModelBodySectionType) {
@@ -203,13 +203,13 @@ namespace snowcrash {
             }
 
             // Check if action section
-            nestedType = SectionProcessor<Action>::sectionType(node);
+            nestedType = SectionProcessor<Action, Policy>::sectionType(node);
 
             if (nestedType == ActionSectionType) {
 
                 // Do not consider complete actions as nested
                 mdp::ByteBuffer method;
-                if (SectionProcessor<Action>::actionType(node) == CompleteActionType)
+                if (SectionProcessor<Action, Policy>::actionType(node) == CompleteActionType)
                     return UndefinedSectionType;
 
                 return nestedType;
@@ -223,7 +223,7 @@ namespace snowcrash {
 
             // Action & descendants
             nested.push_back(ActionSectionType);
-            SectionTypes types = SectionProcessor<Action>::nestedSectionTypes();
+            SectionTypes types = SectionProcessor<Action, Policy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             nested.push_back(ModelSectionType);
@@ -236,16 +236,27 @@ namespace snowcrash {
                              SectionParserData& pd,
                              const ParseResultRef<Resource>& out) {
 
-            if (!out.node.uriTemplate.empty()) {
+            // URI template parser reports URI warnings only
+            if (!out.node.uriTemplate.empty() &&
+                pd.reportsWarning(out.report, URIWarning)) {
 
-                URITemplateParser uriTemplateParser;
-                ParsedURITemplate parsedResult;
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-
-                uriTemplateParser.parse(out.node.uriTemplate, sourceMap, parsedResult);
+                const ParsedURITemplate& parsedResult = URITemplateParser::parse(out.node.uriTemplate, pd.uriTemplates);
 
                 if (!parsedResult.report.warnings.empty()) {
-                    out.report += parsedResult.report;
+                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+
+                    for (Warnings::const_iterator it = parsedResult.report.warnings.begin();
+                         it != parsedResult.report.warnings.end();
+                         ++it) {
+
+                        out.report.warnings.push_back(Warning(it->message, it->code, sourceMap));
+                    }
+
+                    if (pd.reportOptions.maxWarnings != 0 &&
+                        out.report.warnings.size() > pd.reportOptions.maxWarnings) {
+
+                        out.report.warnings.resize(pd.reportOptions.maxWarnings);
+                    }
                 }
             }
 
@@ -253,18 +264,29 @@ namespace snowcrash {
             if (!out.node.headers.empty()) {
 
                 Collection<Action>::iterator actIt = out.node.actions.begin();
-                Collection<SourceMap<Action> >::iterator actSMIt = out.sourceMap.actions.collection.begin();
+                Collection<SourceMap<Action> >::iterator actSMIt;
+
+                if (Policy::exportSourceMap(pd)) {
+                    actSMIt = out.sourceMap.actions.collection.begin();
+                }
 
                 for (;
                      actIt != out.node.actions.end();
-                     ++actIt, ++actSMIt) {
+                     ++actIt) {
+
+                    SourceMap<TransactionExamples>* examplesSM = &NullSourceMap<TransactionExamples>();
+
+                    if (Policy::exportSourceMap(pd)) {
+                        examplesSM = &actSMIt->examples;
+                        ++actSMIt;
+                    }
 
-                    SectionProcessor<Headers>::injectDeprecatedHeaders(pd, out.node.headers, out.sourceMap.headers, actIt->examples, actSMIt->examples);
+                    SectionProcessor<Headers, Policy>::injectDeprecatedHeaders(pd, out.node.headers, out.sourceMap.headers, actIt->examples, *examplesSM);
                 }
 
                 out.node.headers.clear();
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     out.sourceMap.headers.collection.clear();
                 }
             }
@@ -276,23 +298,26 @@ namespace snowcrash {
                                                   SectionParserData& pd,
                                                   const ParseResultRef<Resource>& out) {
 
-            IntermediateParseResult<Action> action(out.report);
+            IntermediateParseResult<Action, Policy> action(out.report);
 
-            MarkdownNodeIterator cur = ActionParser::parse(node, siblings, pd, action);
+            MarkdownNodeIterator cur = SectionParser<Action, HeaderSectionAdapter, Policy>::parse(node, siblings, pd, action);
 
-            ActionIterator duplicate = SectionProcessor<Action>::findAction(out.node.actions, action.node);
+            if (pd.reportsWarning(out.report, DuplicateWarning)) {
 
-            if (duplicate != out.node.actions.end()) {
+                ActionIterator duplicate = SectionProcessor<Action, Policy>::findAction(out.node.actions, action.node);
 
-                // WARN: duplicate method
-                std::stringstream ss;
-                ss << "action with method '" << action.node.method << "' already defined for resource '";
-                ss << out.node.uriTemplate << "'";
+                if (duplicate != out.node.actions.end()) {
 
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-                out.report.warnings.push_back(Warning(ss.str(),
-                                                      DuplicateWarning,
-                                                      sourceMap));
+                    // WARN: duplicate method
+                    std::stringstream ss;
+                    ss << "action with method '" << action.node.method << "' already defined for resource '";
+                    ss << out.node.uriTemplate << "'";
+
+                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                    out.report.warnings.push_back(Warning(ss.str(),
+                                                          DuplicateWarning,
+                                                          sourceMap));
+                }
             }
 
             if (!action.node.parameters.empty()) {
@@ -302,7 +327,7 @@ namespace snowcrash {
 
             out.node.actions.push_back(action.node);
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 out.sourceMap.actions.collection.push_back(action.sourceMap);
             }
 
@@ -315,16 +340,16 @@ namespace snowcrash {
                                                       SectionParserData& pd,
                                                       const ParseResultRef<Resource>& out) {
 
-            IntermediateParseResult<Parameters> parameters(out.report);
+            IntermediateParseResult<Parameters, Policy> parameters(out.report);
 
-            MarkdownNodeIterator cur = ParametersParser::parse(node, siblings, pd, parameters);
+            MarkdownNodeIterator cur = SectionParser<Parameters, ListSectionAdapter, Policy>::parse(node, siblings, pd, parameters);
 
             if (!parameters.node.empty()) {
 
                 checkParametersEligibility(node, pd, parameters.node, out);
                 out.node.parameters.insert(out.node.parameters.end(), parameters.node.begin(), parameters.node.end());
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     out.sourceMap.parameters.collection.insert(out.sourceMap.parameters.collection.end(),
                                                                parameters.sourceMap.collection.begin(),
                                                                parameters.sourceMap.collection.end());
@@ -340,12 +365,13 @@ namespace snowcrash {
                                                  SectionParserData& pd,
                                                  const ParseResultRef<Resource>& out) {
 
-            IntermediateParseResult<Payload> model(out.report);
+            IntermediateParseResult<Payload, Policy> model(out.report);
 
-            MarkdownNodeIterator cur = PayloadParser::parse(node, siblings, pd, model);
+            MarkdownNodeIterator cur = SectionParser<Payload, ListSectionAdapter, Policy>::parse(node, siblings, pd, model);
 
             // Check whether there isn't a model already
-            if (!out.node.model.name.empty()) {
+            if (!out.node.model.name.empty() &&
+                pd.reportsWarning(out.report, DuplicateWarning)) {
 
                 // WARN: Model already defined
                 std::stringstream ss;
@@ -370,7 +396,7 @@ namespace snowcrash {
                 if (!out.node.name.empty()) {
                     model.node.name = out.node.name;
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         model.sourceMap.name = out.sourceMap.name;
                     }
                 } else {
@@ -393,7 +419,7 @@ namespace snowcrash {
 
                 pd.symbolTable.resourceModels[model.node.name] = model.node;
 
-                if (pd.exportSourceMap()) {
+                if (Policy::exportSourceMap(pd)) {
                     pd.symbolSourceMapTable.resourceModels[model.node.name] = model.sourceMap;
                 }
             } else {
@@ -410,7 +436,7 @@ namespace snowcrash {
 
             out.node.model = model.node;
 
-            if (pd.exportSourceMap()) {
+            if (Policy::exportSourceMap(pd)) {
                 out.sourceMap.model = model.sourceMap;
             }
 
@@ -423,6 +449,9 @@ namespace snowcrash {
                                                Parameters& parameters,
                                                const ParseResultRef<Resource>& out) {
 
+            if (!pd.reportsWarning(out.report, LogicalErrorWarning))
+                return;
+
             for (ParameterIterator it = parameters.begin();
                  it != parameters.end();
                  ++it) {
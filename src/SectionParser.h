@@ -16,10 +16,40 @@
 
 namespace snowcrash {
 
+    /**
+     *  Phase of a section parsed step by step
+     */
+    enum SectionParserPhase {
+        SignatureSectionParserPhase,    /// Signature node is next
+        DescriptionSectionParserPhase,  /// Description nodes are next
+        ContentSectionParserPhase,      /// Content nodes are next
+        NestedSectionParserPhase,       /// Nested sections are next
+        FinalizeSectionParserPhase,     /// Section is to be finalized
+        DoneSectionParserPhase          /// Section is parsed
+    };
+
+    /**
+     *  \brief State of a section parsed step by step
+     *
+     *  Keeps the position of the parser between the calls of
+     *  SectionParser::step() instead of the call stack. Positions are
+     *  indexes of the nodes in SectionParserData::markdown.
+     */
+    struct SectionParserCursor {
+        SectionParserPhase phase;
+        SectionLayout layout;
+        size_t node;                        /// Initial node
+        size_t siblings;                    /// Parent of the initial node
+        size_t cur;                         /// Node to be processed next, NoFlatNode past the last one
+        size_t collection;                  /// Parent of the node to be processed next
+        SectionType lastSectionType;        /// Type of the last nested section
+        size_t next;                        /// First unparsed block once done
+    };
+
     /**
      *  Blueprint section parser
      */
-    template<typename T, typename Adapter>
+    template<typename T, typename Adapter, typename Policy = SourceMapPolicy>
     struct SectionParser {
 
 
@@ -36,109 +66,206 @@ namespace snowcrash {
                                           SectionParserData& pd,
                                           const ParseResultRef<T>& out) {
 
-            SectionLayout layout = DefaultSectionLayout;
-            MarkdownNodeIterator cur = Adapter::startingNode(node);
-            const MarkdownNodes& collection = Adapter::startingNodeSiblings(node, siblings);
+            SectionParserCursor cursor;
+            size_t parent = pd.markdown.parentOf(siblings);
+
+            begin(pd.markdown.indexOf(parent, node), parent, pd.markdown, cursor);
+
+            while (!step(cursor, pd, out))
+                ;
+
+            return pd.markdown.iterator(cursor.siblings, cursor.next);
+        }
+
+        /**
+         *  \brief  Start parsing a section step by step
+         *  \param  node    Initial node to start parsing at
+         *  \param  parent  Parent of the initial node
+         *  \param  markdown    Flattened Markdown AST of the nodes
+         *  \param  cursor  Output parser state
+         */
+        static void begin(size_t node,
+                          size_t parent,
+                          const FlatMarkdown& markdown,
+                          SectionParserCursor& cursor) {
+
+            cursor.phase = SignatureSectionParserPhase;
+            cursor.layout = DefaultSectionLayout;
+            cursor.node = node;
+            cursor.siblings = parent;
+            cursor.cur = Adapter::startingNode(node, markdown);
+            cursor.collection = Adapter::startingNodeParent(node, parent, markdown);
+            cursor.lastSectionType = UndefinedSectionType;
+            cursor.next = node;
+        }
 
-            // Signature node
-            MarkdownNodeIterator lastCur = cur;
-            cur = SectionProcessor<T>::processSignature(cur, collection, pd, layout, out);
+        /**
+         *  \brief  Parse next node or nested section of a section
+         *  \param  cursor  Parser state of the section
+         *  \param  pd      Parser data
+         *  \param  T       Parsed output
+         *  \return True if the section is parsed, `cursor.next` is the first unparsed block
+         */
+        static bool step(SectionParserCursor& cursor,
+                         SectionParserData& pd,
+                         const ParseResultRef<T>& out) {
 
-            // Exclusive Nested Sections Layout
-            if (layout == ExclusiveNestedSectionLayout) {
+            const FlatMarkdown& markdown = pd.markdown;
+            const MarkdownNodes& collection = markdown.children(cursor.collection);
+            MarkdownNodeIterator cur = markdown.iterator(cursor.collection, cursor.cur);
+            size_t lastCur = cursor.cur;
 
-                cur = parseNestedSections(cur, collection, pd, out);
+            switch (cursor.phase) {
 
-                SectionProcessor<T>::finalize(node, pd, out);
+                case SignatureSectionParserPhase:
 
-                return Adapter::nextStartingNode(node, siblings, cur);
-            }
+                    // Signature node
+                    cur = SectionProcessor<T, Policy>::processSignature(cur, collection, pd, cursor.layout, out);
+                    cursor.cur = markdown.indexOf(cursor.collection, cur);
 
-            // Parser redirect layout
-            if (layout == RedirectSectionLayout) {
-                SectionProcessor<T>::finalize(node, pd, out);
+                    // Fail fast
+                    if (pd.isAborted(out.report))
+                        return done(cursor, markdown);
 
-                return Adapter::nextStartingNode(node, siblings, cur);
-            }
+                    // Exclusive Nested Sections Layout
+                    if (cursor.layout == ExclusiveNestedSectionLayout) {
+                        cursor.phase = NestedSectionParserPhase;
+                        return false;
+                    }
 
-            // Default layout
-            if (lastCur == cur)
-                return Adapter::nextStartingNode(node, siblings, cur);
+                    // Parser redirect layout
+                    if (cursor.layout == RedirectSectionLayout) {
+                        SectionProcessor<T, Policy>::finalize(markdown.iterator(cursor.siblings, cursor.node), pd, out);
+                        return done(cursor, markdown);
+                    }
 
-            // Description nodes
-            while(cur != collection.end() &&
-                  SectionProcessor<T>::isDescriptionNode(cur, pd.sectionContext())) {
+                    // Default layout
+                    if (lastCur == cursor.cur)
+                        return done(cursor, markdown);
 
-                lastCur = cur;
-                cur = SectionProcessor<T>::processDescription(cur, collection, pd, out);
+                    cursor.phase = DescriptionSectionParserPhase;
+                    return false;
 
-                if (lastCur == cur)
-                    return Adapter::nextStartingNode(node, siblings, cur);
-            }
+                case DescriptionSectionParserPhase:
 
-            // Content nodes
-            while(cur != collection.end() &&
-                  SectionProcessor<T>::isContentNode(cur, pd.sectionContext())) {
+                    // Description nodes
+                    if (cursor.cur != NoFlatNode &&
+                        SectionProcessor<T, Policy>::isDescriptionNode(cur, pd.sectionContext())) {
 
-                lastCur = cur;
-                cur = SectionProcessor<T>::processContent(cur, collection, pd, out);
+                        cur = SectionProcessor<T, Policy>::processDescription(cur, collection, pd, out);
+                        cursor.cur = markdown.indexOf(cursor.collection, cur);
 
-                if (lastCur == cur)
-                    return Adapter::nextStartingNode(node, siblings, cur);
-            }
+                        if (lastCur == cursor.cur || pd.isAborted(out.report))
+                            return done(cursor, markdown);
 
-            // Nested Sections
-            cur = parseNestedSections(cur, collection, pd, out);
+                        return false;
+                    }
 
-            SectionProcessor<T>::finalize(node, pd, out);
+                    cursor.phase = ContentSectionParserPhase;
+                    return false;
 
-            return Adapter::nextStartingNode(node, siblings, cur);
-        }
+                case ContentSectionParserPhase:
 
+                    // Content nodes
+                    if (cursor.cur != NoFlatNode &&
+                        SectionProcessor<T, Policy>::isContentNode(cur, pd.sectionContext())) {
 
-        /** Parse nested sections */
-        static MarkdownNodeIterator parseNestedSections(const MarkdownNodeIterator& node,
-                                                        const MarkdownNodes& collection,
-                                                        SectionParserData& pd,
-                                                        const ParseResultRef<T>& out) {
+                        cur = SectionProcessor<T, Policy>::processContent(cur, collection, pd, out);
+                        cursor.cur = markdown.indexOf(cursor.collection, cur);
 
-            MarkdownNodeIterator cur = node;
-            MarkdownNodeIterator lastCur = cur;
+                        if (lastCur == cursor.cur || pd.isAborted(out.report))
+                            return done(cursor, markdown);
 
-            SectionType lastSectionType = UndefinedSectionType;
+                        return false;
+                    }
 
-            // Nested sections
-            while(cur != collection.end()) {
+                    cursor.phase = NestedSectionParserPhase;
+                    return false;
 
-                lastCur = cur;
-                SectionType nestedType = SectionProcessor<T>::nestedSectionType(cur);
+                case NestedSectionParserPhase:
 
-                pd.sectionsContext.push_back(nestedType);
+                    // Nested sections
+                    if (cursor.cur != NoFlatNode) {
 
-                if (nestedType != UndefinedSectionType) {
-                    cur = SectionProcessor<T>::processNestedSection(cur, collection, pd, out);
-                }
-                else if (Adapter::nextSkipsUnexpected ||
-                         SectionProcessor<T>::isUnexpectedNode(cur, pd.sectionContext())) {
+                        SectionType nestedType = beginNestedSection(cursor, pd);
 
-                    cur = SectionProcessor<T>::processUnexpectedNode(cur, collection, pd, lastSectionType, out);
-                }
+                        if (nestedType != UndefinedSectionType) {
+                            cur = SectionProcessor<T, Policy>::processNestedSection(cur, collection, pd, out);
+                        }
+                        else if (Adapter::nextSkipsUnexpected ||
+                                 SectionProcessor<T, Policy>::isUnexpectedNode(cur, pd.sectionContext())) {
 
-                if (cur != collection.end() &&
-                    (pd.sectionContext() != UndefinedSectionType ||
-                     (cur->type != mdp::ParagraphMarkdownNodeType &&
-                      cur->type != mdp::CodeMarkdownNodeType))) {
+                            cur = SectionProcessor<T, Policy>::processUnexpectedNode(cur, collection, pd, cursor.lastSectionType, out);
+                        }
 
-                    lastSectionType = pd.sectionContext();
-                }
+                        endNestedSection(cursor, markdown.indexOf(cursor.collection, cur), pd, out);
+                        return false;
+                    }
 
-                pd.sectionsContext.pop_back();
+                    cursor.phase = FinalizeSectionParserPhase;
+                    return false;
 
-                if (lastCur == cur)
-                    break;
+                case FinalizeSectionParserPhase:
+
+                    if (!pd.isAborted(out.report))
+                        SectionProcessor<T, Policy>::finalize(markdown.iterator(cursor.siblings, cursor.node), pd, out);
+
+                    return done(cursor, markdown);
+
+                default:
+                    return true;
             }
+        }
 
-            return cur;
+
+        /**
+         *  \brief  Enter the nested section at the cursor
+         *  \return Type of the nested section, the section context
+         */
+        static SectionType beginNestedSection(const SectionParserCursor& cursor,
+                                              SectionParserData& pd) {
+
+            MarkdownNodeIterator cur = pd.markdown.iterator(cursor.collection, cursor.cur);
+            SectionType nestedType = SectionProcessor<T, Policy>::nestedSectionType(cur);
+            pd.sectionsContext.push_back(nestedType);
+
+            return nestedType;
+        }
+
+        /**
+         *  \brief  Leave the nested section entered by beginNestedSection()
+         *  \param  cursor  Parser state of the section
+         *  \param  cur     First block after the nested section
+         */
+        static void endNestedSection(SectionParserCursor& cursor,
+                                     size_t cur,
+                                     SectionParserData& pd,
+                                     const ParseResultRef<T>& out) {
+
+            if (cur != NoFlatNode &&
+                (pd.sectionContext() != UndefinedSectionType ||
+                 (pd.markdown.nodes[cur].type != mdp::ParagraphMarkdownNodeType &&
+                  pd.markdown.nodes[cur].type != mdp::CodeMarkdownNodeType))) {
+
+                cursor.lastSectionType = pd.sectionContext();
+            }
+
+            pd.sectionsContext.pop_back();
+
+            if (cursor.cur == cur || pd.isAborted(out.report))
+                cursor.phase = FinalizeSectionParserPhase;
+
+            cursor.cur = cur;
+        }
+
+    private:
+
+        /** Finish the section, \return True */
+        static bool done(SectionParserCursor& cursor, const FlatMarkdown& markdown) {
+            cursor.phase = DoneSectionParserPhase;
+            cursor.next = Adapter::nextStartingNode(cursor.node, cursor.cur, markdown);
+
+            return true;
         }
     };
 
@@ -146,23 +273,25 @@ namespace snowcrash {
     struct HeaderSectionAdapter {
 
         /** \return Node to start parsing with */
-        static const MarkdownNodeIterator startingNode(const MarkdownNodeIterator& seed) {
-            if (seed->type != mdp::HeaderMarkdownNodeType)
+        static size_t startingNode(size_t seed,
+                                   const FlatMarkdown& markdown) {
+            if (seed == NoFlatNode || markdown.nodes[seed].type != mdp::HeaderMarkdownNodeType)
                 throw ADAPTER_MISMATCH_ERR;
 
             return seed;
         }
 
-        /** \return Collection of siblings to starting Node */
-        static const MarkdownNodes& startingNodeSiblings(const MarkdownNodeIterator& seed,
-                                                         const MarkdownNodes& siblings) {
-            return siblings;
+        /** \return Parent of the siblings of starting Node */
+        static size_t startingNodeParent(size_t seed,
+                                         size_t parent,
+                                         const FlatMarkdown& markdown) {
+            return parent;
         }
 
         /** \return Starting node for next parsing */
-        static const MarkdownNodeIterator nextStartingNode(const MarkdownNodeIterator& seed,
-                                                           const MarkdownNodes& siblings,
-                                                           const MarkdownNodeIterator& cur) {
+        static size_t nextStartingNode(size_t seed,
+                                       size_t cur,
+                                       const FlatMarkdown& markdown) {
             return cur;
         }
 
@@ -178,25 +307,27 @@ namespace snowcrash {
     /** Parser Adapter for parsing list-defined sections */
     struct ListSectionAdapter {
 
-        static const MarkdownNodeIterator startingNode(const MarkdownNodeIterator& seed) {
-            if (seed->type != mdp::ListItemMarkdownNodeType)
+        static size_t startingNode(size_t seed,
+                                   const FlatMarkdown& markdown) {
+            if (seed == NoFlatNode || markdown.nodes[seed].type != mdp::ListItemMarkdownNodeType)
                 throw ADAPTER_MISMATCH_ERR;
 
-            return seed->children().begin();
+            return markdown.nodes[seed].firstChild;
         }
 
-        static const MarkdownNodes& startingNodeSiblings(const MarkdownNodeIterator& seed,
-                                                         const MarkdownNodes& siblings) {
-            return seed->children();
+        static size_t startingNodeParent(size_t seed,
+                                         size_t parent,
+                                         const FlatMarkdown& markdown) {
+            return seed;
         }
 
-        static const MarkdownNodeIterator nextStartingNode(const MarkdownNodeIterator& seed,
-                                                           const MarkdownNodes& siblings,
-                                                           const MarkdownNodeIterator& cur) {
-            if (seed == siblings.end())
+        static size_t nextStartingNode(size_t seed,
+                                       size_t cur,
+                                       const FlatMarkdown& markdown) {
+            if (seed == NoFlatNode)
                 return seed;
 
-            return ++MarkdownNodeIterator(seed);
+            return markdown.nodes[seed].nextSibling;
         }
 
         static const bool nextSkipsUnexpected = true;
@@ -206,20 +337,22 @@ namespace snowcrash {
     struct BlueprintSectionAdapter {
 
         /** \return Node to start parsing with */
-        static const MarkdownNodeIterator startingNode(const MarkdownNodeIterator& seed) {
+        static size_t startingNode(size_t seed,
+                                   const FlatMarkdown& markdown) {
             return seed;
         }
 
-        /** \return Collection of siblings to starting Node */
-        static const MarkdownNodes& startingNodeSiblings(const MarkdownNodeIterator& seed,
-                                                         const MarkdownNodes& siblings) {
-            return siblings;
+        /** \return Parent of the siblings of starting Node */
+        static size_t startingNodeParent(size_t seed,
+                                         size_t parent,
+                                         const FlatMarkdown& markdown) {
+            return parent;
         }
 
         /** \return Starting node for next parsing */
-        static const MarkdownNodeIterator nextStartingNode(const MarkdownNodeIterator& seed,
-                                                           const MarkdownNodes& siblings,
-                                                           const MarkdownNodeIterator& cur) {
+        static size_t nextStartingNode(size_t seed,
+                                       size_t cur,
+                                       const FlatMarkdown& markdown) {
             return cur;
         }
 
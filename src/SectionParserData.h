@@ -10,8 +10,11 @@
 #define SNOWCRASH_SECTIONPARSERDATA_H
 
 #include "BlueprintSourcemap.h"
+#include "FlatMarkdown.h"
 #include "Section.h"
 #include "SymbolTable.h"
+#include "SourceAnnotation.h"
+#include "UriTemplateParser.h"
 
 namespace snowcrash {
 
@@ -23,11 +26,36 @@ namespace snowcrash {
     enum BlueprintParserOption {
         RenderDescriptionsOption = (1 << 0),    /// < Render Markdown in description.
         RequireBlueprintNameOption = (1 << 1),  /// < Treat missing blueprint name as error
-        ExportSourcemapOption = (1 << 2)        /// < Export source maps AST
+        ExportSourcemapOption = (1 << 2),       /// < Export source maps AST
+        AbortOnErrorOption = (1 << 3),          /// < Stop parsing on the first error
+        ValidateOnlyOption = (1 << 4)           /// < Produce the report only, the AST is incomplete
     };
 
     typedef unsigned int BlueprintParserOptions;
 
+    /**
+     *  \brief Parser Report Options.
+     *
+     *  Controls which warnings are kept in the parser report.
+     *  Warnings that are not kept are neither formatted nor
+     *  their source map converted.
+     */
+    struct ReportOptions {
+        ReportOptions()
+        : suppressedWarnings(0), maxWarnings(0) {}
+
+        /** Suppressed warnings, a mask of `WarningCodeMask()` */
+        unsigned int suppressedWarnings;
+
+        /** Maximum number of warnings kept, 0 for unlimited */
+        size_t maxWarnings;
+    };
+
+    /** \returns Report options mask bit of a warning code */
+    inline unsigned int WarningCodeMask(WarningCode code) {
+        return 1u << code;
+    }
+
     /**
      *  \brief Section Parser Data
      *
@@ -36,24 +64,34 @@ namespace snowcrash {
     struct SectionParserData {
         SectionParserData(BlueprintParserOptions opts,
                           const mdp::ByteBuffer& src,
-                          const Blueprint& bp)
-        : options(opts), sourceData(src), blueprint(bp) {}
+                          const Blueprint& bp,
+                          const FlatMarkdown& md)
+        : options(opts), sourceData(src), blueprint(bp), markdown(md) {}
 
         /** Parser Options */
         BlueprintParserOptions options;
 
+        /** Report Options */
+        ReportOptions reportOptions;
+
         /** Symbol Table */
         SymbolTable symbolTable;
 
         /** Symbol Table Sourcemap */
         SymbolSourceMapTable symbolSourceMapTable;
 
+        /** URI templates parsed before, a template is parsed once per blueprint */
+        ParsedURITemplates uriTemplates;
+
         /** Source Data */
         const mdp::ByteBuffer& sourceData;
 
         /** AST being parsed **/
         const Blueprint& blueprint;
 
+        /** Flattened Markdown AST being parsed */
+        const FlatMarkdown& markdown;
+
         /** Sections Context */
         typedef std::vector<SectionType> SectionsStack;
         SectionsStack sectionsContext;
@@ -77,7 +115,32 @@ namespace snowcrash {
 
         /** \returns True if exporting source maps */
         bool exportSourceMap() const {
-            return options & ExportSourcemapOption;
+            return (options & ExportSourcemapOption) && !validateOnly();
+        }
+
+        /**
+         *  \returns True if only the report is produced
+         *
+         *  Descriptions are kept only as far as their presence is concerned,
+         *  referenced models are not copied into their payloads.
+         */
+        bool validateOnly() const {
+            return (options & ValidateOnlyOption) != 0;
+        }
+
+        /** \returns True if a warning of given code is to be added to the report */
+        bool reportsWarning(const Report& report, WarningCode code) const {
+
+            if (reportOptions.suppressedWarnings & WarningCodeMask(code))
+                return false;
+
+            return reportOptions.maxWarnings == 0 ||
+                   report.warnings.size() < reportOptions.maxWarnings;
+        }
+
+        /** \returns True if parsing is to be stopped because of an error */
+        bool isAborted(const Report& report) const {
+            return (options & AbortOnErrorOption) && report.error.code != Error::OK;
         }
 
     private:
@@ -30,6 +30,45 @@ namespace snowcrash {
         RedirectSectionLayout          /// Section should be parsed by another parser as whole
     };
 
+    /**
+     *  \brief Source map policy exporting source maps on demand
+     *
+     *  Source maps are built only if the %ExportSourcemapOption
+     *  option is set.
+     */
+    struct SourceMapPolicy {
+
+        /** \returns True if exporting source maps */
+        static bool exportSourceMap(const SectionParserData& pd) {
+            return pd.exportSourceMap();
+        }
+    };
+
+    /**
+     *  \brief Source map policy never exporting source maps
+     *
+     *  All of the source map processing is compiled away.
+     */
+    struct NoSourceMapPolicy {
+
+        /** \returns True if exporting source maps */
+        static bool exportSourceMap(const SectionParserData& pd) {
+            return false;
+        }
+    };
+
+    /**
+     *  \brief Source map shared by all intermediate results of %NoSourceMapPolicy parsers
+     *
+     *  No source map is ever written when parsing with %NoSourceMapPolicy,
+     *  hence its parsers refer to this instance instead of owning a source map.
+     */
+    template<typename T>
+    inline SourceMap<T>& NullSourceMap() {
+        static SourceMap<T> sourceMap;
+        return sourceMap;
+    }
+
     /**
      *  \brief Complete compound product of parsing
      *
@@ -55,7 +94,7 @@ namespace snowcrash {
      *  Unlike %ParseResult it relies on shared parser report data making it
      *  ideal for holding temporary results while parsing items of a collection.
      */
-    template<typename T>
+    template<typename T, typename Policy = SourceMapPolicy>
     struct IntermediateParseResult {
 
         explicit IntermediateParseResult(Report& report_)
@@ -66,6 +105,22 @@ namespace snowcrash {
         SourceMap<T> sourceMap;
     };
 
+    /**
+     *  \brief Partial product of parsing without source map.
+     *
+     *  Does not own a source map, refers to the %NullSourceMap instead.
+     */
+    template<typename T>
+    struct IntermediateParseResult<T, NoSourceMapPolicy> {
+
+        explicit IntermediateParseResult(Report& report_)
+        : report(report_), sourceMap(NullSourceMap<T>()) {}
+
+        Report& report;
+        T node;
+        SourceMap<T>& sourceMap;
+    };
+
     /**
      *  \brief Reference wrapper for parsing data product
      *
@@ -77,7 +132,8 @@ namespace snowcrash {
         ParseResultRef(ParseResult<T>& parseResult)
         : report(parseResult.report), node(parseResult.node), sourceMap(parseResult.sourceMap) {}
 
-        ParseResultRef(IntermediateParseResult<T>& parseResult)
+        template<typename Policy>
+        ParseResultRef(IntermediateParseResult<T, Policy>& parseResult)
         : report(parseResult.report), node(parseResult.node), sourceMap(parseResult.sourceMap) {}
 
         ParseResultRef(Report& report_, T& node_, SourceMap<T>& sourceMap_)
@@ -94,16 +150,17 @@ namespace snowcrash {
     /*
      * Forward Declarations
      */
-    template<typename T>
+    template<typename T, typename Policy = SourceMapPolicy>
     struct SectionProcessor;
 
     /**
      *  \brief  Section Processor Base
      *
      *  Defines section processor interface alongised with its default
-     *  behavior.
+     *  behavior. The source map policy decides whether the processor
+     *  builds source maps.
      */
-    template<typename T>
+    template<typename T, typename Policy = SourceMapPolicy>
     struct SectionProcessorBase {
 
         /**
@@ -131,12 +188,17 @@ namespace snowcrash {
                                                        const ParseResultRef<T>& out) {
 
             if (!out.node.description.empty()) {
+
+                // Validation checks only presence of the description
+                if (pd.validateOnly())
+                    return ++MarkdownNodeIterator(node);
+
                 TwoNewLines(out.node.description);
             }
 
             mdp::ByteBuffer content = mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
 
-            if (pd.exportSourceMap() && !content.empty()) {
+            if (Policy::exportSourceMap(pd) && !content.empty()) {
                 out.sourceMap.description.sourceMap.append(node->sourceMap);
             }
 
@@ -178,19 +240,22 @@ namespace snowcrash {
                                                           const ParseResultRef<T>& out) {
 
             // WARN: Ignoring unexpected node
-            std::stringstream ss;
-            mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-
-            if (node->type == mdp::HeaderMarkdownNodeType) {
-                ss << "unexpected header block, expected a group, resource or an action definition";
-                ss << ", e.g. '# Group <name>', '# <resource name> [<URI>]' or '# <HTTP method> <URI>'";
-            } else {
-                ss << "ignoring unrecognized block";
-            }
+            if (pd.reportsWarning(out.report, IgnoringWarning)) {
+
+                std::stringstream ss;
+                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
 
-            out.report.warnings.push_back(Warning(ss.str(),
-                                                  IgnoringWarning,
-                                                  sourceMap));
+                if (node->type == mdp::HeaderMarkdownNodeType) {
+                    ss << "unexpected header block, expected a group, resource or an action definition";
+                    ss << ", e.g. '# Group <name>', '# <resource name> [<URI>]' or '# <HTTP method> <URI>'";
+                } else {
+                    ss << "ignoring unrecognized block";
+                }
+
+                out.report.warnings.push_back(Warning(ss.str(),
+                                                      IgnoringWarning,
+                                                      sourceMap));
+            }
 
             return ++MarkdownNodeIterator(node);
         }
@@ -205,8 +270,8 @@ namespace snowcrash {
         static bool isDescriptionNode(const MarkdownNodeIterator& node,
                                       SectionType sectionType) {
 
-            if (SectionProcessor<T>::isContentNode(node, sectionType) ||
-                SectionProcessor<T>::nestedSectionType(node) != UndefinedSectionType) {
+            if (SectionProcessor<T, Policy>::isContentNode(node, sectionType) ||
+                SectionProcessor<T, Policy>::nestedSectionType(node) != UndefinedSectionType) {
 
                 return false;
             }
@@ -217,7 +282,7 @@ namespace snowcrash {
                 return true;
             }
 
-            SectionTypes nestedTypes = SectionProcessor<T>::nestedSectionTypes();
+            SectionTypes nestedTypes = SectionProcessor<T, Policy>::nestedSectionTypes();
 
             if (std::find(nestedTypes.begin(), nestedTypes.end(), keywordSectionType) != nestedTypes.end()) {
                 // Node is a keyword defined section defined in one of the nested sections
@@ -239,7 +304,7 @@ namespace snowcrash {
                                      SectionType sectionType) {
 
             SectionType keywordSectionType = SectionKeywordSignature(node);
-            SectionTypes nestedTypes = SectionProcessor<T>::nestedSectionTypes();
+            SectionTypes nestedTypes = SectionProcessor<T, Policy>::nestedSectionTypes();
 
             if (std::find(nestedTypes.begin(), nestedTypes.end(), keywordSectionType) != nestedTypes.end()) {
                 return true;
@@ -267,8 +332,8 @@ namespace snowcrash {
     /**
      *  Default Section Processor
      */
-    template<typename T>
-    struct SectionProcessor : public SectionProcessorBase<T> {
+    template<typename T, typename Policy>
+    struct SectionProcessor : public SectionProcessorBase<T, Policy> {
     };
 }
 
@@ -42,6 +42,13 @@ const std::string SerializeKey::Required = "required";
 const std::string SerializeKey::Default = "default";
 const std::string SerializeKey::Example = "example";
 const std::string SerializeKey::Values = "values";
+const std::string SerializeKey::AST = "ast";
+const std::string SerializeKey::SourceMap = "sourcemap";
+const std::string SerializeKey::Group = "group";
+const std::string SerializeKey::Resource = "resource";
+const std::string SerializeKey::Transactions = "transactions";
+const std::string SerializeKey::Request = "request";
+const std::string SerializeKey::Response = "response";
 
 std::string snowcrash::EscapeNewlines(const std::string& input)
 {
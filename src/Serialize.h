@@ -16,6 +16,16 @@
 
 namespace snowcrash {
 
+    /**
+     *  \brief AST Serialization Options.
+     */
+    enum SerializeOption {
+        CompactSerializeOption = (1 << 0),  /// < Omit insignificant whitespace
+        ParallelSerializeOption = (1 << 1)  /// < Serialize resource groups on all processors
+    };
+
+    typedef unsigned int SerializeOptions;
+
     /**
      *  \brief  Escape new lines in input string.
      *  \param  input   A string to escape its new lines.
@@ -64,6 +74,13 @@ namespace snowcrash {
         static const std::string Default;
         static const std::string Example;
         static const std::string Values;
+        static const std::string AST;
+        static const std::string SourceMap;
+        static const std::string Group;
+        static const std::string Resource;
+        static const std::string Transactions;
+        static const std::string Request;
+        static const std::string Response;
 
     };
 }
@@ -0,0 +1,363 @@
+//
+//  SerializeCBOR.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <vector>
+#include "SerializeCBOR.h"
+#include "BlueprintVisitor.h"
+#include "BufferedWriter.h"
+#include "DeserializeBlueprint.h"
+
+using namespace snowcrash;
+
+/** Maximum nesting of arrays and maps */
+static const size_t MaxNestingDepth = 512;
+
+/** CBOR major types */
+enum CBORMajorType {
+    UnsignedCBORMajorType = 0,
+    NegativeCBORMajorType = 1,
+    BytesCBORMajorType = 2,
+    TextCBORMajorType = 3,
+    ArrayCBORMajorType = 4,
+    MapCBORMajorType = 5,
+    TagCBORMajorType = 6,
+    SimpleCBORMajorType = 7
+};
+
+/** CBOR simple values */
+static const unsigned char CBORFalse = 0xF4;
+static const unsigned char CBORTrue = 0xF5;
+static const unsigned char CBORNull = 0xF6;
+static const unsigned char CBORUndefined = 0xF7;
+
+/** Additional information of a head followed by a 1 byte argument */
+static const unsigned char CBOROneByte = 24;
+
+/** Additional information of a head followed by an 8 byte argument */
+static const unsigned char CBOREightBytes = 27;
+
+/**
+ *  \brief CBOR emitter of the token events of a blueprint visit.
+ */
+class CBOREmitter : public BufferedWriter {
+public:
+    explicit CBOREmitter(std::ostream& os)
+    : BufferedWriter(os) {}
+
+    /** Emitter of an item of an array, CBOR items do not depend on their position */
+    CBOREmitter(std::ostream& os, const CBOREmitter&, size_t)
+    : BufferedWriter(os) {}
+
+    void beginObject(size_t size) {
+        head(MapCBORMajorType, size);
+    }
+
+    void endObject() {}
+
+    void beginArray(size_t size) {
+        head(ArrayCBORMajorType, size);
+    }
+
+    void endArray() {}
+
+    void key(const std::string& key) {
+        string(key);
+    }
+
+    void string(const std::string& value) {
+        head(TextCBORMajorType, value.size());
+        write(value.data(), value.size());
+    }
+
+    void literal(const std::string& value) {
+        string(value);
+    }
+
+    void boolean(bool value) {
+        put((value) ? CBORTrue : CBORFalse);
+    }
+
+    void sourceMap(const SourceMapBase& value) {
+        head(ArrayCBORMajorType, value.sourceMap.size());
+
+        for (mdp::RangeSet<mdp::BytesRange>::const_iterator it = value.sourceMap.begin(); it != value.sourceMap.end(); ++it) {
+
+            head(ArrayCBORMajorType, 2);
+            head(UnsignedCBORMajorType, it->location);
+            head(UnsignedCBORMajorType, it->length);
+        }
+    }
+
+private:
+
+    /** Write a head with the shortest encoding of its argument */
+    void head(CBORMajorType type, size_t value) {
+        unsigned char major = static_cast<unsigned char>(type << 5);
+
+        if (value < CBOROneByte) {
+            put(static_cast<char>(major | value));
+            return;
+        }
+
+        // Arguments of 1, 2, 4 and 8 bytes in big-endian byte order
+        unsigned char info = CBOROneByte;
+        size_t bytes = 1;
+
+        if (value > 0xFF) {
+            info = CBOROneByte + 1;
+            bytes = 2;
+        }
+
+        if (value > 0xFFFF) {
+            info = CBOROneByte + 2;
+            bytes = 4;
+        }
+
+        if ((value >> 16 >> 16) != 0) {
+            info = CBOREightBytes;
+            bytes = 8;
+        }
+
+        char argument[8];
+
+        for (size_t i = bytes; i-- > 0; value >>= 8) {
+            argument[i] = static_cast<char>(value & 0xFF);
+        }
+
+        put(static_cast<char>(major | info));
+        write(argument, bytes);
+    }
+};
+
+/**
+ *  \brief Pull CBOR reader.
+ *
+ *  Reads definite-length items, map keys have to be text strings.
+ *  Malformed input throws an `Error`, offset() then points at the
+ *  offending byte.
+ */
+class CBORReader {
+public:
+    CBORReader(const char* data, size_t size)
+    : begin(data), end(data + size), p(data) {}
+
+    void beginObject() {
+        beginContainer(MapCBORMajorType, "expected map");
+    }
+
+    bool nextMember(std::string& key) {
+        if (!nextInContainer())
+            return false;
+
+        readString(key);
+        return true;
+    }
+
+    void beginArray() {
+        beginContainer(ArrayCBORMajorType, "expected array");
+    }
+
+    bool nextItem() {
+        return nextInContainer();
+    }
+
+    void readString(std::string& value) {
+        size_t length = readHead(TextCBORMajorType, "expected text string");
+        value.assign(readBytes(length), length);
+    }
+
+    bool readBoolean() {
+        if (p != end && static_cast<unsigned char>(*p) == CBORTrue) {
+            ++p;
+            return true;
+        }
+
+        if (p != end && static_cast<unsigned char>(*p) == CBORFalse) {
+            ++p;
+            return false;
+        }
+
+        fail("expected boolean");
+        return false;
+    }
+
+    size_t readNumber() {
+        return readHead(UnsignedCBORMajorType, "expected non-negative integer");
+    }
+
+    void skipValue() {
+
+        // Tags of the value, skipped without nesting
+        while (p != end && static_cast<unsigned char>(*p) >> 5 == TagCBORMajorType)
+            readHead(TagCBORMajorType, "expected tag");
+
+        if (p == end)
+            fail("expected value");
+
+        switch (static_cast<unsigned char>(*p) >> 5) {
+            case UnsignedCBORMajorType:
+            case NegativeCBORMajorType:
+                readHead(static_cast<CBORMajorType>(static_cast<unsigned char>(*p) >> 5), "expected integer");
+                break;
+
+            case BytesCBORMajorType:
+            case TextCBORMajorType:
+                readBytes(readHead(static_cast<CBORMajorType>(static_cast<unsigned char>(*p) >> 5), "expected string"));
+                break;
+
+            case ArrayCBORMajorType:
+                beginArray();
+
+                while (nextItem())
+                    skipValue();
+
+                break;
+
+            case MapCBORMajorType:
+            {
+                beginObject();
+
+                while (nextInContainer()) {
+                    skipValue();
+                    skipValue();
+                }
+
+                break;
+            }
+
+            default:
+                skipSimple();
+        }
+    }
+
+    void finish() {
+        if (p != end)
+            fail("unexpected data after CBOR item");
+    }
+
+    size_t offset() const {
+        return p - begin;
+    }
+
+private:
+    const char* begin;
+    const char* end;
+    const char* p;
+
+    /** Opened containers, number of members or items left to read */
+    std::vector<size_t> containers;
+
+    void fail(const std::string& message) {
+        throw Error(message, BusinessError);
+    }
+
+    /** \return Argument of a head of given major type */
+    size_t readHead(CBORMajorType type, const char* message) {
+        if (p == end || static_cast<unsigned char>(*p) >> 5 != type)
+            fail(message);
+
+        unsigned char info = static_cast<unsigned char>(*p) & 0x1F;
+
+        if (info < CBOROneByte) {
+            ++p;
+            return info;
+        }
+
+        if (info > CBOREightBytes)
+            fail("indefinite-length items are not supported");
+
+        size_t bytes = static_cast<size_t>(1) << (info - CBOROneByte);
+
+        if (static_cast<size_t>(end - p) <= bytes)
+            fail("unexpected end of input");
+
+        ++p;
+        size_t value = 0;
+
+        for (size_t i = 0; i < bytes; ++i, ++p) {
+
+            if ((value >> (sizeof(size_t) * 8 - 8)) != 0)
+                fail("integer overflow");
+
+            value = (value << 8) | static_cast<unsigned char>(*p);
+        }
+
+        return value;
+    }
+
+    /** \return Beginning of next `length` bytes, skipped */
+    const char* readBytes(size_t length) {
+        if (static_cast<size_t>(end - p) < length)
+            fail("unexpected end of input");
+
+        const char* bytes = p;
+        p += length;
+
+        return bytes;
+    }
+
+    /** Skip a simple value or a floating-point number */
+    void skipSimple() {
+        unsigned char c = static_cast<unsigned char>(*p);
+
+        if (c == CBORFalse || c == CBORTrue || c == CBORNull || c == CBORUndefined) {
+            ++p;
+            return;
+        }
+
+        // Half, single and double precision numbers
+        if (c >= 0xF9 && c <= 0xFB) {
+            ++p;
+            readBytes(static_cast<size_t>(1) << (c - 0xF8));
+            return;
+        }
+
+        fail("expected value");
+    }
+
+    void beginContainer(CBORMajorType type, const char* message) {
+        if (containers.size() == MaxNestingDepth)
+            fail("maximum nesting depth exceeded");
+
+        containers.push_back(readHead(type, message));
+    }
+
+    bool nextInContainer() {
+        if (containers.back() == 0) {
+            containers.pop_back();
+            return false;
+        }
+
+        --containers.back();
+        return true;
+    }
+};
+
+void snowcrash::SerializeCBOR(const Blueprint& blueprint, std::ostream& os, SerializeOptions options)
+{
+    CBOREmitter emitter(os);
+    VisitBlueprint(blueprint, emitter, options);
+}
+
+void snowcrash::SerializeSourceMapCBOR(const SourceMap<Blueprint>& sourceMap, std::ostream& os, SerializeOptions options)
+{
+    CBOREmitter emitter(os);
+    VisitSourceMap(sourceMap, emitter, options);
+}
+
+int snowcrash::DeserializeCBOR(const mdp::ByteBuffer& source, Blueprint& blueprint, Report& report)
+{
+    CBORReader reader(source.data(), source.size());
+    return BlueprintDeserializer<CBORReader>::read(reader, blueprint, report);
+}
+
+int snowcrash::DeserializeSourceMapCBOR(const mdp::ByteBuffer& source, SourceMap<Blueprint>& sourceMap, Report& report)
+{
+    CBORReader reader(source.data(), source.size());
+    return BlueprintDeserializer<CBORReader>::read(reader, sourceMap, report);
+}
@@ -0,0 +1,64 @@
+//
+//  SerializeCBOR.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_SERIALIZE_CBOR_H
+#define SNOWCRASH_SERIALIZE_CBOR_H
+
+#include <ostream>
+#include "BlueprintSourcemap.h"
+#include "Serialize.h"
+#include "SourceAnnotation.h"
+
+/**
+ *  CBOR Serialization
+ *  ------------------
+ *
+ *  API Blueprint AST and its source map in CBOR (RFC 7049). The document
+ *  has the structure and the keys of the JSON serialization, objects are
+ *  definite-length maps with text keys, source map ranges are arrays of
+ *  [location, length] unsigned integer pairs.
+ */
+
+namespace snowcrash {
+
+    /**
+     *  \brief  Serialize API Blueprint AST into CBOR
+     *  \param  blueprint   A blueprint AST to serialize
+     *  \param  os          An output stream to serialize into
+     *  \param  options     Serialization options, CompactSerializeOption has no effect
+     */
+    void SerializeCBOR(const Blueprint& blueprint, std::ostream& os, SerializeOptions options = 0);
+
+    /**
+     *  \brief  Serialize source map of API Blueprint AST into CBOR
+     *  \param  sourceMap   A source map to serialize
+     *  \param  os          An output stream to serialize into
+     *  \param  options     Serialization options, CompactSerializeOption has no effect
+     */
+    void SerializeSourceMapCBOR(const SourceMap<Blueprint>& sourceMap, std::ostream& os, SerializeOptions options = 0);
+
+    /**
+     *  \brief  Deserialize API Blueprint AST from CBOR
+     *  \param  source      CBOR as produced by SerializeCBOR()
+     *  \param  blueprint   Output blueprint AST
+     *  \param  report      Output report, error location is a byte offset of the source
+     *  \return Error code
+     */
+    int DeserializeCBOR(const mdp::ByteBuffer& source, Blueprint& blueprint, Report& report);
+
+    /**
+     *  \brief  Deserialize source map of API Blueprint AST from CBOR
+     *  \param  source      CBOR as produced by SerializeSourceMapCBOR()
+     *  \param  sourceMap   Output source map
+     *  \param  report      Output report, error location is a byte offset of the source
+     *  \return Error code
+     */
+    int DeserializeSourceMapCBOR(const mdp::ByteBuffer& source, SourceMap<Blueprint>& sourceMap, Report& report);
+}
+
+#endif
@@ -11,14 +11,62 @@
 
 #include <ostream>
 #include "BlueprintSourcemap.h"
+#include "Serialize.h"
 
 namespace snowcrash {
 
     // Naive JSON serialization to ostream
-    void SerializeJSON(const snowcrash::Blueprint& blueprint, std::ostream &os);
+    void SerializeJSON(const snowcrash::Blueprint& blueprint, std::ostream &os, SerializeOptions options = 0);
 
     // Naive Sourcmap JSON serialization to ostream
-    void SerializeSourceMapJSON(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os);
+    void SerializeSourceMapJSON(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os, SerializeOptions options = 0);
+
+    /**
+     *  \brief  Serialize AST and its source map in one walk of both trees
+     *  \param  blueprint   A blueprint AST to serialize
+     *  \param  sourceMap   A source map of the blueprint
+     *  \param  os          An output stream for the AST
+     *  \param  sourceMapOS An output stream for the source map, other than `os`
+     *  \param  options     Serialization options
+     *
+     *  The output is the same as of SerializeJSON() and SerializeSourceMapJSON().
+     */
+    void SerializeJSON(const snowcrash::Blueprint& blueprint,
+                       const snowcrash::SourceMap<snowcrash::Blueprint>& sourceMap,
+                       std::ostream& os,
+                       std::ostream& sourceMapOS,
+                       SerializeOptions options = 0);
+
+    /**
+     *  \brief  Serialize AST and its source map into one document
+     *  \param  blueprint   A blueprint AST to serialize
+     *  \param  sourceMap   A source map of the blueprint
+     *  \param  os          An output stream to serialize into
+     *  \param  options     Serialization options
+     *
+     *  The document is an object with the AST under the `ast` key and
+     *  the source map under the `sourcemap` key. Both are written straight
+     *  into the stream, the source map by a second walk after the AST.
+     */
+    void SerializeCombinedJSON(const snowcrash::Blueprint& blueprint,
+                               const snowcrash::SourceMap<snowcrash::Blueprint>& sourceMap,
+                               std::ostream& os,
+                               SerializeOptions options = 0);
+
+    /**
+     *  \brief  Serialize AST of one resource group into a standalone document
+     *  \param  blueprint   A blueprint AST to serialize
+     *  \param  index       Index of the resource group to serialize
+     *  \param  os          An output stream to serialize into
+     *  \param  options     Serialization options
+     *
+     *  The document is the AST of the blueprint with only the given
+     *  resource group, e.g. for a shard of documentation.
+     */
+    void SerializeResourceGroupJSON(const snowcrash::Blueprint& blueprint,
+                                    size_t index,
+                                    std::ostream& os,
+                                    SerializeOptions options = 0);
 }
 
 #endif
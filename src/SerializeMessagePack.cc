@@ -0,0 +1,405 @@
+//
+//  SerializeMessagePack.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <vector>
+#include "SerializeMessagePack.h"
+#include "BlueprintVisitor.h"
+#include "BufferedWriter.h"
+#include "DeserializeBlueprint.h"
+
+using namespace snowcrash;
+
+/** Maximum nesting of arrays and maps */
+static const size_t MaxNestingDepth = 512;
+
+/** MessagePack formats, first bytes of the items */
+enum MessagePackFormat {
+    FixMapMessagePackFormat = 0x80,
+    FixArrayMessagePackFormat = 0x90,
+    FixStrMessagePackFormat = 0xA0,
+    NilMessagePackFormat = 0xC0,
+    FalseMessagePackFormat = 0xC2,
+    TrueMessagePackFormat = 0xC3,
+    Bin8MessagePackFormat = 0xC4,
+    Ext8MessagePackFormat = 0xC7,
+    Float32MessagePackFormat = 0xCA,
+    Float64MessagePackFormat = 0xCB,
+    UInt8MessagePackFormat = 0xCC,
+    UInt16MessagePackFormat = 0xCD,
+    UInt32MessagePackFormat = 0xCE,
+    UInt64MessagePackFormat = 0xCF,
+    Int8MessagePackFormat = 0xD0,
+    FixExt1MessagePackFormat = 0xD4,
+    Str8MessagePackFormat = 0xD9,
+    Str16MessagePackFormat = 0xDA,
+    Str32MessagePackFormat = 0xDB,
+    Array16MessagePackFormat = 0xDC,
+    Array32MessagePackFormat = 0xDD,
+    Map16MessagePackFormat = 0xDE,
+    Map32MessagePackFormat = 0xDF,
+    NegativeFixIntMessagePackFormat = 0xE0
+};
+
+/**
+ *  \brief MessagePack emitter of the token events of a blueprint visit.
+ */
+class MessagePackEmitter : public BufferedWriter {
+public:
+    explicit MessagePackEmitter(std::ostream& os)
+    : BufferedWriter(os) {}
+
+    /** Emitter of an item of an array, MessagePack items do not depend on their position */
+    MessagePackEmitter(std::ostream& os, const MessagePackEmitter&, size_t)
+    : BufferedWriter(os) {}
+
+    void beginObject(size_t size) {
+        container(FixMapMessagePackFormat, Map16MessagePackFormat, Map32MessagePackFormat, size);
+    }
+
+    void endObject() {}
+
+    void beginArray(size_t size) {
+        container(FixArrayMessagePackFormat, Array16MessagePackFormat, Array32MessagePackFormat, size);
+    }
+
+    void endArray() {}
+
+    void key(const std::string& key) {
+        string(key);
+    }
+
+    void string(const std::string& value) {
+        size_t size = value.size();
+
+        if (size < 32)
+            put(static_cast<char>(FixStrMessagePackFormat | size));
+        else if (size <= 0xFF)
+            format(Str8MessagePackFormat, size, 1);
+        else if (size <= 0xFFFF)
+            format(Str16MessagePackFormat, size, 2);
+        else
+            format(Str32MessagePackFormat, size, 4);
+
+        write(value.data(), size);
+    }
+
+    void literal(const std::string& value) {
+        string(value);
+    }
+
+    void boolean(bool value) {
+        put(static_cast<char>((value) ? TrueMessagePackFormat : FalseMessagePackFormat));
+    }
+
+    void sourceMap(const SourceMapBase& value) {
+        beginArray(value.sourceMap.size());
+
+        for (mdp::RangeSet<mdp::BytesRange>::const_iterator it = value.sourceMap.begin(); it != value.sourceMap.end(); ++it) {
+
+            beginArray(2);
+            number(it->location);
+            number(it->length);
+        }
+    }
+
+private:
+
+    /** Write a format byte followed by its argument in big-endian byte order */
+    void format(MessagePackFormat code, size_t value, size_t bytes) {
+        char argument[8];
+
+        for (size_t i = bytes; i-- > 0; value >>= 8) {
+            argument[i] = static_cast<char>(value & 0xFF);
+        }
+
+        put(static_cast<char>(code));
+        write(argument, bytes);
+    }
+
+    /** Write a map or array header with the shortest encoding of its size */
+    void container(MessagePackFormat fix, MessagePackFormat code16, MessagePackFormat code32, size_t size) {
+        if (size < 16)
+            put(static_cast<char>(fix | size));
+        else if (size <= 0xFFFF)
+            format(code16, size, 2);
+        else
+            format(code32, size, 4);
+    }
+
+    /** Write an unsigned integer with the shortest encoding */
+    void number(size_t value) {
+        if (value < 0x80)
+            put(static_cast<char>(value));
+        else if (value <= 0xFF)
+            format(UInt8MessagePackFormat, value, 1);
+        else if (value <= 0xFFFF)
+            format(UInt16MessagePackFormat, value, 2);
+        else if ((value >> 16 >> 16) == 0)
+            format(UInt32MessagePackFormat, value, 4);
+        else
+            format(UInt64MessagePackFormat, value, 8);
+    }
+};
+
+/**
+ *  \brief Pull MessagePack reader.
+ *
+ *  Map keys have to be strings. Malformed input throws an `Error`,
+ *  offset() then points at the offending byte.
+ */
+class MessagePackReader {
+public:
+    MessagePackReader(const char* data, size_t size)
+    : begin(data), end(data + size), p(data) {}
+
+    void beginObject() {
+        unsigned char c = peek("expected map");
+
+        if ((c & 0xF0) == FixMapMessagePackFormat) {
+            ++p;
+            beginContainer(c & 0x0F);
+        }
+        else if (c == Map16MessagePackFormat)
+            beginContainer(argument(2));
+        else if (c == Map32MessagePackFormat)
+            beginContainer(argument(4));
+        else
+            fail("expected map");
+    }
+
+    bool nextMember(std::string& key) {
+        if (!nextInContainer())
+            return false;
+
+        readString(key);
+        return true;
+    }
+
+    void beginArray() {
+        unsigned char c = peek("expected array");
+
+        if ((c & 0xF0) == FixArrayMessagePackFormat) {
+            ++p;
+            beginContainer(c & 0x0F);
+        }
+        else if (c == Array16MessagePackFormat)
+            beginContainer(argument(2));
+        else if (c == Array32MessagePackFormat)
+            beginContainer(argument(4));
+        else
+            fail("expected array");
+    }
+
+    bool nextItem() {
+        return nextInContainer();
+    }
+
+    void readString(std::string& value) {
+        unsigned char c = peek("expected string");
+        size_t length = 0;
+
+        if ((c & 0xE0) == FixStrMessagePackFormat) {
+            length = c & 0x1F;
+            ++p;
+        }
+        else if (c >= Str8MessagePackFormat && c <= Str32MessagePackFormat) {
+            length = argument(static_cast<size_t>(1) << (c - Str8MessagePackFormat));
+        }
+        else {
+            fail("expected string");
+        }
+
+        value.assign(readBytes(length), length);
+    }
+
+    bool readBoolean() {
+        unsigned char c = peek("expected boolean");
+
+        if (c != TrueMessagePackFormat && c != FalseMessagePackFormat)
+            fail("expected boolean");
+
+        ++p;
+        return c == TrueMessagePackFormat;
+    }
+
+    size_t readNumber() {
+        unsigned char c = peek("expected non-negative integer");
+
+        // Positive fixint
+        if (c < FixMapMessagePackFormat) {
+            ++p;
+            return c;
+        }
+
+        if (c >= UInt8MessagePackFormat && c <= UInt64MessagePackFormat)
+            return argument(static_cast<size_t>(1) << (c - UInt8MessagePackFormat));
+
+        fail("expected non-negative integer");
+        return 0;
+    }
+
+    void skipValue() {
+        unsigned char c = peek("expected value");
+
+        if (c < FixMapMessagePackFormat || c >= NegativeFixIntMessagePackFormat ||
+            c == NilMessagePackFormat || c == FalseMessagePackFormat || c == TrueMessagePackFormat) {
+
+            ++p;
+        }
+        else if ((c & 0xF0) == FixMapMessagePackFormat || c == Map16MessagePackFormat || c == Map32MessagePackFormat) {
+
+            beginObject();
+
+            while (nextInContainer()) {
+                skipValue();
+                skipValue();
+            }
+        }
+        else if ((c & 0xF0) == FixArrayMessagePackFormat || c == Array16MessagePackFormat || c == Array32MessagePackFormat) {
+
+            beginArray();
+
+            while (nextItem())
+                skipValue();
+        }
+        else if ((c & 0xE0) == FixStrMessagePackFormat || (c >= Str8MessagePackFormat && c <= Str32MessagePackFormat)) {
+
+            std::string value;
+            readString(value);
+        }
+        else if (c >= Bin8MessagePackFormat && c < Ext8MessagePackFormat) {
+
+            readBytes(argument(static_cast<size_t>(1) << (c - Bin8MessagePackFormat)));
+        }
+        else if (c >= Ext8MessagePackFormat && c < Float32MessagePackFormat) {
+
+            // Extension type follows the size
+            size_t length = argument(static_cast<size_t>(1) << (c - Ext8MessagePackFormat));
+            readBytes(length + 1);
+        }
+        else if (c == Float32MessagePackFormat || c == Float64MessagePackFormat) {
+
+            ++p;
+            readBytes((c == Float32MessagePackFormat) ? 4 : 8);
+        }
+        else if (c >= UInt8MessagePackFormat && c < FixExt1MessagePackFormat) {
+
+            // Unsigned and signed integers of 1, 2, 4 and 8 bytes
+            ++p;
+            readBytes(static_cast<size_t>(1) << ((c - UInt8MessagePackFormat) % 4));
+        }
+        else if (c >= FixExt1MessagePackFormat && c < Str8MessagePackFormat) {
+
+            ++p;
+            readBytes((static_cast<size_t>(1) << (c - FixExt1MessagePackFormat)) + 1);
+        }
+        else {
+            fail("expected value");
+        }
+    }
+
+    void finish() {
+        if (p != end)
+            fail("unexpected data after MessagePack item");
+    }
+
+    size_t offset() const {
+        return p - begin;
+    }
+
+private:
+    const char* begin;
+    const char* end;
+    const char* p;
+
+    /** Opened containers, number of members or items left to read */
+    std::vector<size_t> containers;
+
+    void fail(const std::string& message) {
+        throw Error(message, BusinessError);
+    }
+
+    /** \return Format byte of the next item, not consumed */
+    unsigned char peek(const char* message) {
+        if (p == end)
+            fail(message);
+
+        return static_cast<unsigned char>(*p);
+    }
+
+    /** \return Big-endian argument of `bytes` bytes following the format byte */
+    size_t argument(size_t bytes) {
+        if (static_cast<size_t>(end - p) <= bytes)
+            fail("unexpected end of input");
+
+        ++p;
+        size_t value = 0;
+
+        for (size_t i = 0; i < bytes; ++i, ++p) {
+
+            if ((value >> (sizeof(size_t) * 8 - 8)) != 0)
+                fail("integer overflow");
+
+            value = (value << 8) | static_cast<unsigned char>(*p);
+        }
+
+        return value;
+    }
+
+    /** \return Beginning of next `length` bytes, skipped */
+    const char* readBytes(size_t length) {
+        if (static_cast<size_t>(end - p) < length)
+            fail("unexpected end of input");
+
+        const char* bytes = p;
+        p += length;
+
+        return bytes;
+    }
+
+    void beginContainer(size_t size) {
+        if (containers.size() == MaxNestingDepth)
+            fail("maximum nesting depth exceeded");
+
+        containers.push_back(size);
+    }
+
+    bool nextInContainer() {
+        if (containers.back() == 0) {
+            containers.pop_back();
+            return false;
+        }
+
+        --containers.back();
+        return true;
+    }
+};
+
+void snowcrash::SerializeMessagePack(const Blueprint& blueprint, std::ostream& os, SerializeOptions options)
+{
+    MessagePackEmitter emitter(os);
+    VisitBlueprint(blueprint, emitter, options);
+}
+
+void snowcrash::SerializeSourceMapMessagePack(const SourceMap<Blueprint>& sourceMap, std::ostream& os, SerializeOptions options)
+{
+    MessagePackEmitter emitter(os);
+    VisitSourceMap(sourceMap, emitter, options);
+}
+
+int snowcrash::DeserializeMessagePack(const mdp::ByteBuffer& source, Blueprint& blueprint, Report& report)
+{
+    MessagePackReader reader(source.data(), source.size());
+    return BlueprintDeserializer<MessagePackReader>::read(reader, blueprint, report);
+}
+
+int snowcrash::DeserializeSourceMapMessagePack(const mdp::ByteBuffer& source, SourceMap<Blueprint>& sourceMap, Report& report)
+{
+    MessagePackReader reader(source.data(), source.size());
+    return BlueprintDeserializer<MessagePackReader>::read(reader, sourceMap, report);
+}
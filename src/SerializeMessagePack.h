@@ -0,0 +1,64 @@
+//
+//  SerializeMessagePack.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_SERIALIZE_MESSAGEPACK_H
+#define SNOWCRASH_SERIALIZE_MESSAGEPACK_H
+
+#include <ostream>
+#include "BlueprintSourcemap.h"
+#include "Serialize.h"
+#include "SourceAnnotation.h"
+
+/**
+ *  MessagePack Serialization
+ *  -------------------------
+ *
+ *  API Blueprint AST and its source map in MessagePack. The document has
+ *  the structure and the keys of the JSON serialization, objects are maps
+ *  with str keys, source map ranges are arrays of [location, length]
+ *  unsigned integer pairs.
+ */
+
+namespace snowcrash {
+
+    /**
+     *  \brief  Serialize API Blueprint AST into MessagePack
+     *  \param  blueprint   A blueprint AST to serialize
+     *  \param  os          An output stream to serialize into
+     *  \param  options     Serialization options, CompactSerializeOption has no effect
+     */
+    void SerializeMessagePack(const Blueprint& blueprint, std::ostream& os, SerializeOptions options = 0);
+
+    /**
+     *  \brief  Serialize source map of API Blueprint AST into MessagePack
+     *  \param  sourceMap   A source map to serialize
+     *  \param  os          An output stream to serialize into
+     *  \param  options     Serialization options, CompactSerializeOption has no effect
+     */
+    void SerializeSourceMapMessagePack(const SourceMap<Blueprint>& sourceMap, std::ostream& os, SerializeOptions options = 0);
+
+    /**
+     *  \brief  Deserialize API Blueprint AST from MessagePack
+     *  \param  source      MessagePack as produced by SerializeMessagePack()
+     *  \param  blueprint   Output blueprint AST
+     *  \param  report      Output report, error location is a byte offset of the source
+     *  \return Error code
+     */
+    int DeserializeMessagePack(const mdp::ByteBuffer& source, Blueprint& blueprint, Report& report);
+
+    /**
+     *  \brief  Deserialize source map of API Blueprint AST from MessagePack
+     *  \param  source      MessagePack as produced by SerializeSourceMapMessagePack()
+     *  \param  sourceMap   Output source map
+     *  \param  report      Output report, error location is a byte offset of the source
+     *  \return Error code
+     */
+    int DeserializeSourceMapMessagePack(const mdp::ByteBuffer& source, SourceMap<Blueprint>& sourceMap, Report& report);
+}
+
+#endif
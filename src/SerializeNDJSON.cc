@@ -0,0 +1,290 @@
+//
+//  SerializeNDJSON.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "SerializeNDJSON.h"
+#include "Serialize.h"
+#include "JSONWriter.h"
+
+using namespace snowcrash;
+
+/**
+ * \brief Serialize an object key.
+ * \param key      Key to serialize
+ * \param os       A JSON writer to serialize into
+ */
+static void serializeKey(const std::string& key, JSONWriter& os)
+{
+    os.string(key);
+    os << ':';
+}
+
+/**
+ * \brief Serialize a key and its string value.
+ * \param key      Key to serialize
+ * \param value    Value to serialize
+ * \param os       A JSON writer to serialize into
+ */
+static void serialize(const std::string& key, const std::string& value, JSONWriter& os)
+{
+    serializeKey(key, os);
+    os.string(value);
+}
+
+/**
+ * \brief Serialize a parameter.
+ * \param parameter    A parameter to serialize
+ * \param os           A JSON writer to serialize into
+ */
+static void serialize(const Parameter& parameter, JSONWriter& os)
+{
+    os << '{';
+
+    serialize(SerializeKey::Name, parameter.name, os);
+    os << ',';
+
+    serialize(SerializeKey::Description, parameter.description, os);
+    os << ',';
+
+    serialize(SerializeKey::Type, parameter.type, os);
+    os << ',';
+
+    serializeKey(SerializeKey::Required, os);
+    os << ((parameter.use != OptionalParameterUse) ? "true" : "false");
+    os << ',';
+
+    serialize(SerializeKey::Default, parameter.defaultValue, os);
+    os << ',';
+
+    serialize(SerializeKey::Example, parameter.exampleValue, os);
+    os << ',';
+
+    serializeKey(SerializeKey::Values, os);
+    os << '[';
+
+    for (Values::const_iterator it = parameter.values.begin(); it != parameter.values.end(); ++it) {
+
+        if (it != parameter.values.begin())
+            os << ',';
+
+        os.string(*it);
+    }
+
+    os << "]}";
+}
+
+/**
+ * \brief  Find a parameter by its name.
+ * \return True if the parameters contain a parameter of given name
+ */
+static bool hasParameter(const Parameters& parameters, const std::string& name)
+{
+    for (Parameters::const_iterator it = parameters.begin(); it != parameters.end(); ++it) {
+        if (it->name == name)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * \brief Serialize parameters of an action.
+ * \param action    Parameters of the action
+ * \param resource  Parameters of its resource
+ * \param os        A JSON writer to serialize into
+ */
+static void serialize(const Parameters& action, const Parameters& resource, JSONWriter& os)
+{
+    serializeKey(SerializeKey::Parameters, os);
+    os << '[';
+
+    bool first = true;
+
+    for (Parameters::const_iterator it = action.begin(); it != action.end(); ++it) {
+
+        if (!first)
+            os << ',';
+
+        serialize(*it, os);
+        first = false;
+    }
+
+    for (Parameters::const_iterator it = resource.begin(); it != resource.end(); ++it) {
+
+        if (hasParameter(action, it->name))
+            continue;
+
+        if (!first)
+            os << ',';
+
+        serialize(*it, os);
+        first = false;
+    }
+
+    os << ']';
+}
+
+/**
+ * \brief Serialize a request or a response.
+ * \param key      Key of the payload
+ * \param payload  The payload to serialize, NULL to serialize `null`
+ * \param os       A JSON writer to serialize into
+ */
+static void serialize(const std::string& key, const Payload* payload, JSONWriter& os)
+{
+    serializeKey(key, os);
+
+    if (!payload) {
+        os << "null";
+        return;
+    }
+
+    os << '{';
+
+    serialize(SerializeKey::Name, payload->name, os);
+    os << ',';
+
+    serializeKey(SerializeKey::Headers, os);
+    os << '[';
+
+    for (Headers::const_iterator it = payload->headers.begin(); it != payload->headers.end(); ++it) {
+
+        if (it != payload->headers.begin())
+            os << ',';
+
+        os << '{';
+        serialize(SerializeKey::Name, it->first, os);
+        os << ',';
+        serialize(SerializeKey::Value, it->second, os);
+        os << '}';
+    }
+
+    os << "],";
+
+    serialize(SerializeKey::Body, payload->body, os);
+    os << ',';
+
+    serialize(SerializeKey::Schema, payload->schema, os);
+    os << '}';
+}
+
+/**
+ * \brief Serialize a request and response pair of a transaction example.
+ * \param example  The transaction example
+ * \param request  A request of the example or NULL
+ * \param response A response of the example or NULL
+ * \param os       A JSON writer to serialize into
+ */
+static void serialize(const TransactionExample& example, const Request* request, const Response* response, JSONWriter& os)
+{
+    os << '{';
+
+    serialize(SerializeKey::Example, example.name, os);
+    os << ',';
+
+    serialize(SerializeKey::Request, request, os);
+    os << ',';
+
+    serialize(SerializeKey::Response, response, os);
+    os << '}';
+}
+
+/**
+ * \brief Serialize all request and response pairs of an action.
+ * \param examples Transaction examples of the action
+ * \param os       A JSON writer to serialize into
+ */
+static void serialize(const TransactionExamples& examples, JSONWriter& os)
+{
+    serializeKey(SerializeKey::Transactions, os);
+    os << '[';
+
+    bool first = true;
+
+    for (TransactionExamples::const_iterator it = examples.begin(); it != examples.end(); ++it) {
+
+        // A missing request or response is serialized as null
+        size_t requests = (it->requests.empty()) ? 1 : it->requests.size();
+        size_t responses = (it->responses.empty()) ? 1 : it->responses.size();
+
+        for (size_t i = 0; i < requests; ++i) {
+            for (size_t j = 0; j < responses; ++j) {
+
+                if (!first)
+                    os << ',';
+
+                serialize(*it,
+                          (it->requests.empty()) ? NULL : &it->requests[i],
+                          (it->responses.empty()) ? NULL : &it->responses[j],
+                          os);
+
+                first = false;
+            }
+        }
+    }
+
+    os << ']';
+}
+
+/**
+ * \brief Serialize the record of an action.
+ * \param group    The resource group of the action
+ * \param resource The resource of the action
+ * \param action   The action to serialize
+ * \param os       A JSON writer to serialize into
+ */
+static void serialize(const ResourceGroup& group, const Resource& resource, const Action& action, JSONWriter& os)
+{
+    os << '{';
+
+    serialize(SerializeKey::Group, group.name, os);
+    os << ',';
+
+    serialize(SerializeKey::Resource, resource.name, os);
+    os << ',';
+
+    serialize(SerializeKey::URITemplate, resource.uriTemplate, os);
+    os << ',';
+
+    serialize(SerializeKey::Action, action.name, os);
+    os << ',';
+
+    serialize(SerializeKey::Method, action.method, os);
+    os << ',';
+
+    serialize(action.parameters, resource.parameters, os);
+    os << ',';
+
+    serialize(action.examples, os);
+    os << "}\n";
+}
+
+void snowcrash::SerializeNDJSON(const Blueprint& blueprint, std::ostream& os)
+{
+    JSONWriter writer(os, true);
+
+    for (ResourceGroups::const_iterator group = blueprint.resourceGroups.begin();
+         group != blueprint.resourceGroups.end();
+         ++group) {
+
+        for (Resources::const_iterator resource = group->resources.begin();
+             resource != group->resources.end();
+             ++resource) {
+
+            for (Actions::const_iterator action = resource->actions.begin();
+                 action != resource->actions.end();
+                 ++action) {
+
+                serialize(*group, *resource, *action, writer);
+
+                // Hand over every complete record to the reader of the stream
+                writer.flush();
+                os.flush();
+            }
+        }
+    }
+}
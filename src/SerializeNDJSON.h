@@ -0,0 +1,44 @@
+//
+//  SerializeNDJSON.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_SERIALIZE_NDJSON_H
+#define SNOWCRASH_SERIALIZE_NDJSON_H
+
+#include <ostream>
+#include "Blueprint.h"
+
+/**
+ *  Newline Delimited JSON
+ *  ----------------------
+ *
+ *  One self-contained JSON record per action, a line each:
+ *
+ *      {"group":"Notes","resource":"Note","uriTemplate":"/notes/{id}",
+ *       "action":"Retrieve","method":"GET","parameters":[...],
+ *       "transactions":[{"example":"","request":{...},"response":{...}}]}
+ *
+ *  Parameters are the action parameters followed by the resource
+ *  parameters the action does not override. Every request of a
+ *  transaction example is paired with every response of the example,
+ *  a missing request or response is `null`.
+ */
+
+namespace snowcrash {
+
+    /**
+     *  \brief  Serialize API Blueprint AST as one JSON record per action
+     *  \param  blueprint   A blueprint AST to serialize
+     *  \param  os          An output stream to serialize into
+     *
+     *  The stream is flushed after every record, a reader of a pipe gets
+     *  each record as soon as it is complete.
+     */
+    void SerializeNDJSON(const Blueprint& blueprint, std::ostream& os);
+}
+
+#endif
@@ -6,697 +6,186 @@
 //  Copyright (c) 2013 Apiary Inc. All rights reserved.
 //
 
-#include "Serialize.h"
+#include <vector>
 #include "SerializeYAML.h"
+#include "BlueprintVisitor.h"
+#include "YAMLWriter.h"
 
 using namespace snowcrash;
 
-static std::string ReservedCharacters = "#-[]:|>!*&%@`,{}?\'";
-
-/** Normalizes string value for use in YAML and checks whether quotation is need */
-static std::string NormalizeStringValue(const std::string& value, bool& needsQuotation)
-{
-    std::string normalizedValue = value;
-
-    if (normalizedValue.find("\"") != std::string::npos)
-        normalizedValue = EscapeDoubleQuotes(normalizedValue);
-
-    if (value.find("\n") != std::string::npos)
-        normalizedValue = EscapeNewlines(normalizedValue);
-
-    needsQuotation = (normalizedValue != value);
-
-    if (!needsQuotation) {
-        for (std::string::const_iterator it = value.begin() ; it < value.end() ; ++it){
-            needsQuotation = ReservedCharacters.find(*it) != std::string::npos;
-            if (needsQuotation)
-                break;
-        }
-    }
-
-    return normalizedValue;
-}
-
-
-/** Insert array item mark */
-static void ArrayItemLeadIn(size_t level, std::ostream &os, bool withTrailingSpace = true)
-{
-    if (level < 1)
-        return;
-
-    for (size_t i = 0; i < level - 1; ++i)
-        os << "  ";
-
-    os << "-";
-
-    if (withTrailingSpace) {
-        os << " ";
-    }
-}
-
-/** Serialize key value pair */
-static void serialize(const std::string& key, const std::string& value, size_t level, std::ostream &os, bool implicitQuotation = true)
-{
-    if (key.empty())
-        return;
-
-    for (size_t i = 0; i < level; ++i)
-        os << "  ";
-
-    if (!value.empty()) {
-
-        os << key << ": ";
-
-        bool needsQuotation = false;
-        std::string normalizedValue = NormalizeStringValue(value, needsQuotation);
-
-        if (implicitQuotation) {
-            // Always use quotation
-            os << "\"" << normalizedValue << "\"";
-        }
-        else {
-            if (needsQuotation)
-                os << "\"" << normalizedValue << "\"";
-            else
-                os << value;
-        }
-
-        os << std::endl;
-    }
-    else
-        os << key << ":\n";
-}
-
-/** Serialize source map without key into output stream */
-static void serialize(const SourceMapBase& set, size_t level, std::ostream &os)
-{
-    if (!set.sourceMap.empty()) {
-        size_t i = 0;
-        os << std::endl;
-
-        for (mdp::RangeSet<mdp::BytesRange>::const_iterator it = set.sourceMap.begin(); it != set.sourceMap.end(); ++i, ++it) {
-
-            ArrayItemLeadIn(level, os, false);
-            os << "\n";
-            ArrayItemLeadIn(level + 1, os);
-            os << it->location << "\n";
-            ArrayItemLeadIn(level + 1, os);
-            os << it->length << "\n";
+/**
+ *  \brief YAML emitter of the token events of a blueprint visit.
+ *
+ *  Block style. Items of an array are at the indentation of its key, the
+ *  first member of an object in an array follows the item mark. Empty
+ *  strings and empty collections are written as keys with no value.
+ */
+class YAMLEmitter {
+public:
+    explicit YAMLEmitter(std::ostream& os)
+    : m_writer(os) {}
+
+    /** Emitter of an item of the current array of `parent` */
+    YAMLEmitter(std::ostream& os, const YAMLEmitter& parent, size_t)
+    : m_writer(os), m_frames(parent.m_frames) {}
+
+    void beginObject(size_t) {
+        size_t level = 0;
+        bool item = false;
+
+        if (!m_frames.empty()) {
+
+            Frame& parent = m_frames.back();
+            level = parent.level + 1;
+
+            if (parent.array) {
+                m_writer.indent(parent.level);
+                m_writer << "- ";
+                item = true;
+            }
+            else {
+                m_writer << "\n";
+            }
         }
-    } else {
-        os << " []\n";
-    }
-}
 
-/** Serialize a key and source map value into output stream. */
-static void serialize(const std::string& key, const SourceMapBase& value, size_t level, std::ostream &os, bool keyLevelIsZero = false)
-{
-    if (key.empty())
-        return;
-
-    if (!keyLevelIsZero) {
-        for (size_t i = 0; i < level; ++i)
-            os << "  ";
+        m_frames.push_back(Frame(false, item, level));
     }
 
-    os << key << ":";
-    serialize(value, level + 1, os);
-}
-
-/** Serializes source map collection */
-static void serializeSourceMapCollection(const Collection<SourceMap<KeyValuePair> >::type& collection, size_t level, std::ostream &os)
-{
-    for (Collection<SourceMap<KeyValuePair> >::const_iterator it = collection.begin();
-         it != collection.end();
-         ++it) {
-
-        // Array item
-        ArrayItemLeadIn(level + 1, os, false);
-
-        // Source Map
-        serialize(*it, level + 2, os);
+    void endObject() {
+        m_frames.pop_back();
     }
-}
-
-/** Serializes key value collection */
-static void serializeKeyValueCollection(const Collection<KeyValuePair>::type& collection, size_t level, std::ostream &os)
-{
-    for (Collection<KeyValuePair>::const_iterator it = collection.begin();
-         it != collection.end();
-         ++it) {
-
-        // Array item
-        ArrayItemLeadIn(level + 1, os);
-
-        // Name
-        serialize(SerializeKey::Name, it->first, 0, os);
-
-        // Value
-        serialize(SerializeKey::Value, it->second, level + 1, os);
-    }
-}
-
-/** Serialize Metadata */
-static void serialize(const Collection<Metadata>::type& metadata, std::ostream &os)
-{
-    serialize(SerializeKey::Metadata, std::string(), 0, os);
-
-    if (metadata.empty())
-        return;
-
-    serializeKeyValueCollection(metadata, 0, os);
-}
 
-/** Serialize Metadata source map */
-static void serialize(const Collection<SourceMap<Metadata> >::type& metadata, std::ostream &os)
-{
-    serialize(SerializeKey::Metadata, std::string(), 0, os);
-
-    if (metadata.empty())
-        return;
-
-    serializeSourceMapCollection(metadata, 0, os);
-}
-
-
-/** Serialize Headers */
-static void serialize(const Headers& headers, size_t level, std::ostream &os)
-{
-    serializeKeyValueCollection(headers, level, os);
-}
-
-/** Serialize Headers source map */
-static void serialize(const Collection<SourceMap<Header> >::type& headers, size_t level, std::ostream &os)
-{
-    serializeSourceMapCollection(headers, level, os);
-}
-
-/** Serialize Parameters */
-static void serialize(const Parameters& parameters, size_t level, std::ostream &os)
-{
-    for (Collection<Parameter>::const_iterator it = parameters.begin(); it != parameters.end(); ++it) {
-
-        // Array item
-        ArrayItemLeadIn(level + 1, os);
+    void beginArray(size_t) {
+        size_t level = 0;
 
-        // Key / name
-        serialize(SerializeKey::Name, it->name, 0, os);
+        if (!m_frames.empty()) {
 
-        // Description
-        serialize(SerializeKey::Description, it->description, level + 1, os);
+            Frame& parent = m_frames.back();
+            level = parent.level;
 
-        // Type
-        serialize(SerializeKey::Type, it->type, level + 1, os);
+            if (parent.array) {
+                m_writer.indent(parent.level);
+                m_writer << "-";
+                ++level;
+            }
 
-        // Required
-        serialize(SerializeKey::Required, (it->use == OptionalParameterUse) ? "false" : "true", level + 1, os, false);
-
-        // Default
-        serialize(SerializeKey::Default, it->defaultValue, level + 1, os);
-
-        // Example
-        serialize(SerializeKey::Example, it->exampleValue, level + 1, os);
-
-        // Values
-        serialize(SerializeKey::Values, std::string(), level + 1, os);
-
-        for (Collection<Value>::const_iterator val_it = it->values.begin();
-             val_it != it->values.end();
-             ++val_it) {
-
-            ArrayItemLeadIn(level + 2, os);
-
-            serialize(SerializeKey::Value, *val_it, 0, os);
+            m_writer << "\n";
         }
-    }
-}
-
-/** Serialize Parameters source map */
-static void serialize(const Collection<SourceMap<Parameter> >::type& parameters, size_t level, std::ostream &os)
-{
-    for (Collection<SourceMap<Parameter> >::const_iterator it = parameters.begin();
-         it != parameters.end();
-         ++it) {
-
-        // Array item
-        ArrayItemLeadIn(level + 1, os);
-
-        // Key / name
-        serialize(SerializeKey::Name, it->name, level + 1, os, true);
-
-        // Description
-        serialize(SerializeKey::Description, it->description, level + 1, os);
 
-        // Type
-        serialize(SerializeKey::Type, it->type, level + 1, os);
-
-        // Required
-        serialize(SerializeKey::Required, it->use, level + 1, os);
-
-        // Default
-        serialize(SerializeKey::Default, it->defaultValue, level + 1, os);
-
-        // Example
-        serialize(SerializeKey::Example, it->exampleValue, level + 1, os);
-
-        // Values
-        serialize(SerializeKey::Values, std::string(), level + 1, os);
-
-        for (Collection<SourceMap<Value> >::const_iterator val_it = it->values.collection.begin();
-             val_it != it->values.collection.end();
-             ++val_it) {
-
-            // Array item
-            ArrayItemLeadIn(level + 2, os);
-
-            // Source Map
-            serialize(*val_it, level + 3, os);
-        }
+        m_frames.push_back(Frame(true, false, level));
     }
-}
 
-/** Serialize Reference */
-static void serialize(const Reference& reference, size_t level, std::ostream &os)
-{
-    if (reference.id.empty()) {
-        return;
+    void endArray() {
+        m_frames.pop_back();
     }
 
-    serialize(SerializeKey::Reference, "", level - 1, os);
+    void key(const std::string& key) {
+        Frame& frame = m_frames.back();
 
-    // ID
-    serialize(SerializeKey::Id, reference.id, level, os);
-}
+        // The first member of an array item follows the item mark
+        if (!frame.item || frame.count > 0)
+            m_writer.indent(frame.level);
 
-/** Serialize Reference source map */
-static void serialize(const SourceMap<Reference>& reference, size_t level, std::ostream &os)
-{
-    if (reference.sourceMap.empty()) {
-        return;
+        m_writer << key << ":";
+        ++frame.count;
     }
 
-    serialize(SerializeKey::Reference, reference, level - 1, os);
-}
-
-/** Serialize Payload */
-static void serialize(const Payload& payload, size_t level, bool array, std::ostream &os)
-{
-    for (size_t i = 0; i < level - 1; i++) {
-        os << "  ";
+    void string(const std::string& value) {
+        scalar(value, true);
     }
 
-    if (array)
-        os << "- ";
-    else
-        os << "  ";
-
-    // Name
-    serialize(SerializeKey::Name, payload.name, 0, os);
-
-    // Reference
-    serialize(payload.reference, level + 1, os);
-
-    // Description
-    serialize(SerializeKey::Description, payload.description, level, os);
-
-    // Headers
-    serialize(SerializeKey::Headers, std::string(), level, os);
-
-    if (!payload.headers.empty()) {
-        serialize(payload.headers, level, os);
+    void literal(const std::string& value) {
+        scalar(value, false);
     }
 
-    // Body
-    serialize(SerializeKey::Body, payload.body, level, os);
-
-    // Schema
-    serialize(SerializeKey::Schema, payload.schema, level, os);
-}
-
-/** Serialize Payload source map */
-static void serialize(const SourceMap<Payload>& payload, size_t level, bool array, std::ostream &os)
-{
-    for (size_t i = 0; i < level - 1; i++) {
-        os << "  ";
+    void boolean(bool value) {
+        scalar((value) ? "true" : "false", false);
     }
 
-    if (array)
-        os << "- ";
-    else
-        os << "  ";
-
-    // Name
-    serialize(SerializeKey::Name, payload.name, level, os, true);
-
-    // Reference
-    serialize(payload.reference, level + 1, os);
-
-    // Description
-    serialize(SerializeKey::Description, payload.description, level, os);
+    void sourceMap(const SourceMapBase& value) {
+        size_t level = leadIn();
 
-    // Headers
-    serialize(SerializeKey::Headers, std::string(), level, os);
-
-    if (!payload.headers.collection.empty()) {
-        serialize(payload.headers.collection, level, os);
-    }
-
-    // Body
-    serialize(SerializeKey::Body, payload.body, level, os);
-
-    // Schema
-    serialize(SerializeKey::Schema, payload.schema, level, os);
-}
-
-/** Serialize Transaction Example */
-static void serialize(const TransactionExample& example, std::ostream &os)
-{
-    os << "      - ";   // indent 4
-
-    // Name
-    serialize(SerializeKey::Name, example.name, 0, os);
-
-    // Description
-    serialize(SerializeKey::Description, example.description, 4, os);
-
-    // Requests
-    serialize(SerializeKey::Requests, std::string(), 4, os);
-
-    if (!example.requests.empty()) {
-        for (Collection<Request>::const_iterator it = example.requests.begin();
-             it != example.requests.end();
-             ++it) {
-
-            serialize(*it, 5, true, os);
+        if (value.sourceMap.empty()) {
+            m_writer << " []\n";
+            return;
         }
-    }
 
-    // Responses
-    serialize(SerializeKey::Responses, std::string(), 4, os);
+        m_writer << "\n";
 
-    if (!example.responses.empty()) {
-        for (Collection<Response>::const_iterator it = example.responses.begin();
-             it != example.responses.end();
-             ++it) {
+        for (mdp::RangeSet<mdp::BytesRange>::const_iterator it = value.sourceMap.begin(); it != value.sourceMap.end(); ++it) {
 
-            serialize(*it, 5, true, os);
+            m_writer.arrayItemLeadIn(level + 1, false);
+            m_writer << "\n";
+            m_writer.arrayItemLeadIn(level + 2);
+            m_writer << it->location << "\n";
+            m_writer.arrayItemLeadIn(level + 2);
+            m_writer << it->length << "\n";
         }
     }
-}
 
-/** Serialize Transaction Example source map */
-static void serialize(const SourceMap<TransactionExample>& example, std::ostream &os)
-{
-    os << "      - ";   // indent 4
-
-    // Name
-    serialize(SerializeKey::Name, example.name, 4, os, true);
-
-    // Description
-    serialize(SerializeKey::Description, example.description, 4, os);
-
-    // Requests
-    serialize(SerializeKey::Requests, std::string(), 4, os);
-
-    if (!example.requests.collection.empty()) {
-        for (Collection<SourceMap<Request> >::const_iterator it = example.requests.collection.begin();
-             it != example.requests.collection.end();
-             ++it) {
-
-            serialize(*it, 5, true, os);
-        }
+    void append(const std::string& output) {
+        m_writer.append(output);
     }
 
-    // Responses
-    serialize(SerializeKey::Responses, std::string(), 4, os);
-
-    if (!example.responses.collection.empty()) {
-        for (Collection<SourceMap<Response> >::const_iterator it = example.responses.collection.begin();
-             it != example.responses.collection.end();
-             ++it) {
-
-            serialize(*it, 5, true, os);
-        }
-    }
-}
-
-/** Serialize Action */
-static void serialize(const Action& action, std::ostream &os)
-{
-    os << "    - ";   // indent 3
-
-    // Name
-    serialize(SerializeKey::Name, action.name, 0, os);
+private:
 
-    // Description
-    serialize(SerializeKey::Description, action.description, 3, os);
+    /** An open object or array */
+    struct Frame {
+        bool array;
+        bool item;      /// < Object is an array item
+        size_t level;   /// < Indentation of members or item marks
+        size_t count;
 
-    // HTTP method
-    serialize(SerializeKey::Method, action.method, 3, os);
+        Frame(bool array_, bool item_, size_t level_)
+        : array(array_), item(item_), level(level_), count(0) {}
+    };
 
-    // Parameters
-    serialize(SerializeKey::Parameters, std::string(), 3, os);
+    YAMLWriter m_writer;
+    std::vector<Frame> m_frames;
 
-    if (!action.parameters.empty())
-        serialize(action.parameters, 3, os);
+    /**
+     *  \brief  Write the item mark of a value in an array.
+     *  \return Indentation of the nested item marks of the value
+     */
+    size_t leadIn() {
+        Frame& frame = m_frames.back();
 
-    // Examples
-    serialize(SerializeKey::Examples, std::string(), 3, os);
+        if (!frame.array)
+            return frame.level;
 
-    if (!action.examples.empty()) {
-        for (Collection<TransactionExample>::const_iterator it = action.examples.begin();
-             it != action.examples.end();
-             ++it) {
+        m_writer.indent(frame.level);
+        m_writer << "-";
 
-            serialize(*it, os);
-        }
+        return frame.level + 1;
     }
-}
-
-/** Serialize Action source map */
-static void serialize(const SourceMap<Action>& action, std::ostream &os)
-{
-    os << "    - ";   // indent 3
-
-    // Name
-    serialize(SerializeKey::Name, action.name, 3, os, true);
 
-    // Description
-    serialize(SerializeKey::Description, action.description, 3, os);
+    /** Write a scalar, always quoted or only if needed */
+    void scalar(const std::string& value, bool quoted) {
+        leadIn();
 
-    // HTTP method
-    serialize(SerializeKey::Method, action.method, 3, os);
-
-    // Parameters
-    serialize(SerializeKey::Parameters, std::string(), 3, os);
-
-    if (!action.parameters.collection.empty())
-        serialize(action.parameters.collection, 3, os);
-
-    // Examples
-    serialize(SerializeKey::Examples, std::string(), 3, os);
-
-    if (!action.examples.collection.empty()) {
-        for (Collection<SourceMap<TransactionExample> >::const_iterator it = action.examples.collection.begin();
-             it != action.examples.collection.end();
-             ++it) {
-
-            serialize(*it, os);
+        if (!value.empty()) {
+            m_writer << " ";
+            m_writer.scalar(value, quoted);
         }
-    }
-}
 
-/** Serialize Resource */
-static void serialize(const Resource& resource, std::ostream &os)
-{
-    os << "  - ";   // indent 2
-
-    // Name
-    serialize(SerializeKey::Name, resource.name, 0, os);
-
-    // Description
-    serialize(SerializeKey::Description, resource.description, 2, os);
-
-    // URI Template
-    serialize(SerializeKey::URITemplate, resource.uriTemplate, 2, os);
-
-    // Model
-    serialize(SerializeKey::Model, std::string(), 2, os);
-
-    if (!resource.model.name.empty())
-        serialize(resource.model, 3, false, os);
-
-    // Parameters
-    serialize(SerializeKey::Parameters, std::string(), 2, os);
-
-    if (!resource.parameters.empty())
-        serialize(resource.parameters, 2, os);
-
-    // Actions
-    serialize(SerializeKey::Actions, std::string(), 2, os);
-
-    if (resource.actions.empty())
-        return;
-
-    for (Collection<Action>::const_iterator it = resource.actions.begin();
-         it != resource.actions.end();
-         ++it) {
-
-        serialize(*it, os);
+        m_writer << "\n";
     }
-}
+};
 
-/** Serialize Resource source map */
-static void serialize(const SourceMap<Resource>& resource, std::ostream &os)
+void snowcrash::SerializeYAML(const snowcrash::Blueprint& blueprint, std::ostream &os, SerializeOptions options)
 {
-    os << "  - ";   // indent 2
-
-    // Name
-    serialize(SerializeKey::Name, resource.name, 2, os, true);
-
-    // Description
-    serialize(SerializeKey::Description, resource.description, 2, os);
-
-    // URI Template
-    serialize(SerializeKey::URITemplate, resource.uriTemplate, 2, os);
-
-    // Model
-    serialize(SerializeKey::Model, std::string(), 2, os);
-
-    if (!resource.model.name.sourceMap.empty())
-        serialize(resource.model, 3, false, os);
-
-    // Parameters
-    serialize(SerializeKey::Parameters, std::string(), 2, os);
-
-    if (!resource.parameters.collection.empty())
-        serialize(resource.parameters.collection, 2, os);
-
-    // Actions
-    serialize(SerializeKey::Actions, std::string(), 2, os);
-
-    if (resource.actions.collection.empty())
-        return;
-
-    for (Collection<SourceMap<Action> >::const_iterator it = resource.actions.collection.begin();
-         it != resource.actions.collection.end();
-         ++it) {
-
-        serialize(*it, os);
-    }
-}
-
-/** Serialize Resource Group */
-static void serialize(const ResourceGroup& group, std::ostream &os)
-{
-    os << "- ";   // indent 1
-
-    // Name
-    serialize(SerializeKey::Name, group.name, 0, os);
-
-    // Description
-    serialize(SerializeKey::Description, group.description, 1, os);
-
-    // Resources
-    serialize(SerializeKey::Resources, std::string(), 1, os);
-
-    if (group.resources.empty())
-        return;
-
-    for (Collection<Resource>::const_iterator it = group.resources.begin();
-         it != group.resources.end();
-         ++it) {
-
-        serialize(*it, os);
-    }
-}
-
-/** Serialize Resource Group source map */
-static void serialize(const SourceMap<ResourceGroup>& group, std::ostream &os)
-{
-    os << "- ";   // indent 1
-
-    // Name
-    serialize(SerializeKey::Name, group.name, 1, os, true);
-
-    // Description
-    serialize(SerializeKey::Description, group.description, 1, os);
-
-    // Resources
-    serialize(SerializeKey::Resources, std::string(), 1, os);
-
-    if (group.resources.collection.empty())
-        return;
-
-    for (Collection<SourceMap<Resource> >::const_iterator it = group.resources.collection.begin();
-         it != group.resources.collection.end();
-         ++it) {
-
-        serialize(*it, os);
-    }
-}
-
-/** Serialize Blueprint */
-static void serialize(const Blueprint& blueprint, std::ostream &os)
-{
-    // AST Version
-    serialize(SerializeKey::ASTVersion, AST_SERIALIZATION_VERSION, 0, os, false);
-
-    // Metadata
-    serialize(blueprint.metadata, os);
-
-    // API Name
-    serialize(SerializeKey::Name, blueprint.name, 0, os);
-
-    // API Description
-    serialize(SerializeKey::Description, blueprint.description, 0, os);
-
-    // Resource Groups
-    serialize(SerializeKey::ResourceGroups, std::string(), 0, os);
-
-    if (blueprint.resourceGroups.empty())
-        return;
-
-    for (Collection<ResourceGroup>::type::const_iterator it = blueprint.resourceGroups.begin();
-         it != blueprint.resourceGroups.end();
-         ++it) {
-
-        serialize(*it, os);
-    }
-}
-
-/** Serialize Blueprint source map */
-static void serialize(const SourceMap<Blueprint>& blueprint, std::ostream &os)
-{
-    // Metadata
-    serialize(blueprint.metadata.collection, os);
-
-    // API Name
-    serialize(SerializeKey::Name, blueprint.name, 0, os);
-
-    // API Description
-    serialize(SerializeKey::Description, blueprint.description, 0, os);
-
-    // Resource Groups
-    serialize(SerializeKey::ResourceGroups, std::string(), 0, os);
-
-    if (blueprint.resourceGroups.collection.empty())
-        return;
-
-    for (Collection<SourceMap<ResourceGroup> >::type::const_iterator it = blueprint.resourceGroups.collection.begin();
-         it != blueprint.resourceGroups.collection.end();
-         ++it) {
-
-        serialize(*it, os);
-    }
+    YAMLEmitter emitter(os);
+    VisitBlueprint(blueprint, emitter, options);
 }
 
-void snowcrash::SerializeYAML(const snowcrash::Blueprint& blueprint, std::ostream &os)
+void snowcrash::SerializeSourceMapYAML(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os, SerializeOptions options)
 {
-    serialize(blueprint, os);
+    YAMLEmitter emitter(os);
+    VisitSourceMap(blueprint, emitter, options);
 }
 
-void snowcrash::SerializeSourceMapYAML(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os)
+void snowcrash::SerializeResourceGroupYAML(const snowcrash::Blueprint& blueprint, size_t index, std::ostream &os, SerializeOptions options)
 {
-    serialize(blueprint, os);
+    YAMLEmitter emitter(os);
+    VisitBlueprint(blueprint, emitter, options, index, index + 1);
 }
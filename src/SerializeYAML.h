@@ -11,14 +11,18 @@
 
 #include <ostream>
 #include "BlueprintSourcemap.h"
+#include "Serialize.h"
 
 namespace snowcrash {
 
     // Naive YAML serialization to ostream
-    void SerializeYAML(const snowcrash::Blueprint& blueprint, std::ostream &os);
+    void SerializeYAML(const snowcrash::Blueprint& blueprint, std::ostream &os, SerializeOptions options = 0);
 
     // Naive Sourcmap YAML serialization to ostream
-    void SerializeSourceMapYAML(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os);
+    void SerializeSourceMapYAML(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os, SerializeOptions options = 0);
+
+    // YAML serialization of the AST with only one of its resource groups
+    void SerializeResourceGroupYAML(const snowcrash::Blueprint& blueprint, size_t index, std::ostream &os, SerializeOptions options = 0);
 }
 
 #endif
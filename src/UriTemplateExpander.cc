@@ -0,0 +1,226 @@
+//
+//  UriTemplateExpander.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <cstring>
+#include "UriTemplateExpander.h"
+
+using namespace snowcrash;
+
+/**
+ *  \brief Expansion of an operator, RFC 6570 Appendix A
+ */
+struct OperatorTraits {
+    const char* first;
+    const char* separator;
+    bool named;
+    const char* ifEmpty;
+    bool allowsReserved;
+};
+
+/** Traits by URITemplateOperator */
+static const OperatorTraits Traits[] = {
+    { "",  ",", false, "",  false },    // {var}
+    { "",  ",", false, "",  true },     // {+var}
+    { "#", ",", false, "",  true },     // {#var}
+    { ".", ".", false, "",  false },    // {.var}
+    { "/", "/", false, "",  false },    // {/var}
+    { ";", ";", true,  "",  false },    // {;var}
+    { "?", "&", true,  "=", false },    // {?var}
+    { "&", "&", true,  "=", false }     // {&var}
+};
+
+static const char HexDigits[] = "0123456789ABCDEF";
+
+/**
+ *  \brief Characters copied to the output without percent-encoding
+ */
+struct EncodingTables {
+    bool unreserved[256];
+    bool reserved[256];
+
+    EncodingTables() {
+        const char* unreservedCharacters = "-._~";
+        const char* reservedCharacters = ":/?#[]@!$&'()*+,;=";
+
+        for (int c = 0; c < 256; ++c) {
+            unreserved[c] = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+                            (c != 0 && ::strchr(unreservedCharacters, c) != NULL);
+            reserved[c] = unreserved[c] || (c != 0 && ::strchr(reservedCharacters, c) != NULL);
+        }
+    }
+};
+
+static const EncodingTables Encoding;
+
+static bool IsHexDigit(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f');
+}
+
+/** Append a value percent-encoding the characters not allowed */
+static void AppendEncoded(const char* begin, const char* end, bool allowsReserved, std::string& out)
+{
+    const bool* allowed = (allowsReserved) ? Encoding.reserved : Encoding.unreserved;
+
+    for (const char* p = begin; p != end; ++p) {
+        unsigned char c = static_cast<unsigned char>(*p);
+
+        if (allowed[c]) {
+            out += *p;
+        }
+        else if (allowsReserved && c == '%' && end - p >= 3 && IsHexDigit(p[1]) && IsHexDigit(p[2])) {
+            out.append(p, 3);
+            p += 2;
+        }
+        else {
+            out += '%';
+            out += HexDigits[c >> 4];
+            out += HexDigits[c & 0x0F];
+        }
+    }
+}
+
+URITemplateExpander::URITemplateExpander(const URITemplate& uriTemplate)
+{
+    URITemplateExpressions expressions;
+    ScanURITemplateExpressions(uriTemplate, expressions);
+
+    size_t pos = 0;
+
+    for (URITemplateExpressions::const_iterator it = expressions.begin(); it != expressions.end(); ++it) {
+        addLiteral(uriTemplate, pos, it->offset - 1);
+        addExpression(uriTemplate, *it);
+        pos = it->offset + it->length + 1;
+    }
+
+    if (pos < uriTemplate.length())
+        addLiteral(uriTemplate, pos, uriTemplate.length());
+}
+
+void URITemplateExpander::addLiteral(const URITemplate& uriTemplate, size_t begin, size_t end)
+{
+    if (begin >= end)
+        return;
+
+    Instruction instruction;
+    instruction.code = LiteralInstruction;
+    instruction.op = NoURITemplateOperator;
+    instruction.variable = 0;
+    instruction.offset = texts.length();
+
+    AppendEncoded(uriTemplate.data() + begin, uriTemplate.data() + end, true, texts);
+
+    instruction.length = texts.length() - instruction.offset;
+    instructions.push_back(instruction);
+}
+
+void URITemplateExpander::addExpression(const URITemplate& uriTemplate, const URITemplateExpression& expression)
+{
+    size_t begin = expression.offset;
+    size_t end = std::min(expression.offset + expression.length, uriTemplate.length());
+
+    // Reserved operators are not expanded
+    if (expression.op == UndefinedURITemplateOperator) {
+        Instruction instruction = { LiteralInstruction, NoURITemplateOperator, 0, texts.length(), 0 };
+        texts.append(uriTemplate, begin - 1, end - begin + 1);
+
+        if (end < uriTemplate.length())
+            texts += '}';
+
+        instruction.length = texts.length() - instruction.offset;
+        instructions.push_back(instruction);
+        return;
+    }
+
+    if (expression.op != NoURITemplateOperator)
+        ++begin;
+
+    Instruction instruction = { ExpressionInstruction, expression.op, 0, 0, 0 };
+    instructions.push_back(instruction);
+
+    while (begin <= end) {
+        size_t nameEnd = uriTemplate.find(',', begin);
+
+        if (nameEnd == std::string::npos || nameEnd > end)
+            nameEnd = end;
+
+        std::string name = uriTemplate.substr(begin, nameEnd - begin);
+        name = name.substr(0, name.find_first_of(":*"));
+        begin = nameEnd + 1;
+
+        if (name.empty())
+            continue;
+
+        instruction.code = VariableInstruction;
+        instruction.variable = variableIndex(name);
+        instruction.offset = texts.length();
+        instruction.length = name.length();
+        texts += name;
+
+        if (instruction.variable == std::string::npos) {
+            instruction.variable = names.size();
+            names.push_back(name);
+        }
+
+        instructions.push_back(instruction);
+    }
+}
+
+size_t URITemplateExpander::variableIndex(const std::string& name) const
+{
+    std::vector<std::string>::const_iterator it = std::find(names.begin(), names.end(), name);
+    return (it != names.end()) ? static_cast<size_t>(it - names.begin()) : std::string::npos;
+}
+
+void URITemplateExpander::expand(const URITemplateValues& values, std::string& out) const
+{
+    const OperatorTraits* traits = &Traits[NoURITemplateOperator];
+    bool isFirst = true;
+
+    out.clear();
+
+    for (std::vector<Instruction>::const_iterator it = instructions.begin(); it != instructions.end(); ++it) {
+
+        switch (it->code) {
+            case LiteralInstruction:
+                out.append(texts, it->offset, it->length);
+                break;
+
+            case ExpressionInstruction:
+                traits = &Traits[it->op];
+                isFirst = true;
+                break;
+
+            case VariableInstruction:
+            {
+                const std::string* value = (it->variable < values.size()) ? values[it->variable] : NULL;
+
+                if (!value)
+                    break;
+
+                out += (isFirst) ? traits->first : traits->separator;
+                isFirst = false;
+
+                if (traits->named) {
+                    out.append(texts, it->offset, it->length);
+
+                    if (value->empty()) {
+                        out += traits->ifEmpty;
+                        break;
+                    }
+
+                    out += '=';
+                }
+
+                AppendEncoded(value->data(), value->data() + value->length(), traits->allowsReserved, out);
+                break;
+            }
+        }
+    }
+}
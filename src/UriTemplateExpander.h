@@ -0,0 +1,93 @@
+//
+//  UriTemplateExpander.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_URITEMPLATEEXPANDER_H
+#define SNOWCRASH_URITEMPLATEEXPANDER_H
+
+#include "Blueprint.h"
+#include "UriTemplateParser.h"
+
+/**
+ *  URI Template Expansion
+ *  ----------------------
+ *
+ *  Expansion of URI templates (RFC 6570) up to level 3, with all the
+ *  operators of the level: `{var}`, `{+var}`, `{#var}`, `{.var}`,
+ *  `{/var}`, `{;var}`, `{?var}` and `{&var}`. A template is compiled once
+ *  into a list of instructions and expanded many times with different
+ *  values of its variables.
+ *
+ *  Level 4 prefix and explode modifiers are ignored, expressions of the
+ *  reserved operators are copied to the output as they are.
+ */
+
+namespace snowcrash {
+
+    /**
+     *  \brief Values of the variables of a URI template, by the variable index
+     *
+     *  NULL value is an undefined variable, values are not copied.
+     */
+    typedef std::vector<const std::string*> URITemplateValues;
+
+    /**
+     *  \brief Compiled URI template.
+     */
+    class URITemplateExpander {
+    public:
+
+        /** Compile a URI template */
+        explicit URITemplateExpander(const URITemplate& uriTemplate);
+
+        /** \return Names of the variables of the template, by the index */
+        const std::vector<std::string>& variables() const {
+            return names;
+        }
+
+        /** \return Index of a variable, std::string::npos if not in the template */
+        size_t variableIndex(const std::string& name) const;
+
+        /**
+         *  \brief Expand the template
+         *
+         *  \param values   Values of the variables, missing ones are undefined.
+         *  \param out      Output buffer, its content is replaced.
+         */
+        void expand(const URITemplateValues& values, std::string& out) const;
+
+    private:
+
+        enum InstructionCode {
+            LiteralInstruction = 0,     /// Append `text`
+            ExpressionInstruction,      /// Begin an expression of `op`
+            VariableInstruction         /// Append the variable, `text` is its name
+        };
+
+        struct Instruction {
+            InstructionCode code;
+            URITemplateOperator op;
+            size_t variable;
+
+            /** Offset and length of the text in `texts` */
+            size_t offset;
+            size_t length;
+        };
+
+        std::vector<Instruction> instructions;
+
+        /** Literals, already encoded, and variable names */
+        std::string texts;
+
+        std::vector<std::string> names;
+
+        void addLiteral(const URITemplate& uriTemplate, size_t begin, size_t end);
+        void addExpression(const URITemplate& uriTemplate, const URITemplateExpression& expression);
+    };
+}
+
+#endif
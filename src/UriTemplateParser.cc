@@ -5,191 +5,267 @@
 //  Created by Carl Griffiths on 24/02/14.
 //  Copyright (c) 2014 Apiary Inc. All rights reserved.
 //
-#include <iomanip>
+#include <algorithm>
+#include <cstring>
+#include <sstream>
 #include "UriTemplateParser.h"
-#include "RegexMatch.h"
 
 using namespace snowcrash;
 
-static bool HasMismatchedCurlyBrackets(const URITemplate& uriTemplate) {
-    int openCount = 0;
-    int closeCount = 0;
+/** Schemes recognized in a URI, a longer one goes before its prefix */
+static const char* const URISchemes[] = { "https", "http", "ftp", "file" };
 
-    for (unsigned int i = 0; i < uriTemplate.length(); i++) {
-        if (uriTemplate[i] == '{') openCount++;
-        if (uriTemplate[i] == '}') closeCount++;
+static const char* const AllowedCharactersText = ". Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters";
+
+/**
+ *  \brief Split the URI into scheme, host and path
+ *
+ *  The URI is read up to its first NUL character. The scheme and the
+ *  "://" separator are optional, the host ends at the first slash.
+ */
+static void SplitURI(const URITemplate& uri, ParsedURITemplate& result)
+{
+    size_t length = uri.find('\0');
+
+    if (length == std::string::npos)
+        length = uri.length();
+
+    size_t pos = 0;
+
+    for (size_t i = 0; i < sizeof(URISchemes) / sizeof(URISchemes[0]); ++i) {
+        size_t schemeLength = ::strlen(URISchemes[i]);
+
+        if (schemeLength <= length && uri.compare(0, schemeLength, URISchemes[i]) == 0) {
+            pos = schemeLength;
+            break;
+        }
     }
-    return openCount != closeCount;
+
+    result.scheme.assign(uri, 0, pos);
+
+    if (length - pos >= 3 && uri.compare(pos, 3, "://") == 0)
+        pos += 3;
+
+    size_t hostEnd = uri.find('/', pos);
+
+    if (hostEnd == std::string::npos || hostEnd > length)
+        hostEnd = length;
+
+    result.host.assign(uri, pos, hostEnd - pos);
+    result.path.assign(uri, hostEnd, length - hostEnd);
 }
 
-static bool HasNestedCurlyBrackets(const URITemplate& uriTemplate) {
+/**
+ *  \brief Check the curly brackets of the path
+ *  \return Warning message, empty if the brackets match and are not nested
+ */
+static const char* CheckCurlyBrackets(const URITemplate& path)
+{
+    size_t openCount = 0;
+    size_t closeCount = 0;
     char lastBracket = ' ';
-    bool result = false;
+    bool nested = false;
 
-    for (unsigned int i = 0; i < uriTemplate.length(); i++) {
-        if (uriTemplate[i] == '{') {
-            if (lastBracket == '{') {
-                result = true;
-                break;
-            }
-            lastBracket = '{';
-        }
-        if (uriTemplate[i] == '}') {
-            if (lastBracket == '}') {
-                result = true;
-                break;
+    for (std::string::const_iterator it = path.begin(); it != path.end(); ++it) {
+        if (*it != '{' && *it != '}')
+            continue;
+
+        if (*it == '{')
+            openCount++;
+        else
+            closeCount++;
+
+        nested = nested || (*it == lastBracket);
+        lastBracket = *it;
+    }
+
+    if (openCount != closeCount)
+        return "The URI template contains mismatched expression brackets";
+
+    if (nested)
+        return "The URI template contains nested expression brackets";
+
+    return "";
+}
+
+void snowcrash::ScanURITemplateExpressions(const URITemplate& uriTemplate, URITemplateExpressions& expressions)
+{
+    size_t start = uriTemplate.find('{');
+
+    while (start != std::string::npos) {
+        size_t end = uriTemplate.find('}', start);
+
+        if (end == std::string::npos)
+            end = uriTemplate.length();
+
+        URITemplateExpression expression;
+        expression.op = NoURITemplateOperator;
+        expression.offset = start + 1;
+        expression.length = end - start - 1;
+
+        if (expression.length != 0) {
+            switch (uriTemplate[expression.offset]) {
+                case '+': expression.op = ReservedURITemplateOperator; break;
+                case '#': expression.op = FragmentURITemplateOperator; break;
+                case '.': expression.op = LabelURITemplateOperator; break;
+                case '/': expression.op = PathSegmentURITemplateOperator; break;
+                case ';': expression.op = PathStyleURITemplateOperator; break;
+                case '?': expression.op = QueryURITemplateOperator; break;
+                case '&': expression.op = QueryContinuationURITemplateOperator; break;
+                case '|': expression.op = UndefinedURITemplateOperator; break;
+                default: break;
             }
-            lastBracket = '}';
         }
+
+        expressions.push_back(expression);
+
+        if (end == uriTemplate.length())
+            break;
+
+        start = uriTemplate.find('{', end);
     }
-    return result;
 }
 
-static bool PathContainsSquareBrackets(const URITemplate& uriTemplate) {
-    return (uriTemplate.find('[') != std::string::npos || uriTemplate.find(']') != std::string::npos);
-}
+/** \return Warning message of an unsupported operator, NULL if it is supported */
+static const char* UnsupportedOperatorText(URITemplateOperator op)
+{
+    switch (op) {
+        case LabelURITemplateOperator:
+            return "URI template label expansion is not supported";
 
-static Expressions GetUriTemplateExpressions(const URITemplate& uriTemplate) {
-    Expressions expressions;
-    size_t expressionStartPos = 0;
-    size_t expressionEndPos = 0;
+        case PathSegmentURITemplateOperator:
+        case PathStyleURITemplateOperator:
+            return "URI template path segment expansion is not supported";
 
-    while (expressionStartPos != std::string::npos && expressionEndPos != std::string::npos && expressionStartPos < uriTemplate.length()) {
-        expressionStartPos = uriTemplate.find("{", expressionStartPos);
-        expressionEndPos = uriTemplate.find("}", expressionStartPos);
-        if (expressionStartPos != std::string::npos && expressionEndPos > expressionStartPos) {
-            expressions.push_back(uriTemplate.substr(expressionStartPos + 1, (expressionEndPos - expressionStartPos) - 1));
-        }
-        expressionStartPos++;
+        case UndefinedURITemplateOperator:
+            return "Unidentified expression";
+
+        default:
+            return NULL;
     }
-    return expressions;
 }
 
+static bool IsVariableCharacter(char c)
+{
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+           c == '_' || c == ',' || c == '.' || c == '|';
+}
+
+static bool IsHexCharacter(char c)
+{
+    return (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f') || (c >= '0' && c <= '9') || c == '|';
+}
 
-static ClassifiedExpression ClassifyExpression(const Expression& expression) {
+/**
+ *  \brief Check the variable names of an expression
+ *
+ *  Names are made of A-Z a-z 0-9 _ , and percent encoded characters, a dot
+ *  separates their parts. The expression may begin with an operator and end
+ *  with the explode modifier.
+ */
+static bool IsValidExpressionName(const char* begin, const char* end)
+{
+    const char* p = begin;
 
-    VariableExpression variableExpression(expression);
+    if (p == end)
+        return false;
 
-    if (variableExpression.IsExpressionType()) {
-        return variableExpression;
-    }
+    if (*p == '?' || *p == '|' || *p == '#' || *p == '+' || *p == '&')
+        ++p;
 
-    QueryStringExpression queryStringExpression(expression);
-    if (queryStringExpression.IsExpressionType()) {
-        return queryStringExpression;
-    }
+    while (p != end) {
+        if (*p == '.' && p + 1 != end && *(p + 1) == '.')
+            return false;
 
-    FragmentExpression fragmentExpression(expression);
-    if (fragmentExpression.IsExpressionType()) {
-        return fragmentExpression;
+        if (IsVariableCharacter(*p)) {
+            ++p;
+        }
+        else if (*p == '%' && end - p >= 3 && IsHexCharacter(*(p + 1)) && IsHexCharacter(*(p + 2))) {
+            p += 3;
+        }
+        else if (*p == '*' && p + 1 == end) {
+            ++p;
+        }
+        else {
+            return false;
+        }
     }
 
-    ReservedExpansionExpression reservedExpansionExpression(expression);
-    if (reservedExpansionExpression.IsExpressionType()) {
-        return reservedExpansionExpression;
-    }
+    return true;
+}
 
-    LabelExpansionExpression labelExpansionExpression(expression);
-    if (labelExpansionExpression.IsExpressionType()) {
-        return labelExpansionExpression;
-    }
+/** Check characters of an expression of a supported operator */
+static void CheckExpressionCharacters(const char* begin, const char* end, const mdp::CharactersRangeSet& sourceBlock, Report& report)
+{
+    static const char Characters[] = { ' ', '-', '=' };
+    static const char* const Texts[] = { "spaces", "hyphens", "assignment" };
 
-    PathSegmentExpansionExpression pathSegmentExpansionExpression(expression);
-    if (pathSegmentExpansionExpression.IsExpressionType()) {
-        return pathSegmentExpansionExpression;
-    }
+    bool hasIllegalCharacters = false;
 
-    PathStyleParameterExpansionExpression pathStyleParameterExpansionExpression(expression);
-    if (pathStyleParameterExpansionExpression.IsExpressionType()) {
-        return pathSegmentExpansionExpression;
-    }
+    for (size_t i = 0; i < sizeof(Characters); ++i) {
+        if (std::find(begin, end, Characters[i]) == end)
+            continue;
 
-    FormStyleQueryContinuationExpression formStyleQueryContinuationExpression(expression);
-    if (formStyleQueryContinuationExpression.IsExpressionType()) {
-        return formStyleQueryContinuationExpression;
+        std::stringstream ss;
+        ss << "URI template expression \"";
+        ss.write(begin, end - begin);
+        ss << "\" contains " << Texts[i] << AllowedCharactersText;
+        report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
+        hasIllegalCharacters = true;
     }
 
-    UndefinedExpression undefinedExpression(expression);
-
-    return undefinedExpression;
+    if (!hasIllegalCharacters && !IsValidExpressionName(begin, end)) {
+        std::stringstream ss;
+        ss << "URI template expression \"";
+        ss.write(begin, end - begin);
+        ss << "\" contains invalid characters" << AllowedCharactersText;
+        report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
+    }
 }
 
 void URITemplateParser::parse(const URITemplate& uri, const mdp::CharactersRangeSet& sourceBlock, ParsedURITemplate& result)
 {
-    CaptureGroups groups;
-    Expressions expressions;
-    size_t gSize=5;
-
     if (uri.empty()) return;
 
-    if (RegexCapture(uri, URI_REGEX, groups, gSize)) {
-        result.scheme = groups[1];
-        result.host = groups[3];
-        result.path = groups[4];
+    SplitURI(uri, result);
 
-        if (HasMismatchedCurlyBrackets(result.path)) {
-            result.report.warnings.push_back(Warning("The URI template contains mismatched expression brackets", URIWarning, sourceBlock));
-            return;
-        }
+    const char* bracketsText = CheckCurlyBrackets(result.path);
 
-        if (HasNestedCurlyBrackets(result.path)) {
-            result.report.warnings.push_back(Warning("The URI template contains nested expression brackets", URIWarning, sourceBlock));
-            return;
-        }
+    if (*bracketsText != '\0') {
+        result.report.warnings.push_back(Warning(bracketsText, URIWarning, sourceBlock));
+        return;
+    }
 
-        if (PathContainsSquareBrackets(result.path)) {
-            result.report.warnings.push_back(Warning("The URI template contains square brackets, please percent encode square brackets as %5B and %5D", URIWarning, sourceBlock));
-        }
+    if (result.path.find_first_of("[]") != std::string::npos) {
+        result.report.warnings.push_back(Warning("The URI template contains square brackets, please percent encode square brackets as %5B and %5D", URIWarning, sourceBlock));
+    }
 
-        expressions = GetUriTemplateExpressions(result.path);
-
-        ExpressionIterator currentExpression = expressions.begin();
-
-        while (currentExpression != expressions.end()) {
-
-            ClassifiedExpression classifiedExpression = ClassifyExpression(*currentExpression);
-
-            if (classifiedExpression.IsSupportedExpressionType()) {
-                bool hasIllegalCharacters = false;
-
-                if (classifiedExpression.ContainsSpaces()) {
-                    std::stringstream ss;
-                    ss << "URI template expression \"" << classifiedExpression.innerExpression << "\" contains spaces. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters";
-                    result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
-                    hasIllegalCharacters = true;
-                }
-
-                if (classifiedExpression.ContainsHyphens()) {
-                    std::stringstream ss;
-                    ss << "URI template expression \"" << classifiedExpression.innerExpression << "\" contains hyphens. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters";
-                    result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
-                    hasIllegalCharacters = true;
-                }
-
-                if (classifiedExpression.ContainsAssignment()) {
-                    std::stringstream ss;
-                    ss << "URI template expression \"" << classifiedExpression.innerExpression << "\" contains assignment. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters";
-                    result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
-                    hasIllegalCharacters = true;
-                }
-
-                if (!hasIllegalCharacters) {
-                    if (classifiedExpression.IsInvalidExpressionName()) {
-                        std::stringstream ss;
-                        ss << "URI template expression \"" << classifiedExpression.innerExpression << "\" contains invalid characters. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters";
-                        result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
-                    }
-                }
-            }
-            else{
-                result.report.warnings.push_back(Warning(classifiedExpression.unsupportedWarningText, URIWarning, sourceBlock));
-            }
-            currentExpression++;
+    ScanURITemplateExpressions(result.path, result.expressions);
+
+    for (URITemplateExpressions::const_iterator it = result.expressions.begin();
+         it != result.expressions.end();
+         ++it) {
+
+        const char* unsupportedText = UnsupportedOperatorText(it->op);
+
+        if (unsupportedText) {
+            result.report.warnings.push_back(Warning(unsupportedText, URIWarning, sourceBlock));
+            continue;
         }
+
+        const char* begin = result.path.data() + it->offset;
+        CheckExpressionCharacters(begin, begin + it->length, sourceBlock, result.report);
     }
-    else{
-        result.report.error = Error("Failed to parse URI Template", URIWarning);
+}
+
+const ParsedURITemplate& URITemplateParser::parse(const URITemplate& uri, ParsedURITemplates& cache)
+{
+    ParsedURITemplates::iterator it = cache.find(uri);
+
+    if (it == cache.end()) {
+        it = cache.insert(std::make_pair(uri, ParsedURITemplate())).first;
+        parse(uri, mdp::CharactersRangeSet(), it->second);
     }
 
+    return it->second;
 }
-
@@ -0,0 +1,350 @@
+//
+//  UriTemplateRouter.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include "UriTemplateRouter.h"
+
+using namespace snowcrash;
+
+/** Literal edge of a trie node */
+typedef std::pair<char, size_t> LiteralEdge;
+
+static bool LiteralEdgeLess(const LiteralEdge& edge, char c)
+{
+    return edge.first < c;
+}
+
+/**
+ *  \brief Thread of the trie walk
+ *
+ *  A thread is at a node, or inside the value of a variable edge leading
+ *  to the node. `parent` is the thread it continues at the previous
+ *  character of the path.
+ */
+struct RouteThread {
+    size_t node;
+    size_t parent;
+    bool isValue;
+    bool isReserved;
+    bool isValueBegin;
+};
+
+/** Add a thread after the current character unless it is there already */
+static void AddRouteThread(std::vector<RouteThread>& threads,
+                           size_t stepBegin,
+                           const RouteThread& thread)
+{
+    for (size_t i = stepBegin; i < threads.size(); ++i) {
+
+        if (threads[i].node == thread.node && threads[i].isValue == thread.isValue)
+            return;
+    }
+
+    threads.push_back(thread);
+}
+
+/** \return Variable names of an expression without its operator and modifiers */
+static std::vector<std::string> ExpressionNames(const std::string& path, const URITemplateExpression& expression)
+{
+    std::vector<std::string> names;
+
+    size_t begin = expression.offset + ((expression.op == NoURITemplateOperator) ? 0 : 1);
+    size_t end = std::min(expression.offset + expression.length, path.length());
+
+    while (begin <= end) {
+        size_t nameEnd = path.find(',', begin);
+
+        if (nameEnd == std::string::npos || nameEnd > end)
+            nameEnd = end;
+
+        std::string name = path.substr(begin, nameEnd - begin);
+        name = name.substr(0, name.find_first_of(":*"));
+
+        if (!name.empty())
+            names.push_back(name);
+
+        begin = nameEnd + 1;
+    }
+
+    return names;
+}
+
+URITemplateRouter::URITemplateRouter(const Blueprint& blueprint)
+: nodes(1)
+{
+    ParsedURITemplates parsedTemplates;
+
+    for (ResourceGroups::const_iterator groupIt = blueprint.resourceGroups.begin();
+         groupIt != blueprint.resourceGroups.end();
+         ++groupIt) {
+
+        for (Resources::const_iterator resourceIt = groupIt->resources.begin();
+             resourceIt != groupIt->resources.end();
+             ++resourceIt) {
+
+            if (resourceIt->uriTemplate.empty())
+                continue;
+
+            const ParsedURITemplate& parsed = URITemplateParser::parse(resourceIt->uriTemplate, parsedTemplates);
+
+            for (Actions::const_iterator actionIt = resourceIt->actions.begin();
+                 actionIt != resourceIt->actions.end();
+                 ++actionIt) {
+
+                if (!addRoute(*resourceIt, *actionIt, parsed))
+                    break;
+            }
+        }
+    }
+}
+
+bool URITemplateRouter::addRoute(const Resource& resource, const Action& action, const ParsedURITemplate& parsed)
+{
+    Route route;
+    route.method = action.method;
+    route.resource = &resource;
+    route.action = &action;
+
+    const std::string& path = parsed.path;
+    size_t node = 0;
+    size_t pos = 0;
+    bool isPathEnd = false;
+
+    for (URITemplateExpressions::const_iterator it = parsed.expressions.begin();
+         it != parsed.expressions.end();
+         ++it) {
+
+        // Literal characters before the expression, the path ends at a query
+        for (; !isPathEnd && pos + 1 < it->offset; ++pos) {
+
+            if (path[pos] == '?')
+                isPathEnd = true;
+            else
+                node = literalNode(node, path[pos]);
+        }
+
+        switch (it->op) {
+            case NoURITemplateOperator:
+            case ReservedURITemplateOperator:
+                if (isPathEnd)
+                    return false;
+
+                if (it->op == NoURITemplateOperator) {
+                    if (nodes[node].variable == 0) {
+                        nodes[node].variable = nodes.size();
+                        nodes.push_back(Node());
+                    }
+
+                    node = nodes[node].variable;
+                }
+                else {
+                    if (nodes[node].reserved == 0) {
+                        nodes[node].reserved = nodes.size();
+                        nodes.push_back(Node());
+                    }
+
+                    node = nodes[node].reserved;
+                }
+
+                route.pathNames.push_back(ExpressionNames(path, *it));
+                break;
+
+            case QueryURITemplateOperator:
+            case QueryContinuationURITemplateOperator:
+            {
+                Names names = ExpressionNames(path, *it);
+                route.queryNames.insert(route.queryNames.end(), names.begin(), names.end());
+                isPathEnd = true;
+                break;
+            }
+
+            case FragmentURITemplateOperator:
+                isPathEnd = true;
+                break;
+
+            default:
+                return false;
+        }
+
+        pos = it->offset + it->length + 1;
+    }
+
+    for (; !isPathEnd && pos < path.length(); ++pos) {
+
+        if (path[pos] == '?')
+            isPathEnd = true;
+        else
+            node = literalNode(node, path[pos]);
+    }
+
+    nodes[node].routes.push_back(routes.size());
+    routes.push_back(route);
+
+    return true;
+}
+
+size_t URITemplateRouter::literalNode(size_t node, char c)
+{
+    std::vector<LiteralEdge>& literals = nodes[node].literals;
+    std::vector<LiteralEdge>::iterator it = std::lower_bound(literals.begin(), literals.end(), c, LiteralEdgeLess);
+
+    if (it != literals.end() && it->first == c)
+        return it->second;
+
+    size_t next = nodes.size();
+    literals.insert(it, LiteralEdge(c, next));
+    nodes.push_back(Node());
+
+    return next;
+}
+
+size_t URITemplateRouter::findLiteral(size_t node, char c) const
+{
+    const std::vector<LiteralEdge>& literals = nodes[node].literals;
+    std::vector<LiteralEdge>::const_iterator it = std::lower_bound(literals.begin(), literals.end(), c, LiteralEdgeLess);
+
+    return (it != literals.end() && it->first == c) ? it->second : 0;
+}
+
+bool URITemplateRouter::match(const HTTPMethod& method,
+                              const std::string& path,
+                              const std::string& query,
+                              URIRouteMatch& match) const
+{
+    // Threads after each character follow the threads before it, each
+    // ordered by priority. A thread reaching a node first is kept, so
+    // literal characters win over variables and shorter values over longer.
+    std::vector<RouteThread> threads;
+    threads.reserve(path.length() + 1);
+
+    RouteThread root = { 0, 0, false, false, false };
+    threads.push_back(root);
+
+    size_t stepBegin = 0;
+
+    for (size_t pos = 0; pos < path.length() && stepBegin < threads.size(); ++pos) {
+
+        size_t stepEnd = threads.size();
+
+        for (size_t i = stepBegin; i < stepEnd; ++i) {
+
+            RouteThread thread = threads[i];
+            const Node& node = nodes[thread.node];
+            RouteThread next = { findLiteral(thread.node, path[pos]), i, false, false, false };
+
+            // A value ends before the character first, then it takes it
+            if (next.node != 0)
+                AddRouteThread(threads, stepEnd, next);
+
+            next.isValue = true;
+            next.isValueBegin = true;
+
+            if (node.variable != 0 && path[pos] != '/') {
+                next.node = node.variable;
+                AddRouteThread(threads, stepEnd, next);
+            }
+
+            if (node.reserved != 0) {
+                next.node = node.reserved;
+                next.isReserved = true;
+                AddRouteThread(threads, stepEnd, next);
+            }
+
+            if (thread.isValue && (thread.isReserved || path[pos] != '/')) {
+                thread.parent = i;
+                thread.isValueBegin = false;
+                AddRouteThread(threads, stepEnd, thread);
+            }
+        }
+
+        stepBegin = stepEnd;
+    }
+
+    // The first thread at the end of the path with a route of the method
+    const Route* route = NULL;
+    size_t last = stepBegin;
+
+    for (; last < threads.size(); ++last) {
+
+        const std::vector<size_t>& nodeRoutes = nodes[threads[last].node].routes;
+
+        for (std::vector<size_t>::const_iterator it = nodeRoutes.begin(); it != nodeRoutes.end() && !route; ++it) {
+            if (routes[*it].method == method)
+                route = &routes[*it];
+        }
+
+        if (route)
+            break;
+    }
+
+    if (!route)
+        return false;
+
+    // Values of the path expressions, begin and end, from the last thread back
+    std::vector<std::pair<size_t, size_t> > captures;
+    size_t valueEnd = std::string::npos;
+
+    for (size_t i = last, pos = path.length(); pos > 0; i = threads[i].parent, --pos) {
+
+        if (!threads[i].isValue)
+            continue;
+
+        if (valueEnd == std::string::npos)
+            valueEnd = pos;
+
+        if (threads[i].isValueBegin) {
+            captures.push_back(std::make_pair(pos - 1, valueEnd));
+            valueEnd = std::string::npos;
+        }
+    }
+
+    std::reverse(captures.begin(), captures.end());
+
+    match.resource = route->resource;
+    match.action = route->action;
+    match.bindings.clear();
+
+    // Path values, a value of more variables is split by commas
+    for (size_t i = 0; i < route->pathNames.size() && i < captures.size(); ++i) {
+
+        size_t begin = captures[i].first;
+        const Names& names = route->pathNames[i];
+
+        for (Names::const_iterator it = names.begin(); it != names.end() && begin <= captures[i].second; ++it) {
+
+            size_t end = (it + 1 == names.end()) ? std::string::npos : path.find(',', begin);
+
+            if (end == std::string::npos || end > captures[i].second)
+                end = captures[i].second;
+
+            match.bindings.push_back(KeyValuePair(*it, path.substr(begin, end - begin)));
+            begin = end + 1;
+        }
+    }
+
+    // Query values, parameters not in the template are ignored
+    for (size_t begin = 0; begin < query.length();) {
+
+        size_t end = query.find('&', begin);
+
+        if (end == std::string::npos)
+            end = query.length();
+
+        size_t separator = std::min(query.find('=', begin), end);
+        std::string name = query.substr(begin, separator - begin);
+
+        if (std::find(route->queryNames.begin(), route->queryNames.end(), name) != route->queryNames.end()) {
+            std::string value = (separator < end) ? query.substr(separator + 1, end - separator - 1) : std::string();
+            match.bindings.push_back(KeyValuePair(name, value));
+        }
+
+        begin = end + 1;
+    }
+
+    return true;
+}
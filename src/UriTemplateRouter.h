@@ -0,0 +1,141 @@
+//
+//  UriTemplateRouter.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_URITEMPLATEROUTER_H
+#define SNOWCRASH_URITEMPLATEROUTER_H
+
+#include "Blueprint.h"
+#include "UriTemplateParser.h"
+
+/**
+ *  URI Template Router
+ *  -------------------
+ *
+ *  Routes requests to the actions of a blueprint. The URI templates of all
+ *  the resources are compiled into one character trie, a lookup walks the
+ *  trie along the request path, so it does not depend on the number of
+ *  resources.
+ *
+ *  Literal characters of a template are matched before its variables. A
+ *  variable `{var}` matches at least one character and it does not span
+ *  slashes, shorter values are matched before longer ones. A reserved
+ *  variable `{+var}` spans slashes.
+ *
+ *  A lookup walks the path once. All the templates matching the path so
+ *  far are followed at once, character by character, and the bindings
+ *  are recovered for the matching route only. The lookup takes time
+ *  linear in the path length, times the number of trie nodes the path
+ *  can be at after a character, which does not grow with the path.
+ *
+ *  Variables of query expressions `{?var}` and `{&var}` are bound from the
+ *  query string and do not take part in the matching. Templates using the
+ *  operators not supported by the parser are not routed. Bound values are
+ *  not percent-decoded.
+ */
+
+namespace snowcrash {
+
+    /** Variable bindings of a route, name and value */
+    typedef Collection<KeyValuePair>::type URIBindings;
+
+    /**
+     *  \brief Action matching a request.
+     */
+    struct URIRouteMatch {
+        URIRouteMatch() : resource(NULL), action(NULL) {}
+
+        /** Resource of the action */
+        const Resource* resource;
+
+        /** Matched action */
+        const Action* action;
+
+        /** Variables of the URI template and their values */
+        URIBindings bindings;
+    };
+
+    /**
+     *  \brief Router of requests to the actions of a blueprint.
+     *
+     *  Keeps pointers to the blueprint, it has to outlive the router.
+     */
+    class URITemplateRouter {
+    public:
+
+        /** Compile the routes of all the actions of a blueprint */
+        explicit URITemplateRouter(const Blueprint& blueprint);
+
+        /**
+         *  \brief Find the action of a request
+         *
+         *  \param method   HTTP method of the request.
+         *  \param path     Path of the request without its query.
+         *  \param query    Query of the request without the question mark.
+         *  \param match    Matched action and variable bindings.
+         *  \return True if an action matches the request.
+         */
+        bool match(const HTTPMethod& method,
+                   const std::string& path,
+                   const std::string& query,
+                   URIRouteMatch& match) const;
+
+        /** \return Number of compiled routes */
+        size_t size() const {
+            return routes.size();
+        }
+
+    private:
+
+        /** Variable names of an expression */
+        typedef std::vector<std::string> Names;
+
+        /** Route to an action */
+        struct Route {
+            HTTPMethod method;
+            const Resource* resource;
+            const Action* action;
+
+            /** Names of the path expressions, by the expression */
+            std::vector<Names> pathNames;
+
+            /** Names of the query expressions */
+            Names queryNames;
+        };
+
+        /** Trie node, edges are indexes of the nodes, zero for none */
+        struct Node {
+            Node() : variable(0), reserved(0) {}
+
+            /** Literal edges, sorted by the character */
+            std::vector<std::pair<char, size_t> > literals;
+
+            /** Edge of a variable */
+            size_t variable;
+
+            /** Edge of a reserved variable */
+            size_t reserved;
+
+            /** Routes of the templates ending in the node */
+            std::vector<size_t> routes;
+        };
+
+        std::vector<Node> nodes;
+        std::vector<Route> routes;
+
+        /** Add the route of an action, false if its template is not supported */
+        bool addRoute(const Resource& resource, const Action& action, const ParsedURITemplate& parsed);
+
+        /** \return Node of a literal edge, added if missing */
+        size_t literalNode(size_t node, char c);
+
+        /** \return Node of a literal edge, zero if missing */
+        size_t findLiteral(size_t node, char c) const;
+    };
+}
+
+#endif
@@ -24,8 +24,8 @@ namespace snowcrash {
     /**
      * Values section processor
      */
-    template<>
-    struct SectionProcessor<Values> : public SectionProcessorBase<Values> {
+    template<typename Policy>
+    struct SectionProcessor<Values, Policy> : public SectionProcessorBase<Values, Policy> {
 
         static MarkdownNodeIterator processNestedSection(const MarkdownNodeIterator& node,
                                                          const MarkdownNodes& siblings,
@@ -42,12 +42,12 @@ namespace snowcrash {
                 if (captureGroups.size() > 1) {
                     out.node.push_back(captureGroups[1]);
 
-                    if (pd.exportSourceMap()) {
+                    if (Policy::exportSourceMap(pd)) {
                         SourceMap<Value> valueSM;
                         valueSM.sourceMap = node->sourceMap;
                         out.sourceMap.collection.push_back(valueSM);
                     }
-                } else {
+                } else if (pd.reportsWarning(out.report, IgnoringWarning)) {
                     TrimString(content);
 
                     // WARN: Ignoring the unexpected param value
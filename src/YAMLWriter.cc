@@ -0,0 +1,112 @@
+//
+//  YAMLWriter.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstring>
+#include "YAMLWriter.h"
+
+using namespace snowcrash;
+
+/** Class of a character in a YAML scalar */
+enum YAMLCharacterClass {
+    PlainYAMLCharacter = 0,     /// < No quotation needed
+    ReservedYAMLCharacter,      /// < Needs quotation
+    EscapedYAMLCharacter        /// < Needs quotation and escaping
+};
+
+/** Character classes, reserved are `#-[]:|>!*&%@`,{}?'`, escaped `"` and new line */
+static const unsigned char CharacterClass[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 1, 0, 1, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static YAMLCharacterClass Classify(char c)
+{
+    return static_cast<YAMLCharacterClass>(CharacterClass[static_cast<unsigned char>(c)]);
+}
+
+YAMLWriter::YAMLWriter(std::ostream& stream)
+: BufferedWriter(stream)
+{
+}
+
+YAMLWriter& YAMLWriter::operator<<(const char* value)
+{
+    write(value, ::strlen(value));
+    return *this;
+}
+
+void YAMLWriter::arrayItemLeadIn(size_t level, bool withTrailingSpace)
+{
+    if (level < 1)
+        return;
+
+    writeIndent(level - 1);
+
+    if (withTrailingSpace)
+        write("- ", 2);
+    else
+        put('-');
+}
+
+void YAMLWriter::writeEscaped(const char* begin, const char* end)
+{
+    const char* run = begin;
+
+    for (const char* p = begin; p != end; ++p) {
+
+        if (Classify(*p) != EscapedYAMLCharacter)
+            continue;
+
+        write(run, p - run);
+        put('\\');
+        put((*p == '\n') ? 'n' : *p);
+
+        run = p + 1;
+    }
+
+    write(run, end - run);
+}
+
+void YAMLWriter::scalar(const std::string& value, bool quoted)
+{
+    const char* begin = value.data();
+    const char* end = begin + value.size();
+
+    if (!quoted) {
+
+        for (const char* p = begin; p != end; ++p) {
+            if (Classify(*p) != PlainYAMLCharacter) {
+                quoted = true;
+                break;
+            }
+        }
+
+        if (!quoted) {
+            write(begin, end - begin);
+            return;
+        }
+    }
+
+    put('"');
+    writeEscaped(begin, end);
+    put('"');
+}
@@ -0,0 +1,62 @@
+//
+//  YAMLWriter.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_YAMLWRITER_H
+#define SNOWCRASH_YAMLWRITER_H
+
+#include <string>
+#include "BufferedWriter.h"
+
+namespace snowcrash {
+
+    /**
+     *  \brief Buffered YAML output writer.
+     */
+    class YAMLWriter : public BufferedWriter {
+    public:
+        explicit YAMLWriter(std::ostream& os);
+
+        /** Write raw characters, no escaping is done */
+        YAMLWriter& operator<<(const char* value);
+
+        /** Write raw string, no escaping is done */
+        YAMLWriter& operator<<(const std::string& value) {
+            write(value.data(), value.size());
+            return *this;
+        }
+
+        /** Write an unsigned number */
+        YAMLWriter& operator<<(size_t value) {
+            writeNumber(value);
+            return *this;
+        }
+
+        /** Write indentation of given level */
+        void indent(size_t level) {
+            writeIndent(level);
+        }
+
+        /** Write array item mark of given level */
+        void arrayItemLeadIn(size_t level, bool withTrailingSpace = true);
+
+        /**
+         *  \brief Write a scalar value.
+         *  \param value    A value to write
+         *  \param quoted   True to always use double quotes, false to
+         *                  quote only values with reserved characters
+         *
+         *  Double quotes and new lines of a quoted value are escaped.
+         */
+        void scalar(const std::string& value, bool quoted = true);
+
+    private:
+        void writeEscaped(const char* begin, const char* end);
+    };
+}
+
+#endif
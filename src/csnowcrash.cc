@@ -6,8 +6,14 @@
 //  Copyright (c) 2014 Apiary Inc. All rights reserved.
 //
 
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+#include <streambuf>
 #include "csnowcrash.h"
 #include "snowcrash.h"
+#include "SerializeJSON.h"
+#include "SerializeYAML.h"
 
 using namespace snowcrash;
 
@@ -27,3 +33,209 @@ int sc_c_parse(const char* source, sc_blueprint_parser_options option, sc_report
 
     return ret;
 }
+
+int sc_c_parse_n(const char* data, size_t length, sc_blueprint_parser_options option, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint)
+{
+    Report* resultReport = ::new snowcrash::Report;
+    Blueprint* resultBlueprint = ::new snowcrash::Blueprint;
+    SourceMap<Blueprint>* resultSourceMap = (option & SC_EXPORT_SORUCEMAP_OPTION) ? ::new SourceMap<Blueprint> : NULL;
+
+    // Without the option nothing is written into the source map
+    SourceMap<Blueprint> unusedSourceMap;
+    ParseResultRef<Blueprint> result(*resultReport, *resultBlueprint, (resultSourceMap) ? *resultSourceMap : unusedSourceMap);
+
+    mdp::ByteBuffer source;
+
+    if (length)
+        source.assign(data, length);
+
+    int ret = snowcrash::parse(source, option, result);
+
+    *report = AS_TYPE(sc_report_t, resultReport);
+    *blueprint = AS_TYPE(sc_blueprint_t, resultBlueprint);
+
+    if (sm_blueprint)
+        *sm_blueprint = AS_TYPE(sc_sm_blueprint_t, resultSourceMap);
+    else
+        ::delete resultSourceMap;
+
+    return ret;
+}
+
+size_t sc_buffer_write(const char* data, size_t length, void* buffer)
+{
+    sc_buffer_t* p = static_cast<sc_buffer_t*>(buffer);
+
+    if (p->capacity - p->size < length) {
+
+        size_t capacity = (p->capacity) ? p->capacity : 4096;
+
+        while (capacity - p->size < length)
+            capacity *= 2;
+
+        char* data = static_cast<char*>(::realloc(p->data, capacity));
+        if (!data)
+            return 0;
+
+        p->data = data;
+        p->capacity = capacity;
+    }
+
+    ::memcpy(p->data + p->size, data, length);
+    p->size += length;
+
+    return length;
+}
+
+void sc_buffer_free(sc_buffer_t* buffer)
+{
+    ::free(buffer->data);
+
+    buffer->data = NULL;
+    buffer->size = 0;
+    buffer->capacity = 0;
+}
+
+/**
+ *  \brief Unbuffered stream buffer of a C writer.
+ *
+ *  The serializers buffer their output, blocks are passed to the writer as they are.
+ */
+class WriterStreamBuffer : public std::streambuf {
+public:
+    WriterStreamBuffer(sc_write_t write_, void* context_)
+    : write(write_), context(context_) {}
+
+protected:
+    virtual int_type overflow(int_type c) {
+        if (traits_type::eq_int_type(c, traits_type::eof()))
+            return traits_type::not_eof(c);
+
+        char value = traits_type::to_char_type(c);
+        return (write(&value, 1, context) == 1) ? c : traits_type::eof();
+    }
+
+    virtual std::streamsize xsputn(const char* data, std::streamsize length) {
+        return static_cast<std::streamsize>(write(data, static_cast<size_t>(length), context));
+    }
+
+private:
+    sc_write_t write;
+    void* context;
+};
+
+/** Serialization format of `ParseAndSerialize` */
+enum SerializeFormat {
+    JSONSerializeFormat,
+    YAMLSerializeFormat
+};
+
+static int ParseAndSerialize(const char* data, size_t length, sc_blueprint_parser_options options, sc_serialize_options serializeOptions, SerializeFormat format, sc_write_t write, void* context, sc_report_t** report)
+{
+    mdp::ByteBuffer source;
+
+    if (length)
+        source.assign(data, length);
+
+    ParseResult<Blueprint> blueprint;
+    int ret = snowcrash::parse(source, options, blueprint);
+
+    WriterStreamBuffer buffer(write, context);
+    std::ostream os(&buffer);
+
+    SerializeOptions flags = (serializeOptions & SC_COMPACT_SERIALIZE_OPTION) ? CompactSerializeOption : 0;
+
+    if (format == JSONSerializeFormat) {
+
+        if (options & SC_EXPORT_SORUCEMAP_OPTION)
+            SerializeCombinedJSON(blueprint.node, blueprint.sourceMap, os, flags);
+        else
+            SerializeJSON(blueprint.node, os, flags);
+    }
+    else {
+        SerializeYAML(blueprint.node, os, flags);
+
+        if (options & SC_EXPORT_SORUCEMAP_OPTION) {
+            os << "---\n";
+            SerializeSourceMapYAML(blueprint.sourceMap, os, flags);
+        }
+    }
+
+    os.flush();
+
+    if (report)
+        *report = AS_TYPE(sc_report_t, ::new Report(blueprint.report));
+
+    if (ret == 0 && !os)
+        ret = ApplicationError;
+
+    return ret;
+}
+
+int sc_c_parse_to_json(const char* data, size_t length, sc_blueprint_parser_options options, sc_serialize_options serialize_options, sc_write_t write, void* context, sc_report_t** report)
+{
+    return ParseAndSerialize(data, length, options, serialize_options, JSONSerializeFormat, write, context, report);
+}
+
+int sc_c_parse_to_yaml(const char* data, size_t length, sc_blueprint_parser_options options, sc_serialize_options serialize_options, sc_write_t write, void* context, sc_report_t** report)
+{
+    return ParseAndSerialize(data, length, options, serialize_options, YAMLSerializeFormat, write, context, report);
+}
+
+/** Parse context and its results */
+struct ResultParseContext {
+    Report* report;
+    ParseContext* context;
+
+    /** Without the option nothing is written into the source map */
+    SourceMap<Blueprint> unusedSourceMap;
+};
+
+sc_parse_context_t* sc_parse_context_new(const char* data, size_t length, sc_blueprint_parser_options option, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint)
+{
+    Report* resultReport = ::new snowcrash::Report;
+    Blueprint* resultBlueprint = ::new snowcrash::Blueprint;
+    SourceMap<Blueprint>* resultSourceMap = NULL;
+
+    if (sm_blueprint && (option & SC_EXPORT_SORUCEMAP_OPTION))
+        resultSourceMap = ::new SourceMap<Blueprint>;
+
+    ResultParseContext* p = ::new ResultParseContext;
+    ParseResultRef<Blueprint> result(*resultReport, *resultBlueprint, (resultSourceMap) ? *resultSourceMap : p->unusedSourceMap);
+
+    mdp::ByteBuffer source;
+
+    if (length)
+        source.assign(data, length);
+
+    p->report = resultReport;
+    p->context = ::new ParseContext(source, option, result);
+
+    *report = AS_TYPE(sc_report_t, resultReport);
+    *blueprint = AS_TYPE(sc_blueprint_t, resultBlueprint);
+
+    if (sm_blueprint)
+        *sm_blueprint = AS_TYPE(sc_sm_blueprint_t, resultSourceMap);
+
+    return AS_TYPE(sc_parse_context_t, p);
+}
+
+int sc_parse_context_step(sc_parse_context_t* context, size_t budget)
+{
+    ResultParseContext* p = AS_TYPE(ResultParseContext, context);
+
+    if (!p->context->step(budget))
+        return SC_PARSE_IN_PROGRESS;
+
+    return p->report->error.code;
+}
+
+void sc_parse_context_free(sc_parse_context_t* context)
+{
+    ResultParseContext* p = AS_TYPE(ResultParseContext, context);
+    if (!p)
+        return;
+
+    ::delete p->context;
+    ::delete p;
+}
@@ -33,6 +33,115 @@ extern "C" {
      */
     SC_API int sc_c_parse(const char* source, sc_blueprint_parser_options option, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint);
 
+    /**
+     *  \This is C interface for snowcrash parser of a source of given length.
+     *
+     *  \param data          A textual source data to be parsed, not NUL-terminated.
+     *  \param length        Length of the source data in bytes.
+     *  \param options       Parser options. Use 0 for no addtional options.
+     *  \param report        returns the pointer to report.
+     *  \param blueprint     returns the pointer to blueprint AST.
+     *  \param sm_blueprint  returns the pointer to blueprint source map, NULL without
+     *                       `SC_EXPORT_SORUCEMAP_OPTION`. Can be NULL without the option.
+     *
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     *
+     *  The source data is copied before parsing, it does not have to outlive the call.
+     *  The results are deallocated by `sc_blueprint_free`, `sc_sm_blueprint_free`
+     *  and `sc_report_free`.
+     */
+    SC_API int sc_c_parse_n(const char* data, size_t length, sc_blueprint_parser_options option, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint);
+
+    /** brief Serialization Options */
+    typedef unsigned int sc_serialize_options;
+
+    /** brief Serialization Options Enums */
+    enum sc_serialize_option {
+        SC_COMPACT_SERIALIZE_OPTION = (1 << 0)          /// < Omit insignificant whitespace
+    };
+
+    /**
+     *  \Writer of serialized output.
+     *
+     *  \return Number of bytes written, writing stops if less than `length`.
+     */
+    typedef size_t (*sc_write_t)(const char* data, size_t length, void* context);
+
+    /** Growable output buffer, `data` is NULL or allocated by malloc() */
+    typedef struct sc_buffer_s {
+        char* data;
+        size_t size;
+        size_t capacity;
+    } sc_buffer_t;
+
+    /** Writer appending to `sc_buffer_t` passed as the context, the data is not NUL-terminated */
+    SC_API size_t sc_buffer_write(const char* data, size_t length, void* buffer);
+
+    /** \deallocate Data of the buffer and empty it */
+    SC_API void sc_buffer_free(sc_buffer_t* buffer);
+
+    /**
+     *  \Parse a source and serialize its AST into JSON in one call.
+     *
+     *  \param data              A textual source data to be parsed, not NUL-terminated.
+     *  \param length            Length of the source data in bytes.
+     *  \param options           Parser options. Use 0 for no addtional options.
+     *  \param serialize_options Serialization options.
+     *  \param write             Writer of the output.
+     *  \param context           Passed to the writer, e.g. `sc_buffer_t` for `sc_buffer_write`.
+     *  \param report            returns the pointer to report, can be NULL.
+     *
+     *  \return Error status code of the parser, 1 if the output is not written completely.
+     *
+     *  With `SC_EXPORT_SORUCEMAP_OPTION` the document has the AST under the `ast`
+     *  key and the source map under the `sourcemap` key. The report is deallocated
+     *  by `sc_report_free`.
+     */
+    SC_API int sc_c_parse_to_json(const char* data, size_t length, sc_blueprint_parser_options options, sc_serialize_options serialize_options, sc_write_t write, void* context, sc_report_t** report);
+
+    /**
+     *  \Parse a source and serialize its AST into YAML in one call.
+     *
+     *  Parameters are the same as of `sc_c_parse_to_json`. With `SC_EXPORT_SORUCEMAP_OPTION`
+     *  the source map follows the AST as the second document of the output.
+     */
+    SC_API int sc_c_parse_to_yaml(const char* data, size_t length, sc_blueprint_parser_options options, sc_serialize_options serialize_options, sc_write_t write, void* context, sc_report_t** report);
+
+    /** Blueprint parse in steps */
+    struct sc_parse_context_s;
+    typedef struct sc_parse_context_s sc_parse_context_t;
+
+    /** Status of `sc_parse_context_step` of an unfinished parse */
+    #define SC_PARSE_IN_PROGRESS (-1)
+
+    /**
+     *  \Start parsing a source in steps.
+     *
+     *  Parameters are the same as of `sc_c_parse_n`, the source is copied. The
+     *  source map is allocated only with `SC_EXPORT_SORUCEMAP_OPTION`, it is NULL
+     *  otherwise and `sm_blueprint` can be NULL. The results are complete once
+     *  the parse is done, they are deallocated by
+     *  `sc_blueprint_free`, `sc_sm_blueprint_free` and `sc_report_free` independently
+     *  of the context. The context is deallocated by `sc_parse_context_free`.
+     */
+    SC_API sc_parse_context_t* sc_parse_context_new(const char* data, size_t length, sc_blueprint_parser_options option, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint);
+
+    /**
+     *  \Parse at most `budget` steps.
+     *
+     *  The first call parses the Markdown only, whatever the budget. Every step of
+     *  a later call processes one top-level node, one node of a resource group or
+     *  one node of a resource, a whole action at most. Neither the Markdown pass
+     *  nor a step is bounded in time: the Markdown pass takes time proportional
+     *  to the whole source, a step to the node or action it processes.
+     *
+     *  \return SC_PARSE_IN_PROGRESS until the parse is done, then the error status code.
+     */
+    SC_API int sc_parse_context_step(sc_parse_context_t* context, size_t budget);
+
+    /** \deallocate Parse context */
+    SC_API void sc_parse_context_free(sc_parse_context_t* context);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,65 @@
+//
+//  Directory.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include "Directory.h"
+
+using namespace snowcrash;
+
+bool snowcrash::IsDirectory(const std::string& path)
+{
+    struct stat info;
+    return ::stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+bool snowcrash::ListDirectory(const std::string& path, std::vector<std::string>& files)
+{
+    DIR* directory = ::opendir(path.c_str());
+
+    if (!directory)
+        return false;
+
+    std::string prefix = path;
+
+    if (prefix.empty() || prefix[prefix.size() - 1] != '/')
+        prefix += '/';
+
+    bool result = true;
+
+    while (struct dirent* entry = ::readdir(directory)) {
+
+        if (entry->d_name[0] == '.')
+            continue;
+
+        std::string child = prefix + entry->d_name;
+        struct stat info;
+
+        if (::lstat(child.c_str(), &info) != 0) {
+            result = false;
+            break;
+        }
+
+        if (S_ISDIR(info.st_mode)) {
+
+            if (!ListDirectory(child, files)) {
+                result = false;
+                break;
+            }
+        }
+        else if (S_ISREG(info.st_mode)) {
+            files.push_back(child);
+        }
+        else if (S_ISLNK(info.st_mode) && ::stat(child.c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+            files.push_back(child);
+        }
+    }
+
+    ::closedir(directory);
+    return result;
+}
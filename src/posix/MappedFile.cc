@@ -0,0 +1,65 @@
+//
+//  MappedFile.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "MappedFile.h"
+
+using namespace snowcrash;
+
+MappedFile::MappedFile()
+: address(NULL), length(0)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const std::string& path)
+{
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) == -1) {
+        ::close(fd);
+        return false;
+    }
+
+    if (info.st_size > 0) {
+        void* mapping = ::mmap(NULL, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+
+        address = mapping;
+        length = static_cast<size_t>(info.st_size);
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (address)
+        ::munmap(address, length);
+
+    address = NULL;
+    length = 0;
+}
@@ -0,0 +1,112 @@
+//
+//  Parallel.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <pthread.h>
+#include <unistd.h>
+#include <stdexcept>
+#include <vector>
+#include "Parallel.h"
+
+using namespace snowcrash;
+
+/** State of a parallel loop shared by its workers */
+struct ParallelLoop {
+    ParallelTask task;
+    void* context;
+    size_t count;
+    size_t next;
+    bool failed;
+    pthread_mutex_t mutex;
+};
+
+/** Pick the next iteration of a loop, false if there is none */
+static bool NextIteration(ParallelLoop& loop, size_t& index)
+{
+    pthread_mutex_lock(&loop.mutex);
+
+    bool available = !loop.failed && loop.next < loop.count;
+
+    if (available)
+        index = loop.next++;
+
+    pthread_mutex_unlock(&loop.mutex);
+
+    return available;
+}
+
+/** Run iterations of a loop until there are none left */
+static void* RunWorker(void* argument)
+{
+    ParallelLoop& loop = *static_cast<ParallelLoop*>(argument);
+    size_t index;
+
+    while (NextIteration(loop, index)) {
+
+        try {
+            loop.task(index, loop.context);
+        }
+        catch (...) {
+            pthread_mutex_lock(&loop.mutex);
+            loop.failed = true;
+            pthread_mutex_unlock(&loop.mutex);
+        }
+    }
+
+    return NULL;
+}
+
+void snowcrash::ParallelFor(ParallelTask task, void* context, size_t count, size_t workers)
+{
+    if (count == 0)
+        return;
+
+    if (workers == 0)
+        workers = ProcessorCount();
+
+    if (workers > count)
+        workers = count;
+
+    ParallelLoop loop;
+    loop.task = task;
+    loop.context = context;
+    loop.count = count;
+    loop.next = 0;
+    loop.failed = false;
+    pthread_mutex_init(&loop.mutex, NULL);
+
+    // Workers which can not be started are left to the others
+    std::vector<pthread_t> threads;
+    threads.reserve(workers - 1);
+
+    for (size_t i = 1; i < workers; ++i) {
+
+        pthread_t thread;
+
+        if (pthread_create(&thread, NULL, RunWorker, &loop) != 0)
+            break;
+
+        threads.push_back(thread);
+    }
+
+    RunWorker(&loop);
+
+    for (std::vector<pthread_t>::iterator it = threads.begin(); it != threads.end(); ++it) {
+        pthread_join(*it, NULL);
+    }
+
+    pthread_mutex_destroy(&loop.mutex);
+
+    if (loop.failed)
+        throw std::runtime_error("parallel task failed");
+}
+
+size_t snowcrash::ProcessorCount()
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? static_cast<size_t>(count) : 1;
+}
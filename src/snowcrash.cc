@@ -50,6 +50,34 @@ static bool CheckSource(const mdp::ByteBuffer& source, Report& report)
 int snowcrash::parse(const mdp::ByteBuffer& source,
                      BlueprintParserOptions options,
                      const ParseResultRef<Blueprint>& out)
+{
+    return parse(source, options, ReportOptions(), out);
+}
+
+int snowcrash::parse(const mdp::ByteBuffer& source,
+                     BlueprintParserOptions options,
+                     const ReportOptions& reportOptions,
+                     const ParseResultRef<Blueprint>& out)
+{
+    Parser parser;
+    return parser.parse(source, options, reportOptions, out);
+}
+
+snowcrash::Parser::Parser()
+{
+}
+
+int snowcrash::Parser::parse(const mdp::ByteBuffer& source,
+                             BlueprintParserOptions options,
+                             const ParseResultRef<Blueprint>& out)
+{
+    return parse(source, options, ReportOptions(), out);
+}
+
+int snowcrash::Parser::parse(const mdp::ByteBuffer& source,
+                             BlueprintParserOptions options,
+                             const ReportOptions& reportOptions,
+                             const ParseResultRef<Blueprint>& out)
 {
     try {
 
@@ -62,15 +90,25 @@ int snowcrash::parse(const mdp::ByteBuffer& source,
             return out.report.error.code;
 
         // Parse Markdown
-        mdp::MarkdownParser markdownParser;
         mdp::MarkdownNode markdownAST;
         markdownParser.parse(source, markdownAST);
+        markdown.build(markdownAST);
 
-        // Build SectionParserData
-        SectionParserData pd(options, source, out.node);
+        // Build SectionParserData, its stack keeps the capacity of the previous parses
+        SectionParserData pd(options, source, out.node, markdown);
+        pd.reportOptions = reportOptions;
+        pd.sectionsContext.swap(sectionsContext);
+        pd.sectionsContext.clear();
 
         // Parse Blueprint
-        BlueprintParser::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
+        if (pd.exportSourceMap()) {
+            SectionParser<Blueprint, BlueprintSectionAdapter, SourceMapPolicy>::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
+        }
+        else {
+            SectionParser<Blueprint, BlueprintSectionAdapter, NoSourceMapPolicy>::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
+        }
+
+        sectionsContext.swap(pd.sectionsContext);
     }
     catch (const std::exception& e) {
 
@@ -85,3 +123,202 @@ int snowcrash::parse(const mdp::ByteBuffer& source,
 
     return out.report.error.code;
 }
+
+void snowcrash::Parser::release()
+{
+    SectionParserData::SectionsStack().swap(sectionsContext);
+    FlatMarkdown().swap(markdown);
+}
+
+/**
+ *  \brief State of a parse in steps
+ *
+ *  Resource groups and their resources are parsed step by step too, the
+ *  group and the resource being parsed are kept here until they are added
+ *  to their parents.
+ */
+struct snowcrash::ParseContext::State {
+    mdp::ByteBuffer source;
+    BlueprintParserOptions options;
+    ParseResultRef<Blueprint> out;
+    mdp::MarkdownNode markdownAST;
+    FlatMarkdown markdown;
+    SectionParserData* pd;
+    SectionParserCursor cursor;
+
+    bool inResourceGroup;
+    SectionParserCursor resourceGroupCursor;
+    ResourceGroup resourceGroup;
+    SourceMap<ResourceGroup> resourceGroupSourceMap;
+
+    bool inResource;
+    SectionParserCursor resourceCursor;
+    Resource resource;
+    SourceMap<Resource> resourceSourceMap;
+
+    State(const mdp::ByteBuffer& source_, BlueprintParserOptions options_, const ParseResultRef<Blueprint>& out_)
+    : source(source_), options(options_), out(out_), pd(NULL), inResourceGroup(false), inResource(false) {
+        cursor.phase = SignatureSectionParserPhase;
+    }
+
+    ~State() {
+        delete pd;
+    }
+
+    /** Parse the Markdown, \return False if there is nothing to parse */
+    bool start(const ReportOptions& reportOptions) {
+
+        // Sanity Check
+        if (!CheckSource(source, out.report))
+            return false;
+
+        // Do nothing if blueprint is empty
+        if (source.empty())
+            return false;
+
+        // Parse Markdown
+        mdp::MarkdownParser markdownParser;
+        markdownParser.parse(source, markdownAST);
+        markdown.build(markdownAST);
+
+        // Build SectionParserData
+        pd = new SectionParserData(options, source, out.node, markdown);
+        pd->reportOptions = reportOptions;
+
+        // The root is the first node
+        SectionParser<Blueprint, BlueprintSectionAdapter>::begin(markdown.nodes.front().firstChild, 0, markdown, cursor);
+
+        return true;
+    }
+
+    /** Parse next node of the blueprint, of its resource group or of the resource */
+    template<typename Policy>
+    void step() {
+
+        typedef SectionParser<Blueprint, BlueprintSectionAdapter, Policy> StepParser;
+        typedef SectionParser<ResourceGroup, HeaderSectionAdapter, Policy> ResourceGroupParser;
+        typedef SectionParser<Resource, HeaderSectionAdapter, Policy> ResourceParser;
+
+        ParseResultRef<ResourceGroup> group(out.report, resourceGroup, resourceGroupSourceMap);
+        ParseResultRef<Resource> groupResource(out.report, resource, resourceSourceMap);
+
+        if (inResource) {
+
+            if (!ResourceParser::step(resourceCursor, *pd, groupResource))
+                return;
+
+            SectionProcessor<ResourceGroup, Policy>::addResource(markdown.iterator(resourceCursor.siblings, resourceCursor.node), *pd, groupResource, group);
+            ResourceGroupParser::endNestedSection(resourceGroupCursor, resourceCursor.next, *pd, group);
+
+            inResource = false;
+            resource = Resource();
+            resourceSourceMap = SourceMap<Resource>();
+
+            return;
+        }
+
+        if (inResourceGroup) {
+
+            // Enter resource, see SectionProcessor<ResourceGroup>::processNestedSection()
+            if (resourceGroupCursor.phase == NestedSectionParserPhase &&
+                resourceGroupCursor.cur != NoFlatNode) {
+
+                SectionType nestedType = ResourceGroupParser::beginNestedSection(resourceGroupCursor, *pd);
+
+                if (nestedType == ResourceSectionType) {
+                    ResourceParser::begin(resourceGroupCursor.cur, resourceGroupCursor.collection, markdown, resourceCursor);
+                    inResource = true;
+                    return;
+                }
+
+                pd->sectionsContext.pop_back();
+            }
+
+            if (!ResourceGroupParser::step(resourceGroupCursor, *pd, group))
+                return;
+
+            SectionProcessor<Blueprint, Policy>::addResourceGroup(markdown.iterator(resourceGroupCursor.siblings, resourceGroupCursor.node), *pd, group, out);
+            StepParser::endNestedSection(cursor, resourceGroupCursor.next, *pd, out);
+
+            inResourceGroup = false;
+            resourceGroup = ResourceGroup();
+            resourceGroupSourceMap = SourceMap<ResourceGroup>();
+
+            return;
+        }
+
+        // Enter resource group, see SectionProcessor<Blueprint>::processNestedSection()
+        if (cursor.phase == NestedSectionParserPhase &&
+            cursor.cur != NoFlatNode) {
+
+            SectionType nestedType = StepParser::beginNestedSection(cursor, *pd);
+
+            if (nestedType == ResourceGroupSectionType || nestedType == ResourceSectionType) {
+                ResourceGroupParser::begin(cursor.cur, cursor.collection, markdown, resourceGroupCursor);
+                inResourceGroup = true;
+                return;
+            }
+
+            pd->sectionsContext.pop_back();
+        }
+
+        StepParser::step(cursor, *pd, out);
+    }
+};
+
+snowcrash::ParseContext::ParseContext(const mdp::ByteBuffer& source,
+                                      BlueprintParserOptions options,
+                                      const ParseResultRef<Blueprint>& out)
+: state(new State(source, options, out))
+{
+}
+
+snowcrash::ParseContext::~ParseContext()
+{
+    delete state;
+}
+
+bool snowcrash::ParseContext::step(size_t budget)
+{
+    try {
+
+        // The Markdown pass is a call of its own
+        if (!state->pd) {
+
+            if (!isDone() && budget > 0 && !state->start(reportOptions))
+                state->cursor.phase = DoneSectionParserPhase;
+
+            return isDone();
+        }
+
+        for (; budget > 0 && !isDone(); --budget) {
+
+            // Parse Blueprint
+            if (state->pd->exportSourceMap()) {
+                state->step<SourceMapPolicy>();
+            }
+            else {
+                state->step<NoSourceMapPolicy>();
+            }
+        }
+    }
+    catch (const std::exception& e) {
+
+        std::stringstream ss;
+        ss << "parser exception: '" << e.what() << "'";
+        state->out.report.error = Error(ss.str(), 1);
+        state->cursor.phase = DoneSectionParserPhase;
+    }
+    catch (...) {
+
+        state->out.report.error = Error("parser exception has occured", 1);
+        state->cursor.phase = DoneSectionParserPhase;
+    }
+
+    return isDone();
+}
+
+bool snowcrash::ParseContext::isDone() const
+{
+    return state->cursor.phase == DoneSectionParserPhase;
+}
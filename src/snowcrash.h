@@ -12,6 +12,7 @@
 #include "BlueprintSourcemap.h"
 #include "SourceAnnotation.h"
 #include "SectionParser.h"
+#include "MarkdownParser.h"
 
 /**
  *  API Blueprint Parser Interface
@@ -39,6 +40,122 @@ namespace snowcrash {
     int parse(const mdp::ByteBuffer& source,
               BlueprintParserOptions options,
               const ParseResultRef<Blueprint>& out);
+
+    /**
+     *  \brief Parse the source data into a blueprint abstract source tree (AST).
+     *
+     *  \param source           A textual source data to be parsed.
+     *  \param options          Parser options. Use 0 for no additional options.
+     *  \param reportOptions    Warnings filtering options.
+     *  \param out              Output buffer to store parsing result into.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const mdp::ByteBuffer& source,
+              BlueprintParserOptions options,
+              const ReportOptions& reportOptions,
+              const ParseResultRef<Blueprint>& out);
+
+    /**
+     *  \brief Reusable blueprint parser.
+     *
+     *  Keeps the Markdown parser and the capacity of the section context
+     *  stack and of the flattened Markdown AST between the calls. The
+     *  Markdown AST and the symbol tables are built anew for every
+     *  blueprint. A parser is not thread-safe, `parse()` uses a new one for
+     *  every call.
+     */
+    class Parser {
+    public:
+        Parser();
+
+        /**
+         *  \brief Parse the source data into a blueprint abstract source tree (AST).
+         *
+         *  \param source       A textual source data to be parsed.
+         *  \param options      Parser options. Use 0 for no additional options.
+         *  \param out          Output buffer to store parsing result into.
+         *  \return Error status code. Zero represents success, non-zero a failure.
+         */
+        int parse(const mdp::ByteBuffer& source,
+                  BlueprintParserOptions options,
+                  const ParseResultRef<Blueprint>& out);
+
+        /**
+         *  \brief Parse the source data into a blueprint abstract source tree (AST).
+         *
+         *  \param source           A textual source data to be parsed.
+         *  \param options          Parser options. Use 0 for no additional options.
+         *  \param reportOptions    Warnings filtering options.
+         *  \param out              Output buffer to store parsing result into.
+         *  \return Error status code. Zero represents success, non-zero a failure.
+         */
+        int parse(const mdp::ByteBuffer& source,
+                  BlueprintParserOptions options,
+                  const ReportOptions& reportOptions,
+                  const ParseResultRef<Blueprint>& out);
+
+        /** Release the capacity of the section context stack and of the flattened Markdown AST */
+        void release();
+
+    private:
+        mdp::MarkdownParser markdownParser;
+        SectionParserData::SectionsStack sectionsContext;
+        FlatMarkdown markdown;
+
+        Parser(const Parser&);
+        Parser& operator=(const Parser&);
+    };
+
+    /**
+     *  \brief Blueprint parse in steps.
+     *
+     *  Parses a blueprint a few steps per call of `step()`, e.g. to interleave
+     *  parsing with other work of an event loop. The result is the same as
+     *  of `parse()`.
+     *
+     *  The first call parses the Markdown only, whatever its budget. Every
+     *  step of a later call processes one top-level node, one node of a
+     *  resource group or one node of a resource. An action is processed
+     *  in one step with all its payloads and their sections.
+     *
+     *  Neither the Markdown pass nor one step is bounded in time. The
+     *  Markdown pass takes time proportional to the whole source, it runs
+     *  in the Markdown parser and can't be split. A step takes time
+     *  proportional to the node or the action it processes.
+     */
+    class ParseContext {
+    public:
+
+        /**
+         *  \param source       A textual source data to be parsed, copied.
+         *  \param options      Parser options. Use 0 for no additional options.
+         *  \param out          Output buffer to store parsing result into, complete once done.
+         */
+        ParseContext(const mdp::ByteBuffer& source,
+                     BlueprintParserOptions options,
+                     const ParseResultRef<Blueprint>& out);
+
+        ~ParseContext();
+
+        /** Warnings filtering options, to be set before the first step */
+        ReportOptions reportOptions;
+
+        /**
+         *  \brief  Parse at most `budget` steps, or the Markdown on the first call
+         *  \return True if the blueprint is parsed
+         */
+        bool step(size_t budget);
+
+        /** \returns True if the blueprint is parsed */
+        bool isDone() const;
+
+    private:
+        struct State;
+        State* state;
+
+        ParseContext(const ParseContext&);
+        ParseContext& operator=(const ParseContext&);
+    };
 }
 
 #endif
@@ -0,0 +1,58 @@
+//
+//  Batch.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "Batch.h"
+
+std::string OutputFileName(const std::string& pathTemplate, const std::string& input, const std::string& extension)
+{
+    std::string::size_type nameBegin = input.find_last_of("/\\");
+    nameBegin = (nameBegin == std::string::npos) ? 0 : nameBegin + 1;
+
+    std::string::size_type extensionBegin = input.rfind('.');
+
+    if (extensionBegin == std::string::npos || extensionBegin <= nameBegin)
+        extensionBegin = input.size();
+
+    std::string path = input.substr(0, extensionBegin);
+    std::string name = input.substr(nameBegin, extensionBegin - nameBegin);
+
+    std::string result;
+    std::string::size_type i = 0;
+
+    while (i < pathTemplate.size()) {
+
+        if (pathTemplate.compare(i, 6, "{path}") == 0) {
+            result += path;
+            i += 6;
+        }
+        else if (pathTemplate.compare(i, 6, "{name}") == 0) {
+            result += name;
+            i += 6;
+        }
+        else if (pathTemplate.compare(i, 5, "{ext}") == 0) {
+            result += extension;
+            i += 5;
+        }
+        else {
+            result += pathTemplate[i++];
+        }
+    }
+
+    return result;
+}
+
+bool IsBlueprintFile(const std::string& path)
+{
+    std::string::size_type extension = path.rfind('.');
+
+    if (extension == std::string::npos)
+        return false;
+
+    return path.compare(extension, std::string::npos, ".apib") == 0 ||
+           path.compare(extension, std::string::npos, ".md") == 0;
+}
@@ -0,0 +1,28 @@
+//
+//  Batch.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_BATCH_H
+#define SNOWCRASH_BATCH_H
+
+#include <string>
+
+/**
+ *  \brief  Output file name of an input file of a batch
+ *  \param  pathTemplate    Template of the name, {path} is replaced by the input
+ *                          path without extension, {name} by the input file name
+ *                          without extension and {ext} by the output extension
+ *  \param  input       Input file path
+ *  \param  extension   Extension of the output format
+ *  \return Output file name
+ */
+std::string OutputFileName(const std::string& pathTemplate, const std::string& input, const std::string& extension);
+
+/** \return True if a file of an input directory is an API Blueprint, by its extension */
+bool IsBlueprintFile(const std::string& path);
+
+#endif
@@ -0,0 +1,1033 @@
+//
+//  Server.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <map>
+#include <sstream>
+#include <vector>
+#include "Server.h"
+#include "snowcrash.h"
+#include "JSONReader.h"
+#include "JSONWriter.h"
+#include "SerializeJSON.h"
+#include "SerializeNDJSON.h"
+#include "SerializeYAML.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sys/inotify.h>
+#endif
+
+using snowcrash::JSONReader;
+using snowcrash::JSONWriter;
+
+/// \enum JSON-RPC error codes.
+enum RPCErrorCode {
+    ParseRPCErrorCode = -32700,
+    InvalidRequestRPCErrorCode = -32600,
+    MethodNotFoundRPCErrorCode = -32601,
+    InvalidParamsRPCErrorCode = -32602,
+    InputRPCErrorCode = -32000
+};
+
+/// \brief Maximum number of cached parse results of sources sent in requests.
+static const size_t MaxCachedSources = 64;
+
+/// \brief Modification time and size of a file, to tell a changed file without reading it.
+struct FileStamp {
+    time_t time;
+    long nanoseconds;
+    off_t size;
+
+    FileStamp() : time(0), nanoseconds(0), size(0) {}
+
+    bool operator==(const FileStamp& rhs) const {
+        return time == rhs.time && nanoseconds == rhs.nanoseconds && size == rhs.size;
+    }
+};
+
+/// \brief Parse result of a source, always with its sourcemap.
+struct CacheEntry {
+    size_t hash;
+    mdp::ByteBuffer source;
+    snowcrash::ParseResult<snowcrash::Blueprint> result;
+    FileStamp stamp;    /// < Stamp of a file taken before it was read
+    bool watched;       /// < A file parsed by the watcher, kept current by it
+
+    CacheEntry() : hash(0), watched(false) {}
+};
+
+/// \brief Cached parse results of files and sources.
+struct ServerCache {
+    std::map<std::string, CacheEntry*> files;
+    std::map<size_t, CacheEntry*> sources;
+    std::list<size_t> sourceOrder;  /// < Hashes of cached sources, oldest first
+    snowcrash::Parser parser;       /// < Parser of the requests, one request is handled at a time
+
+#ifdef __linux__
+    pthread_mutex_t mutex;
+    pthread_t watcher;
+    int inotify;
+    int stopPipe[2];
+    std::map<int, std::string> directories;    /// < Watched directories by watch descriptor
+#endif
+};
+
+/// \brief A request and its parameters.
+struct Request {
+    std::string id;             /// < Raw JSON of the id, empty for a notification
+    std::string method;
+    std::string path;
+    mdp::ByteBuffer source;
+    bool hasSource;
+    std::string format;
+    bool compact;
+    bool sourcemap;
+
+    Request() : hasSource(false), format("json"), compact(false), sourcemap(false) {}
+};
+
+/// \brief Lock of the cache for the scope of the lock.
+class CacheLock {
+public:
+    explicit CacheLock(ServerCache& cache_) : cache(cache_) {
+#ifdef __linux__
+        pthread_mutex_lock(&cache.mutex);
+#endif
+    }
+
+    ~CacheLock() {
+#ifdef __linux__
+        pthread_mutex_unlock(&cache.mutex);
+#endif
+    }
+
+private:
+    ServerCache& cache;
+
+    CacheLock(const CacheLock&);
+    CacheLock& operator=(const CacheLock&);
+};
+
+/// \brief FNV-1a hash of a source.
+/// \param source A source to hash
+static size_t Hash(const mdp::ByteBuffer& source)
+{
+    size_t hash = static_cast<size_t>(2166136261u);
+
+    for (mdp::ByteBuffer::const_iterator it = source.begin(); it != source.end(); ++it) {
+        hash ^= static_cast<unsigned char>(*it);
+        hash *= static_cast<size_t>(16777619u);
+    }
+
+    return hash;
+}
+
+/// \brief Parse a source into a new cache entry.
+/// \param parser Parser of the calling thread
+/// \param source A source to parse
+/// \param hash Hash of the source
+static CacheEntry* Parse(snowcrash::Parser& parser, const mdp::ByteBuffer& source, size_t hash)
+{
+    CacheEntry* entry = new CacheEntry;
+    entry->hash = hash;
+    entry->source = source;
+
+    parser.parse(source, snowcrash::ExportSourcemapOption, entry->result);
+
+    return entry;
+}
+
+/// \brief Read whole file.
+/// \param path A path of the file
+/// \param content Output content of the file
+/// \return True on success
+static bool ReadFile(const std::string& path, mdp::ByteBuffer& content)
+{
+    std::ifstream fileStream(path.c_str(), std::ios_base::in | std::ios_base::binary);
+
+    if (!fileStream.is_open())
+        return false;
+
+    std::stringstream contentStream;
+    contentStream << fileStream.rdbuf();
+    content = contentStream.str();
+
+    return true;
+}
+
+/// \brief Read the stamp of a file.
+/// \param path A path of the file
+/// \param stamp Output stamp of the file
+/// \return True on success
+static bool ReadFileStamp(const std::string& path, FileStamp& stamp)
+{
+    struct stat info;
+
+    if (::stat(path.c_str(), &info) != 0)
+        return false;
+
+    stamp.time = info.st_mtime;
+    stamp.size = info.st_size;
+
+#ifdef __linux__
+    stamp.nanoseconds = info.st_mtim.tv_nsec;
+#endif
+
+    return true;
+}
+
+/// \brief Absolute path of a file with no symbolic links, the path if it can't be resolved.
+/// \param path A path of the file
+static std::string CanonicalPath(const std::string& path)
+{
+#ifndef _WIN32
+    char resolved[PATH_MAX];
+
+    if (::realpath(path.c_str(), resolved))
+        return resolved;
+#endif
+
+    return path;
+}
+
+/// \brief Check a cache entry holds the parse result of a source.
+static bool IsEntryOf(const CacheEntry* entry, const mdp::ByteBuffer& source, size_t hash)
+{
+    return entry->hash == hash && entry->source == source;
+}
+
+#ifdef __linux__
+
+/// \brief Directory of a file.
+/// \param path Canonical path of the file
+static std::string DirectoryOf(const std::string& path)
+{
+    std::string directory = path.substr(0, path.rfind('/'));
+    return (directory.empty()) ? std::string("/") : directory;
+}
+
+/// \brief Check a directory is watched, the cache has to be locked.
+static bool IsWatched(const ServerCache& cache, const std::string& directory)
+{
+    for (std::map<int, std::string>::const_iterator it = cache.directories.begin(); it != cache.directories.end(); ++it) {
+
+        if (it->second == directory)
+            return true;
+    }
+
+    return false;
+}
+
+/// \brief Watch the directory of a cached file, the cache has to be locked.
+/// \param cache Server cache
+/// \param path Canonical path of the file
+static void WatchFile(ServerCache& cache, const std::string& path)
+{
+    std::string directory = DirectoryOf(path);
+
+    if (cache.inotify < 0 || IsWatched(cache, directory))
+        return;
+
+    int watch = ::inotify_add_watch(cache.inotify, directory.c_str(),
+                                    IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM | IN_MOVE_SELF | IN_DELETE_SELF);
+
+    if (watch >= 0)
+        cache.directories[watch] = directory;
+}
+
+/// \brief Stop trusting the watcher for the entries of a directory, all of them if empty.
+/// The cache has to be locked, requests check the stamps of the files instead.
+static void UnwatchFiles(ServerCache& cache, const std::string& directory)
+{
+    for (std::map<std::string, CacheEntry*>::iterator it = cache.files.begin(); it != cache.files.end(); ++it) {
+
+        if (directory.empty() || DirectoryOf(it->first) == directory)
+            it->second->watched = false;
+    }
+}
+
+/// \brief Parse a changed file again and replace its cache entry.
+/// \param cache Server cache
+/// \param parser Parser of the watcher thread
+/// \param path Canonical path of the file
+static void ReparseFile(ServerCache& cache, snowcrash::Parser& parser, const std::string& path)
+{
+    FileStamp stamp;
+    mdp::ByteBuffer source;
+
+    if (!ReadFileStamp(path, stamp) || !ReadFile(path, source))
+        return;
+
+    size_t hash = Hash(source);
+
+    {
+        CacheLock lock(cache);
+        std::map<std::string, CacheEntry*>::iterator it = cache.files.find(path);
+
+        if (it == cache.files.end())
+            return;
+
+        if (IsEntryOf(it->second, source, hash)) {
+            it->second->stamp = stamp;
+            it->second->watched = IsWatched(cache, DirectoryOf(path));
+            return;
+        }
+    }
+
+    // Parse without holding the lock, requests are served meanwhile
+    CacheEntry* entry = Parse(parser, source, hash);
+    entry->stamp = stamp;
+
+    CacheLock lock(cache);
+    CacheEntry*& cached = cache.files[path];
+
+    // The directory may have stopped being watched meanwhile
+    entry->watched = IsWatched(cache, DirectoryOf(path));
+
+    delete cached;
+    cached = entry;
+}
+
+/// \brief Watch the directories of cached files until stopped, a thread.
+/// \param context Server cache
+static void* WatchFiles(void* context)
+{
+    ServerCache& cache = *static_cast<ServerCache*>(context);
+    std::vector<char> buffer(64 * 1024);
+    snowcrash::Parser parser;
+
+    while (true) {
+
+        pollfd fds[2];
+        fds[0].fd = cache.inotify;
+        fds[0].events = POLLIN;
+        fds[1].fd = cache.stopPipe[0];
+        fds[1].events = POLLIN;
+
+        if (::poll(fds, 2, -1) < 0) {
+
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        if (fds[1].revents != 0)
+            break;
+
+        ssize_t length = ::read(cache.inotify, &buffer[0], buffer.size());
+
+        if (length <= 0)
+            continue;
+
+        std::vector<std::string> changed;
+
+        {
+            CacheLock lock(cache);
+
+            for (ssize_t offset = 0; offset < length; ) {
+
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(&buffer[offset]);
+                offset += sizeof(inotify_event) + event->len;
+
+                // Events were lost, any file may have changed
+                if (event->mask & IN_Q_OVERFLOW) {
+                    UnwatchFiles(cache, std::string());
+                    continue;
+                }
+
+                std::map<int, std::string>::iterator watch = cache.directories.find(event->wd);
+
+                if (watch == cache.directories.end())
+                    continue;
+
+                std::string directory = watch->second;
+
+                // The directory is gone or moved, its files are not watched any more
+                if (event->mask & (IN_IGNORED | IN_MOVE_SELF | IN_DELETE_SELF)) {
+
+                    if (event->mask & IN_MOVE_SELF)
+                        ::inotify_rm_watch(cache.inotify, event->wd);
+
+                    UnwatchFiles(cache, directory);
+                    cache.directories.erase(watch);
+                    continue;
+                }
+
+                if (event->len == 0)
+                    continue;
+
+                std::string path = directory + ((directory == "/") ? "" : "/") + event->name;
+                std::map<std::string, CacheEntry*>::iterator it = cache.files.find(path);
+
+                // Requests check the file until it is parsed again
+                if (it != cache.files.end()) {
+                    it->second->watched = false;
+                    changed.push_back(path);
+                }
+            }
+        }
+
+        for (std::vector<std::string>::const_iterator it = changed.begin(); it != changed.end(); ++it) {
+            ReparseFile(cache, parser, *it);
+        }
+    }
+
+    return NULL;
+}
+
+#endif
+
+/// \brief Read a request.
+/// \param text JSON text of the request
+/// \param request Output request
+/// \param message Output error message
+/// \return JSON-RPC error code, 0 on success
+static int ReadRequest(const std::string& text, Request& request, std::string& message)
+{
+    JSONReader reader(text.data(), text.size());
+    std::string key;
+
+    try {
+        reader.beginObject();
+
+        while (reader.nextMember(key)) {
+
+            if (key == "id") {
+
+                JSONReader::ValueType type = reader.peek();
+                size_t begin = reader.offset();
+                reader.skipValue();
+
+                if (type == JSONReader::StringValueType || type == JSONReader::NumberValueType)
+                    request.id = text.substr(begin, reader.offset() - begin);
+            }
+            else if (key == "method") {
+                reader.readString(request.method);
+            }
+            else if (key == "params") {
+
+                if (reader.peek() != JSONReader::ObjectValueType) {
+                    message = "params have to be an object";
+                    return InvalidParamsRPCErrorCode;
+                }
+
+                reader.beginObject();
+
+                while (reader.nextMember(key)) {
+
+                    if (key == "path") {
+                        reader.readString(request.path);
+                    }
+                    else if (key == "source") {
+                        reader.readString(request.source);
+                        request.hasSource = true;
+                    }
+                    else if (key == "format") {
+                        reader.readString(request.format);
+                    }
+                    else if (key == "compact") {
+                        request.compact = reader.readBoolean();
+                    }
+                    else if (key == "sourcemap") {
+                        request.sourcemap = reader.readBoolean();
+                    }
+                    else {
+                        reader.skipValue();
+                    }
+                }
+            }
+            else {
+                reader.skipValue();
+            }
+        }
+
+        reader.finish();
+    }
+    catch (const snowcrash::Error& e) {
+        std::stringstream ss;
+        ss << e.message << " at " << reader.offset();
+        message = ss.str();
+        return ParseRPCErrorCode;
+    }
+
+    if (request.method.empty()) {
+        message = "method expected";
+        return InvalidRequestRPCErrorCode;
+    }
+
+    return 0;
+}
+
+/// \brief Write a source annotation as a JSON object.
+static void WriteAnnotation(JSONWriter& writer, const snowcrash::SourceAnnotation& annotation)
+{
+    writer << "{\"code\":" << static_cast<size_t>(annotation.code) << ",\"message\":";
+    writer.string(annotation.message);
+    writer << ",\"location\":[";
+
+    for (mdp::CharactersRangeSet::const_iterator it = annotation.location.begin(); it != annotation.location.end(); ++it) {
+
+        if (it != annotation.location.begin())
+            writer << ",";
+
+        writer << "[" << it->location << "," << it->length << "]";
+    }
+
+    writer << "]}";
+}
+
+/// \brief Write a parser report as a JSON object.
+static void WriteReport(JSONWriter& writer, const snowcrash::Report& report)
+{
+    writer << "{\"error\":";
+    WriteAnnotation(writer, report.error);
+    writer << ",\"warnings\":[";
+
+    for (snowcrash::Warnings::const_iterator it = report.warnings.begin(); it != report.warnings.end(); ++it) {
+
+        if (it != report.warnings.begin())
+            writer << ",";
+
+        WriteAnnotation(writer, *it);
+    }
+
+    writer << "]}";
+}
+
+/// \brief Write the response to a request.
+/// \param writer Writer of the response
+/// \param request A request
+/// \param blueprint Parse result of the request source
+/// \param message Output error message
+/// \return JSON-RPC error code, 0 on success
+static int WriteResult(JSONWriter& writer,
+                       const Request& request,
+                       const snowcrash::ParseResult<snowcrash::Blueprint>& blueprint,
+                       std::string& message)
+{
+    std::stringstream ast, sourcemap;
+
+    if (request.method == "parse") {
+
+        snowcrash::SerializeJSON(blueprint.node, ast, snowcrash::CompactSerializeOption);
+
+        if (request.sourcemap)
+            snowcrash::SerializeSourceMapJSON(blueprint.sourceMap, sourcemap, snowcrash::CompactSerializeOption);
+    }
+    else if (request.method == "serialize") {
+
+        snowcrash::SerializeOptions options = (request.compact) ? snowcrash::CompactSerializeOption : 0;
+
+        if (request.format == "json") {
+            snowcrash::SerializeJSON(blueprint.node, ast, options);
+
+            if (request.sourcemap)
+                snowcrash::SerializeSourceMapJSON(blueprint.sourceMap, sourcemap, options);
+        }
+        else if (request.format == "yaml") {
+            snowcrash::SerializeYAML(blueprint.node, ast, options);
+
+            if (request.sourcemap)
+                snowcrash::SerializeSourceMapYAML(blueprint.sourceMap, sourcemap, options);
+        }
+        else if (request.format == "ndjson" && !request.sourcemap) {
+            snowcrash::SerializeNDJSON(blueprint.node, ast);
+        }
+        else {
+            message = "unsupported format '" + request.format + "'";
+            return InvalidParamsRPCErrorCode;
+        }
+    }
+
+    writer << "{\"jsonrpc\":\"2.0\",\"id\":";
+    writer.append(request.id);
+    writer << ",\"result\":{\"report\":";
+    WriteReport(writer, blueprint.report);
+
+    if (request.method == "parse") {
+
+        writer << ",\"ast\":";
+        writer.append(ast.str());
+
+        if (request.sourcemap) {
+            writer << ",\"sourcemap\":";
+            writer.append(sourcemap.str());
+        }
+    }
+    else if (request.method == "serialize") {
+
+        writer << ",\"ast\":";
+        writer.string(ast.str());
+
+        if (request.sourcemap) {
+            writer << ",\"sourcemap\":";
+            writer.string(sourcemap.str());
+        }
+    }
+
+    writer << "}}";
+    return 0;
+}
+
+/// \brief Write the result of a request with a path, parse the file unless cached.
+/// \param cache Server cache
+/// \param request A request with a path
+/// \param writer Writer of the response
+/// \param message Output error message
+/// \return JSON-RPC error code, 0 on success
+static int ServeFile(ServerCache& cache, const Request& request, JSONWriter& writer, std::string& message)
+{
+    std::string path = CanonicalPath(request.path);
+    FileStamp stamp;
+    bool hasStamp = ReadFileStamp(path, stamp);
+
+    {
+        CacheLock lock(cache);
+        std::map<std::string, CacheEntry*>::iterator it = cache.files.find(path);
+
+        // Use an entry kept current by the watcher as is, check the stamp of any other
+        if (it != cache.files.end() &&
+            (it->second->watched || (hasStamp && it->second->stamp == stamp))) {
+
+            return WriteResult(writer, request, it->second->result, message);
+        }
+    }
+
+    mdp::ByteBuffer source;
+
+    if (!ReadFile(path, source)) {
+        message = "unable to open input file '" + request.path + "'";
+        return InputRPCErrorCode;
+    }
+
+    size_t hash = Hash(source);
+
+    {
+        CacheLock lock(cache);
+        std::map<std::string, CacheEntry*>::iterator it = cache.files.find(path);
+
+        // Touched, not changed
+        if (it != cache.files.end() && IsEntryOf(it->second, source, hash)) {
+            it->second->stamp = stamp;
+            return WriteResult(writer, request, it->second->result, message);
+        }
+    }
+
+    // Parse without holding the lock, the watcher replaces entries meanwhile
+    CacheEntry* entry = Parse(cache.parser, source, hash);
+    entry->stamp = stamp;
+
+    CacheLock lock(cache);
+    CacheEntry*& cached = cache.files[path];
+
+#ifdef __linux__
+    WatchFile(cache, path);
+#endif
+
+    delete cached;
+    cached = entry;
+
+    return WriteResult(writer, request, entry->result, message);
+}
+
+/// \brief Write the result of a request with a source, parse the source unless cached.
+/// \param cache Server cache
+/// \param request A request with a source
+/// \param writer Writer of the response
+/// \param message Output error message
+/// \return JSON-RPC error code, 0 on success
+static int ServeSource(ServerCache& cache, const Request& request, JSONWriter& writer, std::string& message)
+{
+    size_t hash = Hash(request.source);
+
+    {
+        CacheLock lock(cache);
+        std::map<size_t, CacheEntry*>::iterator it = cache.sources.find(hash);
+
+        if (it != cache.sources.end() && IsEntryOf(it->second, request.source, hash))
+            return WriteResult(writer, request, it->second->result, message);
+    }
+
+    // Parse without holding the lock, the watcher replaces entries meanwhile
+    CacheEntry* entry = Parse(cache.parser, request.source, hash);
+
+    CacheLock lock(cache);
+    std::map<size_t, CacheEntry*>::iterator it = cache.sources.find(hash);
+
+    if (it != cache.sources.end()) {
+        delete it->second;
+        it->second = entry;
+    }
+    else {
+
+        // Evict the oldest source
+        if (cache.sources.size() == MaxCachedSources) {
+            delete cache.sources[cache.sourceOrder.front()];
+            cache.sources.erase(cache.sourceOrder.front());
+            cache.sourceOrder.pop_front();
+        }
+
+        cache.sources[hash] = entry;
+        cache.sourceOrder.push_back(hash);
+    }
+
+    return WriteResult(writer, request, entry->result, message);
+}
+
+/// \brief JSON-RPC error response.
+/// \param id Raw JSON of the request id, empty if unknown
+/// \param code JSON-RPC error code
+/// \param message Error message
+static std::string ErrorResponse(const std::string& id, int code, const std::string& message)
+{
+    std::stringstream response;
+
+    {
+        JSONWriter writer(response, true);
+
+        writer << "{\"jsonrpc\":\"2.0\",\"id\":";
+        writer.append((id.empty()) ? std::string("null") : id);
+        writer << ",\"error\":{\"code\":-" << static_cast<size_t>(-code) << ",\"message\":";
+        writer.string(message);
+        writer << "}}";
+    }
+
+    return response.str();
+}
+
+Server::Server()
+: cache(new ServerCache)
+{
+#ifdef __linux__
+    pthread_mutex_init(&cache->mutex, NULL);
+    cache->inotify = ::inotify_init();
+
+    if (cache->inotify >= 0 && ::pipe(cache->stopPipe) == 0) {
+
+        if (pthread_create(&cache->watcher, NULL, WatchFiles, cache) != 0) {
+            ::close(cache->stopPipe[0]);
+            ::close(cache->stopPipe[1]);
+            ::close(cache->inotify);
+            cache->inotify = -1;
+        }
+    }
+    else if (cache->inotify >= 0) {
+        ::close(cache->inotify);
+        cache->inotify = -1;
+    }
+#endif
+}
+
+Server::~Server()
+{
+#ifdef __linux__
+    if (cache->inotify >= 0) {
+        ssize_t written = ::write(cache->stopPipe[1], "", 1);
+        (void)written;
+
+        pthread_join(cache->watcher, NULL);
+
+        ::close(cache->stopPipe[0]);
+        ::close(cache->stopPipe[1]);
+        ::close(cache->inotify);
+    }
+
+    pthread_mutex_destroy(&cache->mutex);
+#endif
+
+    for (std::map<std::string, CacheEntry*>::iterator it = cache->files.begin(); it != cache->files.end(); ++it) {
+        delete it->second;
+    }
+
+    for (std::map<size_t, CacheEntry*>::iterator it = cache->sources.begin(); it != cache->sources.end(); ++it) {
+        delete it->second;
+    }
+
+    delete cache;
+}
+
+std::string Server::handle(const std::string& text)
+{
+    Request request;
+    std::string message;
+
+    int code = ReadRequest(text, request, message);
+
+    if (code == 0 && request.method != "parse" && request.method != "validate" && request.method != "serialize") {
+        code = MethodNotFoundRPCErrorCode;
+        message = "unknown method '" + request.method + "'";
+    }
+
+    if (code == 0 && request.hasSource == !request.path.empty()) {
+        code = InvalidParamsRPCErrorCode;
+        message = "either path or source expected";
+    }
+
+    std::stringstream response;
+
+    if (code == 0) {
+        JSONWriter writer(response, true);
+
+        if (request.hasSource)
+            code = ServeSource(*cache, request, writer, message);
+        else
+            code = ServeFile(*cache, request, writer, message);
+    }
+
+    // Notifications get no response unless the request can't be read
+    if (request.id.empty() && code != ParseRPCErrorCode && code != InvalidRequestRPCErrorCode)
+        return std::string();
+
+    if (code != 0)
+        return ErrorResponse(request.id, code, message);
+
+    return response.str();
+}
+
+void Server::serve(std::istream& input, std::ostream& output)
+{
+    std::string line;
+
+    while (std::getline(input, line)) {
+
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+
+        std::string response = handle(line);
+
+        if (!response.empty())
+            output << response << std::endl;
+    }
+}
+
+#ifndef _WIN32
+
+/// \brief Maximum length of a request line of a socket client, a longer one closes the connection.
+static const size_t MaxSocketRequestLength = 16 * 1024 * 1024;
+
+/// \brief Connection of a socket client.
+struct SocketClient {
+    std::string input;      ///< Received data without a complete line
+    std::string output;     ///< Responses not sent yet
+};
+
+/// \brief Put a socket into the non-blocking mode.
+static bool SetNonBlocking(int socket)
+{
+    int flags = ::fcntl(socket, F_GETFL, 0);
+    return flags >= 0 && ::fcntl(socket, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+/// \brief Write as much of the pending data as a non-blocking socket accepts.
+/// \return False if the socket is closed
+static bool SendPending(int socket, std::string& data)
+{
+    size_t sent = 0;
+
+    while (sent < data.size()) {
+
+        ssize_t written = ::send(socket, data.data() + sent, data.size() - sent, 0);
+
+        if (written < 0 && errno == EINTR)
+            continue;
+
+        if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+
+        if (written <= 0)
+            return false;
+
+        sent += written;
+    }
+
+    data.erase(0, sent);
+    return true;
+}
+
+/// \brief Read from a non-blocking socket and handle the complete lines.
+/// \return False if the socket is closed or the client sent too long a line
+static bool ReceiveRequests(int socket, SocketClient& client, Server& server)
+{
+    char buffer[64 * 1024];
+    ssize_t length = ::recv(socket, buffer, sizeof(buffer), 0);
+
+    if (length < 0)
+        return errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK;
+
+    if (length == 0)
+        return false;
+
+    client.input.append(buffer, length);
+
+    std::string::size_type begin = 0;
+    std::string::size_type newLine;
+
+    while ((newLine = client.input.find('\n', begin)) != std::string::npos) {
+
+        std::string line = client.input.substr(begin, newLine - begin);
+        begin = newLine + 1;
+
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+
+        std::string response = server.handle(line);
+
+        if (!response.empty()) {
+            client.output += response;
+            client.output += '\n';
+        }
+    }
+
+    client.input.erase(0, begin);
+
+    return client.input.size() <= MaxSocketRequestLength;
+}
+
+bool Server::serveSocket(const std::string& path)
+{
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if (path.size() >= sizeof(address.sun_path))
+        return false;
+
+    std::strcpy(address.sun_path, path.c_str());
+
+    // Replace a socket left behind by a previous server, not the one of a running server
+    struct stat info;
+
+    if (::stat(path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+
+        int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (probe < 0)
+            return false;
+
+        bool isStale = ::connect(probe, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 && errno == ECONNREFUSED;
+        ::close(probe);
+
+        if (!isStale)
+            return false;
+
+        ::unlink(path.c_str());
+    }
+
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (listener < 0)
+        return false;
+
+    if (!SetNonBlocking(listener) ||
+        ::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listener, 16) != 0) {
+        ::close(listener);
+        return false;
+    }
+
+    // Disconnected clients are detected by failed writes
+    ::signal(SIGPIPE, SIG_IGN);
+
+    // Clients are non-blocking, a client is read only when it has no
+    // responses waiting, so a slow reader does not hold up the others
+    std::vector<pollfd> fds(1);
+    std::vector<SocketClient> clients(1);
+
+    fds[0].fd = listener;
+    fds[0].events = POLLIN;
+
+    while (true) {
+
+        if (::poll(&fds[0], fds.size(), -1) < 0) {
+
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        for (size_t i = fds.size() - 1; i > 0; --i) {
+
+            if (fds[i].revents == 0)
+                continue;
+
+            SocketClient& client = clients[i];
+            bool connected = true;
+
+            if (client.output.empty())
+                connected = ReceiveRequests(fds[i].fd, client, *this);
+            else if ((fds[i].revents & POLLOUT) == 0)
+                connected = false;
+
+            if (connected)
+                connected = SendPending(fds[i].fd, client.output);
+
+            if (!connected) {
+                ::close(fds[i].fd);
+                fds.erase(fds.begin() + i);
+                clients.erase(clients.begin() + i);
+                continue;
+            }
+
+            fds[i].events = (client.output.empty()) ? POLLIN : POLLOUT;
+        }
+
+        // New client
+        if (fds[0].revents != 0) {
+
+            int client = ::accept(listener, NULL, NULL);
+
+            if (client >= 0 && !SetNonBlocking(client)) {
+                ::close(client);
+                client = -1;
+            }
+
+            if (client >= 0) {
+                pollfd fd;
+                fd.fd = client;
+                fd.events = POLLIN;
+                fd.revents = 0;
+
+                fds.push_back(fd);
+                clients.push_back(SocketClient());
+            }
+        }
+    }
+
+    ::close(listener);
+    return true;
+}
+
+#else
+
+bool Server::serveSocket(const std::string&)
+{
+    return false;
+}
+
+#endif
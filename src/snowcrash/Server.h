@@ -0,0 +1,78 @@
+//
+//  Server.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_SERVER_H
+#define SNOWCRASH_SERVER_H
+
+#include <iosfwd>
+#include <string>
+
+/**
+ *  JSON-RPC Server
+ *  ---------------
+ *
+ *  JSON-RPC 2.0 requests and responses, one per line. Every method reads
+ *  the blueprint from the file at "path" or from the "source" string:
+ *
+ *      validate    {"path" | "source"}
+ *                  -> {"report"}
+ *      parse       {"path" | "source", "sourcemap"}
+ *                  -> {"report", "ast", "sourcemap"} as JSON
+ *      serialize   {"path" | "source", "format", "compact", "sourcemap"}
+ *                  -> {"report", "ast", "sourcemap"} as strings in the
+ *                  "json", "yaml" or "ndjson" format
+ *
+ *  Parse results are cached by the file path or the source. A cached
+ *  source is used while the content hash and the content match, a cached
+ *  file while its modification time and size match, the file is read and
+ *  compared only when they don't. On Linux the directories of the cached
+ *  files are watched and a changed file is parsed again in the background.
+ *  Its new result is used as is, the file is not checked at all. When the
+ *  watcher loses events, or a watched directory is moved or deleted, the
+ *  affected files are checked by their stamps again. Parsing is done
+ *  without the cache locked.
+ */
+
+struct ServerCache;
+
+/**
+ *  \brief JSON-RPC server of the parser.
+ */
+class Server {
+public:
+    Server();
+    ~Server();
+
+    /**
+     *  \brief  Handle one request
+     *
+     *  Requests are to be handled one at a time.
+     *
+     *  \param  request     A JSON-RPC request
+     *  \return JSON-RPC response on one line, empty for a notification
+     */
+    std::string handle(const std::string& request);
+
+    /** Serve requests read from input line by line until its end */
+    void serve(std::istream& input, std::ostream& output);
+
+    /**
+     *  \brief  Serve requests of the clients of a UNIX domain socket
+     *  \param  path    A path of the socket to create
+     *  \return False if the socket can't be created, otherwise serves forever
+     */
+    bool serveSocket(const std::string& path);
+
+private:
+    ServerCache* cache;
+
+    Server(const Server&);
+    Server& operator=(const Server&);
+};
+
+#endif
@@ -6,12 +6,22 @@
 //  Copyright (c) 2013 Apiary Inc. All rights reserved.
 //
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <set>
+#include <vector>
 #include "snowcrash.h"
+#include "Batch.h"
+#include "Directory.h"
+#include "SerializeCBOR.h"
 #include "SerializeJSON.h"
+#include "SerializeMessagePack.h"
+#include "SerializeNDJSON.h"
 #include "SerializeYAML.h"
+#include "Parallel.h"
+#include "Server.h"
 #include "cmdline.h"
 #include "Version.h"
 
@@ -19,8 +29,15 @@ using snowcrash::SourceAnnotation;
 using snowcrash::Error;
 
 static const std::string OutputArgument = "output";
+static const std::string ParallelArgument = "parallel";
+static const std::string CompactArgument = "compact";
 static const std::string FormatArgument = "format";
+static const std::string GroupsArgument = "groups";
+static const std::string InlineSourcemapArgument = "inline-sourcemap";
+static const std::string JobsArgument = "jobs";
 static const std::string RenderArgument = "render";
+static const std::string ServeArgument = "serve";
+static const std::string SocketArgument = "socket";
 static const std::string SourcemapArgument = "sourcemap";
 static const std::string ValidateArgument = "validate";
 static const std::string VersionArgument = "version";
@@ -28,9 +45,199 @@ static const std::string VersionArgument = "version";
 /// \enum Snow Crash AST output format.
 enum SerializationFormat {
     YAMLSerializationFormat,
-    JSONSerializationFormat
+    JSONSerializationFormat,
+    NDJSONSerializationFormat,
+    CBORSerializationFormat,
+    MessagePackSerializationFormat
 };
 
+/// \brief Output settings.
+struct OutputSettings {
+    SerializationFormat format;
+    snowcrash::SerializeOptions options;
+    bool inlineSourcemap;
+};
+
+/// \brief Batch of input files and their results.
+struct Batch {
+    std::vector<std::string> inputs;
+    std::string outputTemplate;
+    std::string sourcemapTemplate;
+    snowcrash::BlueprintParserOptions parserOptions;
+    OutputSettings output;
+    bool validate;
+    std::vector<snowcrash::Report> reports;
+    std::vector<std::string> failures;
+};
+
+/// \brief Resource group files to write.
+struct ResourceGroupFiles {
+    const snowcrash::Blueprint* blueprint;
+    std::string prefix;
+    SerializationFormat format;
+    snowcrash::SerializeOptions options;
+    std::vector<char> failed;
+};
+
+/// \brief Name of a resource group file.
+/// \param files Resource group files
+/// \param index Index of the resource group
+std::string ResourceGroupFileName(const ResourceGroupFiles& files, size_t index)
+{
+    std::stringstream name;
+    name << files.prefix << "-" << index << ((files.format == JSONSerializationFormat) ? ".json" : ".yaml");
+    return name.str();
+}
+
+/// \brief Write AST of one resource group into its file, a parallel task.
+/// \param index Index of the resource group
+/// \param context Resource group files
+void WriteResourceGroupFile(size_t index, void* context)
+{
+    ResourceGroupFiles& files = *static_cast<ResourceGroupFiles*>(context);
+
+    std::ofstream fileStream;
+    fileStream.open(ResourceGroupFileName(files, index).c_str());
+
+    if (!fileStream.is_open()) {
+        files.failed[index] = 1;
+        return;
+    }
+
+    if (files.format == JSONSerializationFormat) {
+        snowcrash::SerializeResourceGroupJSON(*files.blueprint, index, fileStream, files.options);
+    }
+    else {
+        snowcrash::SerializeResourceGroupYAML(*files.blueprint, index, fileStream, files.options);
+    }
+}
+
+/// \brief Serialize parsed blueprint.
+/// \param blueprint Parse result to serialize
+/// \param output Output settings
+/// \param outputStream Stream to serialize AST into
+/// \param sourcemapStream Stream to serialize sourcemap into, NULL for no sourcemap
+void Serialize(const snowcrash::ParseResult<snowcrash::Blueprint>& blueprint,
+               const OutputSettings& output,
+               std::ostream& outputStream,
+               std::ostream* sourcemapStream)
+{
+    if (output.format == NDJSONSerializationFormat) {
+        snowcrash::SerializeNDJSON(blueprint.node, outputStream);
+    }
+    else if (output.format == CBORSerializationFormat) {
+        SerializeCBOR(blueprint.node, outputStream, output.options);
+
+        if (sourcemapStream) {
+            SerializeSourceMapCBOR(blueprint.sourceMap, *sourcemapStream, output.options);
+        }
+    }
+    else if (output.format == MessagePackSerializationFormat) {
+        SerializeMessagePack(blueprint.node, outputStream, output.options);
+
+        if (sourcemapStream) {
+            SerializeSourceMapMessagePack(blueprint.sourceMap, *sourcemapStream, output.options);
+        }
+    }
+    else if (output.format == JSONSerializationFormat) {
+
+        if (output.inlineSourcemap) {
+            SerializeCombinedJSON(blueprint.node, blueprint.sourceMap, outputStream, output.options);
+        }
+        else if (sourcemapStream) {
+            SerializeJSON(blueprint.node, blueprint.sourceMap, outputStream, *sourcemapStream, output.options);
+        }
+        else {
+            SerializeJSON(blueprint.node, outputStream, output.options);
+        }
+    }
+    else {
+        SerializeYAML(blueprint.node, outputStream, output.options);
+
+        if (sourcemapStream) {
+            SerializeSourceMapYAML(blueprint.sourceMap, *sourcemapStream, output.options);
+        }
+    }
+}
+
+/// \brief File name extension of an output format.
+/// \param format Output format
+const char* FormatExtension(SerializationFormat format)
+{
+    switch (format) {
+        case JSONSerializationFormat:
+            return "json";
+
+        case NDJSONSerializationFormat:
+            return "ndjson";
+
+        case CBORSerializationFormat:
+            return "cbor";
+
+        case MessagePackSerializationFormat:
+            return "msgpack";
+
+        default:
+            return "yaml";
+    }
+}
+
+/// \brief Parse one file of a batch and write its output files, a parallel task.
+/// \param index Index of the input file
+/// \param context Batch
+void ProcessBatchFile(size_t index, void* context)
+{
+    Batch& batch = *static_cast<Batch*>(context);
+    const std::string& input = batch.inputs[index];
+
+    std::ifstream inputFileStream(input.c_str(), std::ios_base::in | std::ios_base::binary);
+
+    if (!inputFileStream.is_open()) {
+        batch.failures[index] = "unable to open input file '" + input + "'";
+        return;
+    }
+
+    std::stringstream inputStream;
+    inputStream << inputFileStream.rdbuf();
+    inputFileStream.close();
+
+    snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+    snowcrash::parse(inputStream.str(), batch.parserOptions, blueprint);
+
+    batch.reports[index] = blueprint.report;
+
+    if (batch.validate)
+        return;
+
+    bool binary = (batch.output.format == CBORSerializationFormat ||
+                   batch.output.format == MessagePackSerializationFormat);
+    std::ios_base::openmode mode = (binary) ? std::ios_base::out | std::ios_base::binary : std::ios_base::out;
+
+    std::string outputFileName = OutputFileName(batch.outputTemplate, input, FormatExtension(batch.output.format));
+    std::ofstream outputFileStream(outputFileName.c_str(), mode);
+
+    if (!outputFileStream.is_open()) {
+        batch.failures[index] = "unable to write to file '" + outputFileName + "'";
+        return;
+    }
+
+    std::ofstream sourcemapOutputFileStream;
+
+    if (!batch.sourcemapTemplate.empty()) {
+
+        std::string sourcemapOutputFileName = OutputFileName(batch.sourcemapTemplate, input, FormatExtension(batch.output.format));
+        sourcemapOutputFileStream.open(sourcemapOutputFileName.c_str(), mode);
+
+        if (!sourcemapOutputFileStream.is_open()) {
+            batch.failures[index] = "unable to write to file '" + sourcemapOutputFileName + "'";
+            return;
+        }
+    }
+
+    Serialize(blueprint, batch.output, outputFileStream,
+              (batch.sourcemapTemplate.empty()) ? NULL : &sourcemapOutputFileStream);
+}
+
 /// \brief Print Markdown source annotation.
 /// \param prefix A string prefix for the annotation
 /// \param annotation An annotation to print
@@ -76,6 +283,51 @@ void PrintReport(const snowcrash::Report& report)
     }
 }
 
+/// \brief Parse all files of a batch and print their reports with a summary.
+/// \param batch Batch to process
+/// \param jobs Maximum number of files parsed at once, 0 for the number of processors
+/// \return Exit code of the first failed file, EXIT_SUCCESS if there is none
+int ProcessBatch(Batch& batch, size_t jobs)
+{
+    batch.reports.resize(batch.inputs.size());
+    batch.failures.resize(batch.inputs.size());
+
+    snowcrash::ParallelFor(ProcessBatchFile, &batch, batch.inputs.size(), jobs);
+
+    int result = EXIT_SUCCESS;
+    size_t failed = 0;
+    size_t warned = 0;
+
+    for (size_t i = 0; i < batch.inputs.size(); ++i) {
+
+        std::cerr << batch.inputs[i] << ":";
+
+        int code = batch.reports[i].error.code;
+
+        if (!batch.failures[i].empty()) {
+            std::cerr << "\nfatal: " << batch.failures[i] << "\n";
+            code = EXIT_FAILURE;
+        }
+        else {
+            PrintReport(batch.reports[i]);
+        }
+
+        if (code != EXIT_SUCCESS) {
+            ++failed;
+
+            if (result == EXIT_SUCCESS)
+                result = code;
+        }
+        else if (!batch.reports[i].warnings.empty()) {
+            ++warned;
+        }
+    }
+
+    std::cerr << "\n" << batch.inputs.size() << " files, " << failed << " failed, " << warned << " with warnings\n";
+
+    return result;
+}
+
 int main(int argc, const char *argv[])
 {
     cmdline::parser argumentParser;
@@ -83,15 +335,28 @@ int main(int argc, const char *argv[])
     argumentParser.set_program_name("snowcrash");
     std::stringstream ss;
 
-    ss << "<input file>\n\n";
+    ss << "<input file> ...\n\n";
     ss << "API Blueprint Parser\n";
     ss << "If called without <input file>, 'snowcrash' will listen on stdin.\n";
+    ss << "Multiple input files or directories are parsed in a batch, output file\n";
+    ss << "names are then templates where {path} is the input file path without\n";
+    ss << "extension, {name} its name without extension and {ext} the format\n";
+    ss << "extension. AST is saved into '{path}.{ext}' by default.\n";
+    ss << "With --serve, JSON-RPC 'parse', 'validate' and 'serialize' requests are\n";
+    ss << "served one per line.\n";
 
     argumentParser.footer(ss.str());
 
     argumentParser.add<std::string>(OutputArgument, 'o', "save output AST into file", false);
-    argumentParser.add<std::string>(FormatArgument, 'f', "output AST format", false, "yaml", cmdline::oneof<std::string>("yaml", "json"));
+    argumentParser.add<std::string>(FormatArgument, 'f', "output AST format", false, "yaml", cmdline::oneof<std::string>("yaml", "json", "ndjson", "cbor", "msgpack"));
     argumentParser.add<std::string>(SourcemapArgument, 's', "export sourcemap AST into file", false);
+    argumentParser.add(CompactArgument, 'c', "omit insignificant whitespace in JSON output");
+    argumentParser.add(InlineSourcemapArgument, 'i', "combine AST and its sourcemap into one JSON output");
+    argumentParser.add<std::string>(GroupsArgument, 'g', "save AST of every resource group into <prefix>-<index> file instead", false);
+    argumentParser.add(ParallelArgument, 'p', "serialize resource groups on all processors");
+    argumentParser.add<int>(JobsArgument, 'j', "parse up to <N> input files of a batch at once, 0 for all processors", false, 1, cmdline::range(0, 1024));
+    argumentParser.add(ServeArgument, 0, "serve JSON-RPC requests on stdin and stdout");
+    argumentParser.add<std::string>(SocketArgument, 0, "serve JSON-RPC requests on UNIX domain socket <path> instead", false);
     // TODO: argumentParser.add("render", 'r', "render markdown descriptions");
     argumentParser.add("help", 'h', "display this help message");
     argumentParser.add(VersionArgument, 'v', "print Snow Crash version");
@@ -99,18 +364,165 @@ int main(int argc, const char *argv[])
 
     argumentParser.parse_check(argc, argv);
 
-    // Check arguments
-    if (argumentParser.rest().size() > 1) {
-        std::cerr << "one input file expected, got " << argumentParser.rest().size() << std::endl;
-        exit(EXIT_FAILURE);
-    }
-
     // Version query
     if (argumentParser.exist(VersionArgument)) {
         std::cout << SNOWCRASH_VERSION_STRING << std::endl;
         exit(EXIT_SUCCESS);
     }
 
+    // Server
+    if (argumentParser.exist(ServeArgument) || argumentParser.exist(SocketArgument)) {
+
+        Server server;
+
+        if (!argumentParser.exist(SocketArgument)) {
+            server.serve(std::cin, std::cout);
+            return EXIT_SUCCESS;
+        }
+
+        std::string socketPath = argumentParser.get<std::string>(SocketArgument);
+
+        if (!server.serveSocket(socketPath)) {
+            std::cerr << "fatal: unable to listen on socket '" << socketPath << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    SerializationFormat format = YAMLSerializationFormat;
+
+    if (argumentParser.get<std::string>(FormatArgument) == "json") {
+        format = JSONSerializationFormat;
+    }
+    else if (argumentParser.get<std::string>(FormatArgument) == "ndjson") {
+        format = NDJSONSerializationFormat;
+    }
+    else if (argumentParser.get<std::string>(FormatArgument) == "cbor") {
+        format = CBORSerializationFormat;
+    }
+    else if (argumentParser.get<std::string>(FormatArgument) == "msgpack") {
+        format = MessagePackSerializationFormat;
+    }
+
+    bool binary = (format == CBORSerializationFormat || format == MessagePackSerializationFormat);
+
+    if (format == NDJSONSerializationFormat &&
+        (argumentParser.exist(SourcemapArgument) || argumentParser.exist(GroupsArgument))) {
+        std::cerr << "fatal: NDJSON output format can not be combined with sourcemap or resource group files\n";
+        exit(EXIT_FAILURE);
+    }
+
+    if (binary && argumentParser.exist(GroupsArgument)) {
+        std::cerr << "fatal: binary output formats can not be combined with resource group files\n";
+        exit(EXIT_FAILURE);
+    }
+
+    if (argumentParser.exist(InlineSourcemapArgument) && format != JSONSerializationFormat) {
+        std::cerr << "fatal: inline sourcemap requires JSON output format\n";
+        exit(EXIT_FAILURE);
+    }
+
+    if (argumentParser.exist(GroupsArgument) &&
+        (argumentParser.exist(OutputArgument) || argumentParser.exist(InlineSourcemapArgument))) {
+        std::cerr << "fatal: resource group files can not be combined with an output file or inline sourcemap\n";
+        exit(EXIT_FAILURE);
+    }
+
+    // Expand input directories into their blueprint files
+    std::vector<std::string> inputs;
+    bool batch = argumentParser.rest().size() > 1;
+
+    for (std::vector<std::string>::const_iterator it = argumentParser.rest().begin();
+         it != argumentParser.rest().end();
+         ++it) {
+
+        if (!snowcrash::IsDirectory(*it)) {
+            inputs.push_back(*it);
+            continue;
+        }
+
+        std::vector<std::string> files;
+
+        if (!snowcrash::ListDirectory(*it, files)) {
+            std::cerr << "fatal: unable to read input directory '" << *it << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        std::sort(files.begin(), files.end());
+
+        for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
+            if (IsBlueprintFile(*file))
+                inputs.push_back(*file);
+        }
+
+        batch = true;
+    }
+
+    OutputSettings output;
+    output.format = format;
+    output.options = 0;
+    output.inlineSourcemap = argumentParser.exist(InlineSourcemapArgument);
+
+    if (argumentParser.exist(CompactArgument)) {
+        output.options |= snowcrash::CompactSerializeOption;
+    }
+
+    if (argumentParser.exist(ParallelArgument)) {
+        output.options |= snowcrash::ParallelSerializeOption;
+    }
+
+    // Initialize
+    snowcrash::BlueprintParserOptions options = 0;  // Or snowcrash::RequireBlueprintNameOption
+
+    if (argumentParser.exist(SourcemapArgument) || argumentParser.exist(InlineSourcemapArgument)) {
+        options |= snowcrash::ExportSourcemapOption;
+    }
+
+    if (argumentParser.exist(ValidateArgument)) {
+        options |= snowcrash::ValidateOnlyOption;
+    }
+
+    if (batch) {
+
+        if (argumentParser.exist(GroupsArgument)) {
+            std::cerr << "fatal: resource group files can not be combined with multiple input files\n";
+            exit(EXIT_FAILURE);
+        }
+
+        Batch files;
+        files.inputs = inputs;
+        files.outputTemplate = argumentParser.get<std::string>(OutputArgument);
+        files.sourcemapTemplate = argumentParser.get<std::string>(SourcemapArgument);
+        files.parserOptions = options;
+        files.output = output;
+        files.validate = argumentParser.exist(ValidateArgument);
+
+        if (files.outputTemplate.empty()) {
+            files.outputTemplate = "{path}.{ext}";
+        }
+
+        // Every input file needs its own output files
+        std::set<std::string> outputFileNames;
+
+        for (std::vector<std::string>::const_iterator it = inputs.begin(); it != inputs.end() && !files.validate; ++it) {
+
+            std::string outputFileName = OutputFileName(files.outputTemplate, *it, FormatExtension(format));
+            std::string sourcemapOutputFileName = OutputFileName(files.sourcemapTemplate, *it, FormatExtension(format));
+
+            if (!outputFileNames.insert(outputFileName).second ||
+                (!files.sourcemapTemplate.empty() && !outputFileNames.insert(sourcemapOutputFileName).second)) {
+                std::cerr << "fatal: output file name template gives the same file for more input files\n";
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        // Input files are parsed in parallel already
+        files.output.options &= ~snowcrash::ParallelSerializeOption;
+
+        return ProcessBatch(files, argumentParser.get<int>(JobsArgument));
+    }
+
     // Input
     std::stringstream inputStream;
     if (argumentParser.rest().empty()) {
@@ -132,65 +544,76 @@ int main(int argc, const char *argv[])
         inputFileStream.close();
     }
 
-    // Initialize
-    snowcrash::BlueprintParserOptions options = 0;  // Or snowcrash::RequireBlueprintNameOption
     snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
 
-    if (argumentParser.exist(SourcemapArgument)) {
-        options |= snowcrash::ExportSourcemapOption;
-    }
-
     // Parse
     snowcrash::parse(inputStream.str(), options, blueprint);
 
     // Output
     if (!argumentParser.exist(ValidateArgument)) {
 
-        std::stringstream outputStream;
-        std::stringstream sourcemapOutputStream;
-
-        if (argumentParser.get<std::string>(FormatArgument) == "json") {
-            SerializeJSON(blueprint.node, outputStream);
-            SerializeSourceMapJSON(blueprint.sourceMap, sourcemapOutputStream);
-        }
-        else if (argumentParser.get<std::string>(FormatArgument) == "yaml") {
-            SerializeYAML(blueprint.node, outputStream);
-            SerializeSourceMapYAML(blueprint.sourceMap, sourcemapOutputStream);
-        }
+        snowcrash::SerializeOptions serializeOptions = output.options;
 
         std::string outputFileName = argumentParser.get<std::string>(OutputArgument);
         std::string sourcemapOutputFileName = argumentParser.get<std::string>(SourcemapArgument);
 
+        std::ofstream outputFileStream;
+        std::ofstream sourcemapOutputFileStream;
+        std::ios_base::openmode mode = (binary) ? std::ios_base::out | std::ios_base::binary : std::ios_base::out;
+
         if (!outputFileName.empty()) {
-            // Serialize to file
-            std::ofstream outputFileStream;
-            outputFileStream.open(outputFileName.c_str());
+            outputFileStream.open(outputFileName.c_str(), mode);
 
             if (!outputFileStream.is_open()) {
                 std::cerr << "fatal: unable to write to file '" <<  outputFileName << "'\n";
                 exit(EXIT_FAILURE);
             }
-
-            outputFileStream << outputStream.rdbuf();
-            outputFileStream.close();
-        }
-        else {
-            // Serialize to stdout
-            std::cout << outputStream.rdbuf();
         }
 
         if (!sourcemapOutputFileName.empty()) {
-            // Serialize to file
-            std::ofstream sourcemapOutputFileStream;
-            sourcemapOutputFileStream.open(sourcemapOutputFileName.c_str());
+            sourcemapOutputFileStream.open(sourcemapOutputFileName.c_str(), mode);
 
             if (!sourcemapOutputFileStream.is_open()) {
                 std::cerr << "fatal: unable to write to file '" << sourcemapOutputFileName << "'\n";
                 exit(EXIT_FAILURE);
             }
+        }
 
-            sourcemapOutputFileStream << sourcemapOutputStream.rdbuf();
-            sourcemapOutputFileStream.close();
+        // Serialize to file or stdout, the sourcemap only if requested
+        std::ostream& outputStream = (outputFileName.empty()) ? std::cout : outputFileStream;
+        bool sourcemap = !sourcemapOutputFileName.empty();
+
+        if (argumentParser.exist(GroupsArgument)) {
+
+            // Serialize every resource group into its own file
+            ResourceGroupFiles files;
+            files.blueprint = &blueprint.node;
+            files.prefix = argumentParser.get<std::string>(GroupsArgument);
+            files.format = format;
+            files.options = serializeOptions;
+            files.failed.resize(blueprint.node.resourceGroups.size(), 0);
+
+            snowcrash::ParallelFor(WriteResourceGroupFile,
+                                   &files,
+                                   blueprint.node.resourceGroups.size(),
+                                   argumentParser.exist(ParallelArgument) ? 0 : 1);
+
+            for (size_t i = 0; i < files.failed.size(); ++i) {
+                if (files.failed[i]) {
+                    std::cerr << "fatal: unable to write to file '" << ResourceGroupFileName(files, i) << "'\n";
+                    exit(EXIT_FAILURE);
+                }
+            }
+
+            if (sourcemap && format == JSONSerializationFormat) {
+                SerializeSourceMapJSON(blueprint.sourceMap, sourcemapOutputFileStream, serializeOptions);
+            }
+            else if (sourcemap) {
+                SerializeSourceMapYAML(blueprint.sourceMap, sourcemapOutputFileStream, serializeOptions);
+            }
+        }
+        else {
+            Serialize(blueprint, output, outputStream, (sourcemap) ? &sourcemapOutputFileStream : NULL);
         }
     }
 
@@ -0,0 +1,58 @@
+//
+//  Directory.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <windows.h>
+#include "Directory.h"
+
+using namespace snowcrash;
+
+bool snowcrash::IsDirectory(const std::string& path)
+{
+    DWORD attributes = ::GetFileAttributesA(path.c_str());
+    return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+}
+
+bool snowcrash::ListDirectory(const std::string& path, std::vector<std::string>& files)
+{
+    std::string prefix = path;
+
+    if (prefix.empty() || (prefix[prefix.size() - 1] != '\\' && prefix[prefix.size() - 1] != '/'))
+        prefix += '\\';
+
+    WIN32_FIND_DATAA entry;
+    HANDLE find = ::FindFirstFileA((prefix + "*").c_str(), &entry);
+
+    if (find == INVALID_HANDLE_VALUE)
+        return ::GetLastError() == ERROR_FILE_NOT_FOUND;
+
+    bool result = true;
+
+    do {
+        if (entry.cFileName[0] == '.' || (entry.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN) != 0)
+            continue;
+
+        std::string child = prefix + entry.cFileName;
+
+        if ((entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0) {
+
+            if ((entry.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0)
+                continue;
+
+            if (!ListDirectory(child, files)) {
+                result = false;
+                break;
+            }
+        }
+        else {
+            files.push_back(child);
+        }
+    } while (::FindNextFileA(find, &entry));
+
+    ::FindClose(find);
+    return result;
+}
@@ -0,0 +1,72 @@
+//
+//  MappedFile.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <windows.h>
+#include "MappedFile.h"
+
+using namespace snowcrash;
+
+MappedFile::MappedFile()
+: address(NULL), length(0)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const std::string& path)
+{
+    close();
+
+    HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size)) {
+        ::CloseHandle(file);
+        return false;
+    }
+
+    if (size.QuadPart > 0) {
+        HANDLE mapping = ::CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+        if (!mapping) {
+            ::CloseHandle(file);
+            return false;
+        }
+
+        void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+        // The view stays valid after the handles are closed
+        ::CloseHandle(mapping);
+
+        if (!view) {
+            ::CloseHandle(file);
+            return false;
+        }
+
+        address = view;
+        length = static_cast<size_t>(size.QuadPart);
+    }
+
+    ::CloseHandle(file);
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (address)
+        ::UnmapViewOfFile(address);
+
+    address = NULL;
+    length = 0;
+}
@@ -0,0 +1,114 @@
+//
+//  Parallel.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <windows.h>
+#include <stdexcept>
+#include <vector>
+#include "Parallel.h"
+
+using namespace snowcrash;
+
+/** State of a parallel loop shared by its workers */
+struct ParallelLoop {
+    ParallelTask task;
+    void* context;
+    size_t count;
+    size_t next;
+    bool failed;
+    CRITICAL_SECTION lock;
+};
+
+/** Pick the next iteration of a loop, false if there is none */
+static bool NextIteration(ParallelLoop& loop, size_t& index)
+{
+    EnterCriticalSection(&loop.lock);
+
+    bool available = !loop.failed && loop.next < loop.count;
+
+    if (available)
+        index = loop.next++;
+
+    LeaveCriticalSection(&loop.lock);
+
+    return available;
+}
+
+/** Run iterations of a loop until there are none left */
+static DWORD WINAPI RunWorker(LPVOID argument)
+{
+    ParallelLoop& loop = *static_cast<ParallelLoop*>(argument);
+    size_t index;
+
+    while (NextIteration(loop, index)) {
+
+        try {
+            loop.task(index, loop.context);
+        }
+        catch (...) {
+            EnterCriticalSection(&loop.lock);
+            loop.failed = true;
+            LeaveCriticalSection(&loop.lock);
+        }
+    }
+
+    return 0;
+}
+
+void snowcrash::ParallelFor(ParallelTask task, void* context, size_t count, size_t workers)
+{
+    if (count == 0)
+        return;
+
+    if (workers == 0)
+        workers = ProcessorCount();
+
+    if (workers > count)
+        workers = count;
+
+    ParallelLoop loop;
+    loop.task = task;
+    loop.context = context;
+    loop.count = count;
+    loop.next = 0;
+    loop.failed = false;
+    InitializeCriticalSection(&loop.lock);
+
+    // Workers which can not be started are left to the others
+    std::vector<HANDLE> threads;
+    threads.reserve(workers - 1);
+
+    for (size_t i = 1; i < workers; ++i) {
+
+        HANDLE thread = CreateThread(NULL, 0, RunWorker, &loop, 0, NULL);
+
+        if (thread == NULL)
+            break;
+
+        threads.push_back(thread);
+    }
+
+    RunWorker(&loop);
+
+    for (std::vector<HANDLE>::iterator it = threads.begin(); it != threads.end(); ++it) {
+        WaitForSingleObject(*it, INFINITE);
+        CloseHandle(*it);
+    }
+
+    DeleteCriticalSection(&loop.lock);
+
+    if (loop.failed)
+        throw std::runtime_error("parallel task failed");
+}
+
+size_t snowcrash::ProcessorCount()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+
+    return (info.dwNumberOfProcessors > 0) ? static_cast<size_t>(info.dwNumberOfProcessors) : 1;
+}
@@ -15,6 +15,34 @@
 
 namespace snowcrashtest {
 
+    /** Blueprint of two resource groups used by the serialization tests */
+    static const mdp::ByteBuffer NotesBlueprintFixture = \
+    "FORMAT: 1A\n\n"\
+    "# API\n"\
+    "Lorem \"Ipsum\"\n\n"\
+    "# Group Notes\n\n"\
+    "## Note [/notes/{id}]\n"\
+    "+ Parameters\n"\
+    "    + id (required, number, `42`) ... Note id\n"\
+    "        + Values\n"\
+    "            + `42`\n"\
+    "            + `43`\n\n"\
+    "+ Model (application/json)\n\n"\
+    "        { \"id\": 42 }\n\n"\
+    "### Retrieve [GET]\n"\
+    "+ Request\n"\
+    "    + Headers\n\n"\
+    "            Accept: application/json\n\n"\
+    "+ Response 200\n\n"\
+    "    [Note][]\n\n"\
+    "## Notes [/notes]\n"\
+    "### List [GET]\n"\
+    "+ Response 204\n\n"\
+    "# Group Users\n\n"\
+    "## Users [/users]\n"\
+    "### List [GET]\n"\
+    "+ Response 204\n";
+
     struct Symbols {
 
         std::vector<snowcrash::ResourceModelSymbol> models;
@@ -34,11 +62,13 @@ namespace snowcrashtest {
 
             mdp::MarkdownParser markdownParser;
             mdp::MarkdownNode markdownAST;
+            snowcrash::FlatMarkdown markdown;
 
             snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
             snowcrash::ParseResult<snowcrash::Blueprint>* bppointer;
 
             markdownParser.parse(source, markdownAST);
+            markdown.build(markdownAST);
 
             REQUIRE(!markdownAST.children().empty());
 
@@ -48,7 +78,7 @@ namespace snowcrashtest {
                 bppointer = bp;
             }
 
-            snowcrash::SectionParserData pd(opts, source, bppointer->node);
+            snowcrash::SectionParserData pd(opts, source, bppointer->node, markdown);
 
             pd.sectionsContext.push_back(type);
 
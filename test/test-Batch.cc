@@ -0,0 +1,44 @@
+//
+//  test-Batch.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "snowcrashtest.h"
+#include "Batch.h"
+
+TEST_CASE("Name output files by a template", "[batch]")
+{
+    REQUIRE(OutputFileName("{path}.{ext}", "api/notes.apib", "json") == "api/notes.json");
+    REQUIRE(OutputFileName("out/{name}.{ext}", "api/notes.apib", "yaml") == "out/notes.yaml");
+    REQUIRE(OutputFileName("{path}.sm.{ext}", "notes.apib", "cbor") == "notes.sm.cbor");
+    REQUIRE(OutputFileName("{name}-{name}.txt", "notes.apib", "json") == "notes-notes.txt");
+    REQUIRE(OutputFileName("ast.json", "notes.apib", "json") == "ast.json");
+    REQUIRE(OutputFileName("", "notes.apib", "json").empty());
+}
+
+TEST_CASE("Name output files of inputs without an extension", "[batch]")
+{
+    REQUIRE(OutputFileName("{path}.{ext}", "notes", "json") == "notes.json");
+    REQUIRE(OutputFileName("{name}.{ext}", "v1.2/notes", "json") == "notes.json");
+    REQUIRE(OutputFileName("{path}.{ext}", "v1.2/notes", "json") == "v1.2/notes.json");
+    REQUIRE(OutputFileName("{name}.{ext}", "api\\notes.apib", "json") == "notes.json");
+    REQUIRE(OutputFileName("{name}.{ext}", "api/.apib", "json") == ".apib.json");
+}
+
+TEST_CASE("Keep unknown template fields", "[batch]")
+{
+    REQUIRE(OutputFileName("{dir}/{name", "api/notes.apib", "json") == "{dir}/{name");
+}
+
+TEST_CASE("Tell blueprint files of a directory", "[batch]")
+{
+    REQUIRE(IsBlueprintFile("api/notes.apib"));
+    REQUIRE(IsBlueprintFile("README.md"));
+    REQUIRE_FALSE(IsBlueprintFile("api/notes.json"));
+    REQUIRE_FALSE(IsBlueprintFile("api.apib/notes"));
+    REQUIRE_FALSE(IsBlueprintFile("notes"));
+    REQUIRE_FALSE(IsBlueprintFile("notes.apib.bak"));
+}
@@ -0,0 +1,350 @@
+//
+//  test-BinaryBlueprint.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <climits>
+#include <cstring>
+#include <sstream>
+#include "catch.hpp"
+#include "BinaryBlueprint.h"
+#include "CBinaryBlueprint.h"
+
+using namespace snowcrash;
+
+/** Aligned binary image */
+typedef std::vector<unsigned int> ImageBuffer;
+
+static void buildBlueprint(Blueprint& blueprint)
+{
+    blueprint.name = "API";
+    blueprint.description = "Lorem Ipsum";
+    blueprint.metadata.push_back(Metadata("FORMAT", "1A"));
+
+    ResourceGroup group;
+    group.name = "Group";
+
+    Resource resource;
+    resource.uriTemplate = "/resource/{id}";
+    resource.name = "Resource";
+    resource.model.name = "Resource";
+    resource.model.body = "{}";
+
+    Parameter parameter;
+    parameter.name = "id";
+    parameter.type = "number";
+    parameter.use = RequiredParameterUse;
+    parameter.exampleValue = "42";
+    parameter.values.push_back("42");
+    parameter.values.push_back("43");
+    resource.parameters.push_back(parameter);
+
+    Action action;
+    action.method = "GET";
+    action.name = "Retrieve";
+
+    TransactionExample example;
+    Request request;
+    request.headers.push_back(Header("Accept", "application/json"));
+    example.requests.push_back(request);
+
+    Response response;
+    response.name = "200";
+    response.headers.push_back(Header("Content-Type", "application/json"));
+    response.reference.id = "Resource";
+    response.reference.type = Reference::SymbolReference;
+    example.responses.push_back(response);
+
+    action.examples.push_back(example);
+    resource.actions.push_back(action);
+    group.resources.push_back(resource);
+    blueprint.resourceGroups.push_back(group);
+}
+
+static void imageBuffer(const std::string& data, ImageBuffer& buffer)
+{
+    buffer.assign((data.size() + sizeof(unsigned int) - 1) / sizeof(unsigned int), 0);
+    ::memcpy(&buffer[0], data.data(), data.size());
+}
+
+TEST_CASE("Read binary blueprint in place", "[binaryblueprint]")
+{
+    Blueprint blueprint;
+    buildBlueprint(blueprint);
+
+    std::stringstream ss;
+    SerializeBinaryBlueprint(blueprint, ss);
+
+    ImageBuffer buffer;
+    imageBuffer(ss.str(), buffer);
+
+    const BinaryBlueprintImage* image = OpenBinaryBlueprint(&buffer[0], ss.str().size());
+    REQUIRE(image);
+    REQUIRE(image->version == BinaryBlueprintVersion);
+    REQUIRE(image->size == ss.str().size());
+    REQUIRE(image->sourceMap.empty());
+
+    const BinaryBlueprint& record = image->blueprint;
+    REQUIRE(std::string(record.name.c_str()) == "API");
+    REQUIRE(record.metadata.size == 1);
+    REQUIRE(std::string(record.metadata[0].value.c_str()) == "1A");
+    REQUIRE(record.resourceGroups.size == 1);
+
+    const BinaryResource& resource = record.resourceGroups[0].resources[0];
+    REQUIRE(std::string(resource.uriTemplate.c_str()) == "/resource/{id}");
+    REQUIRE(std::string(resource.model.body.c_str()) == "{}");
+    REQUIRE(resource.parameters[0].use == RequiredParameterUse);
+    REQUIRE(resource.parameters[0].values.size == 2);
+    REQUIRE(std::string(resource.parameters[0].values[1].c_str()) == "43");
+
+    const BinaryTransactionExample& example = resource.actions[0].examples[0];
+    REQUIRE(std::string(example.responses[0].reference.id.c_str()) == "Resource");
+
+    // Identical strings are pooled
+    REQUIRE(example.requests[0].headers[0].value.c_str() == example.responses[0].headers[0].value.c_str());
+    REQUIRE(resource.name.c_str() == resource.model.name.c_str());
+}
+
+TEST_CASE("Binary blueprint round trip", "[binaryblueprint]")
+{
+    Blueprint blueprint;
+    buildBlueprint(blueprint);
+
+    std::stringstream ss;
+    SerializeBinaryBlueprint(blueprint, ss);
+
+    ImageBuffer buffer;
+    imageBuffer(ss.str(), buffer);
+
+    const BinaryBlueprintImage* image = OpenBinaryBlueprint(&buffer[0], ss.str().size());
+    REQUIRE(image);
+
+    Blueprint result;
+    ReadBinaryBlueprint(*image, result);
+
+    REQUIRE(result.name == "API");
+    REQUIRE(result.description == "Lorem Ipsum");
+    REQUIRE(result.metadata.size() == 1);
+    REQUIRE(result.metadata[0].first == "FORMAT");
+    REQUIRE(result.resourceGroups.size() == 1);
+    REQUIRE(result.resourceGroups[0].resources.size() == 1);
+
+    const Resource& resource = result.resourceGroups[0].resources[0];
+    REQUIRE(resource.model.name == "Resource");
+    REQUIRE(resource.parameters.size() == 1);
+    REQUIRE(resource.parameters[0].exampleValue == "42");
+    REQUIRE(resource.parameters[0].values.size() == 2);
+    REQUIRE(resource.actions.size() == 1);
+    REQUIRE(resource.actions[0].method == "GET");
+    REQUIRE(resource.actions[0].examples.size() == 1);
+    REQUIRE(resource.actions[0].examples[0].requests[0].headers[0].first == "Accept");
+    REQUIRE(resource.actions[0].examples[0].responses[0].name == "200");
+    REQUIRE(resource.actions[0].examples[0].responses[0].reference.id == "Resource");
+}
+
+TEST_CASE("Binary blueprint with source map", "[binaryblueprint]")
+{
+    Blueprint blueprint;
+    buildBlueprint(blueprint);
+
+    SourceMap<Blueprint> sourceMap;
+    sourceMap.name.sourceMap.push_back(mdp::BytesRange(2, 3));
+
+    SourceMap<Metadata> metadata;
+    metadata.sourceMap.push_back(mdp::BytesRange(0, 11));
+    sourceMap.metadata.collection.push_back(metadata);
+
+    std::stringstream ss;
+    SerializeBinaryBlueprint(blueprint, sourceMap, ss);
+
+    ImageBuffer buffer;
+    imageBuffer(ss.str(), buffer);
+
+    const BinaryBlueprintImage* image = OpenBinaryBlueprint(&buffer[0], ss.str().size());
+    REQUIRE(image);
+    REQUIRE((image->flags & SourceMapBinaryBlueprintFlag) != 0);
+
+    CompactSourceMap compact;
+    REQUIRE(ReadBinarySourceMap(*image, compact));
+    REQUIRE(compact.size() == 2);
+
+    mdp::BytesRangeSet name = compact.sourceMap(0, NameSourceMapField);
+    REQUIRE(name.size() == 1);
+    REQUIRE(name[0].location == 2);
+    REQUIRE(name[0].length == 3);
+
+    mdp::BytesRangeSet node = compact.sourceMap(1, NodeSourceMapField);
+    REQUIRE(node.size() == 1);
+    REQUIRE(node[0].length == 11);
+}
+
+TEST_CASE("Reject invalid binary blueprint", "[binaryblueprint]")
+{
+    Blueprint blueprint;
+    buildBlueprint(blueprint);
+
+    std::stringstream ss;
+    SerializeBinaryBlueprint(blueprint, ss);
+
+    ImageBuffer buffer;
+    imageBuffer(ss.str(), buffer);
+    size_t size = ss.str().size();
+
+    REQUIRE(OpenBinaryBlueprint(NULL, 0) == NULL);
+
+    // Truncated image
+    REQUIRE(OpenBinaryBlueprint(&buffer[0], size - 1) == NULL);
+
+    // Unaligned image
+    REQUIRE(OpenBinaryBlueprint(reinterpret_cast<const char*>(&buffer[0]) + 1, size) == NULL);
+
+    // Future version
+    BinaryBlueprintImage* image = reinterpret_cast<BinaryBlueprintImage*>(&buffer[0]);
+    image->version = BinaryBlueprintVersion + 1;
+    REQUIRE(OpenBinaryBlueprint(&buffer[0], size) == NULL);
+    image->version = BinaryBlueprintVersion;
+
+    // String out of bounds
+    image->blueprint.name.offset = image->size;
+    REQUIRE(OpenBinaryBlueprint(&buffer[0], size) == NULL);
+    imageBuffer(ss.str(), buffer);
+
+    // Array out of bounds
+    image = reinterpret_cast<BinaryBlueprintImage*>(&buffer[0]);
+    image->blueprint.resourceGroups.size = image->size;
+    REQUIRE(OpenBinaryBlueprint(&buffer[0], size) == NULL);
+    imageBuffer(ss.str(), buffer);
+
+    // Array referred to twice
+    image = reinterpret_cast<BinaryBlueprintImage*>(&buffer[0]);
+    REQUIRE(OpenBinaryBlueprint(&buffer[0], size) == image);
+
+    BinaryResource& resource = const_cast<BinaryResource&>(image->blueprint.resourceGroups[0].resources[0]);
+    const char* parameters = reinterpret_cast<const char*>(resource.parameters.begin());
+    resource.model.parameters.offset = static_cast<unsigned int>(parameters - reinterpret_cast<const char*>(&resource.model.parameters));
+    resource.model.parameters.size = resource.parameters.size;
+    REQUIRE(OpenBinaryBlueprint(&buffer[0], size) == NULL);
+}
+
+TEST_CASE("Reject source map not fitting binary blueprint", "[binaryblueprint]")
+{
+    Blueprint blueprint;
+    buildBlueprint(blueprint);
+
+    SourceMap<Blueprint> sourceMap;
+    sourceMap.name.sourceMap.push_back(mdp::BytesRange(static_cast<size_t>(UINT_MAX) + 1, 3));
+
+    std::vector<char> data(1);
+    bool isBuilt = BuildBinaryBlueprint(blueprint, &sourceMap, data);
+
+    if (sizeof(size_t) > sizeof(unsigned int)) {
+        REQUIRE_FALSE(isBuilt);
+        REQUIRE(data.empty());
+
+        std::stringstream ss;
+        SerializeBinaryBlueprint(blueprint, sourceMap, ss);
+        REQUIRE(ss.fail());
+        REQUIRE(ss.str().empty());
+
+        size_t size = 0;
+        REQUIRE(sc_bin_image_export(AS_CTYPE(sc_blueprint_t, &blueprint), AS_CTYPE(sc_sm_blueprint_t, &sourceMap), &size) == NULL);
+    }
+}
+
+TEST_CASE("Read binary blueprint with C interface", "[binaryblueprint][cinterface]")
+{
+    Blueprint blueprint;
+    buildBlueprint(blueprint);
+
+    std::stringstream ss;
+    SerializeBinaryBlueprint(blueprint, ss);
+
+    ImageBuffer buffer;
+    imageBuffer(ss.str(), buffer);
+
+    const sc_bin_blueprint_t* handle = sc_bin_blueprint_open(&buffer[0], ss.str().size());
+    REQUIRE(handle);
+    REQUIRE(std::string(sc_bin_blueprint_name(handle)) == "API");
+
+    const sc_bin_metadata_collection_t* metadataCol = sc_bin_metadata_collection_handle(handle);
+    REQUIRE(sc_bin_metadata_collection_size(metadataCol) == 1);
+    REQUIRE(std::string(sc_bin_metadata_key(sc_bin_metadata_handle(metadataCol, 0))) == "FORMAT");
+    REQUIRE(sc_bin_metadata_handle(metadataCol, 1) == NULL);
+
+    const sc_bin_resource_group_collection_t* groupCol = sc_bin_resource_group_collection_handle(handle);
+    REQUIRE(sc_bin_resource_group_collection_size(groupCol) == 1);
+
+    const sc_bin_resource_group_t* group = sc_bin_resource_group_handle(groupCol, 0);
+    REQUIRE(std::string(sc_bin_resource_group_name(group)) == "Group");
+
+    const sc_bin_resource_collection_t* resourceCol = sc_bin_resource_collection_handle(group);
+    const sc_bin_resource_t* resource = sc_bin_resource_handle(resourceCol, 0);
+    REQUIRE(std::string(sc_bin_resource_uritemplate(resource)) == "/resource/{id}");
+    REQUIRE(std::string(sc_bin_payload_body(sc_bin_payload_handle_resource(resource))) == "{}");
+
+    const sc_bin_parameter_collection_t* parameterCol = sc_bin_parameter_collection_handle_resource(resource);
+    REQUIRE(sc_bin_parameter_collection_size(parameterCol) == 1);
+
+    const sc_bin_parameter_t* parameter = sc_bin_parameter_handle(parameterCol, 0);
+    REQUIRE(sc_bin_parameter_parameter_use(parameter) == SC_REQUIRED_PARAMETER_USE);
+
+    const sc_bin_value_collection_t* valueCol = sc_bin_value_collection_handle(parameter);
+    REQUIRE(sc_bin_value_collection_size(valueCol) == 2);
+    REQUIRE(std::string(sc_bin_value(sc_bin_value_handle(valueCol, 0))) == "42");
+
+    const sc_bin_action_collection_t* actionCol = sc_bin_action_collection_handle(resource);
+    const sc_bin_action_t* action = sc_bin_action_handle(actionCol, 0);
+    REQUIRE(std::string(sc_bin_action_httpmethod(action)) == "GET");
+
+    const sc_bin_transaction_example_collection_t* exampleCol = sc_bin_transaction_example_collection_handle(action);
+    const sc_bin_transaction_example_t* example = sc_bin_transaction_example_handle(exampleCol, 0);
+
+    const sc_bin_payload_collection_t* responseCol = sc_bin_payload_collection_handle_responses(example);
+    const sc_bin_payload_t* response = sc_bin_payload_handle(responseCol, 0);
+    REQUIRE(std::string(sc_bin_payload_name(response)) == "200");
+    REQUIRE(std::string(sc_bin_reference_id(sc_bin_reference_handle_payload(response))) == "Resource");
+
+    const sc_bin_header_collection_t* headerCol = sc_bin_header_collection_handle_payload(response);
+    REQUIRE(sc_bin_header_collection_size(headerCol) == 1);
+    REQUIRE(std::string(sc_bin_header_key(sc_bin_header_handle(headerCol, 0))) == "Content-Type");
+
+    REQUIRE(sc_bin_blueprint_open(&buffer[0], 8) == NULL);
+}
+
+TEST_CASE("Export binary blueprint with C interface", "[binaryblueprint][cinterface]")
+{
+    Blueprint blueprint;
+    buildBlueprint(blueprint);
+
+    SourceMap<Blueprint> sourceMap;
+    sourceMap.name.sourceMap.push_back(mdp::BytesRange(2, 3));
+
+    size_t size = 0;
+    void* data = sc_bin_image_export(AS_CTYPE(sc_blueprint_t, &blueprint), AS_CTYPE(sc_sm_blueprint_t, &sourceMap), &size);
+    REQUIRE(data);
+
+    std::stringstream ss;
+    SerializeBinaryBlueprint(blueprint, sourceMap, ss);
+
+    REQUIRE(size == ss.str().size());
+    REQUIRE(::memcmp(data, ss.str().data(), size) == 0);
+
+    const sc_bin_blueprint_t* handle = sc_bin_blueprint_open(data, size);
+    REQUIRE(handle);
+    REQUIRE(std::string(sc_bin_blueprint_name(handle)) == "API");
+
+    const BinaryBlueprintImage* image = OpenBinaryBlueprint(data, size);
+    REQUIRE(image);
+    REQUIRE((image->flags & SourceMapBinaryBlueprintFlag) != 0);
+
+    sc_bin_image_free(data);
+
+    data = sc_bin_image_export(AS_CTYPE(sc_blueprint_t, &blueprint), NULL, &size);
+    REQUIRE(data);
+    REQUIRE((OpenBinaryBlueprint(data, size)->flags & SourceMapBinaryBlueprintFlag) == 0);
+
+    sc_bin_image_free(data);
+}
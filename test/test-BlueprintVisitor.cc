@@ -0,0 +1,171 @@
+//
+//  test-BlueprintVisitor.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include <vector>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "BlueprintVisitor.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+/**
+ *  Visitor writing the events as tokens, it verifies every container
+ *  gets as many members or items as its size says
+ */
+class TokenVisitor {
+public:
+    explicit TokenVisitor(std::ostream& os)
+    : output(&os), valid(true) {}
+
+    TokenVisitor(std::ostream& os, const TokenVisitor& parent, size_t index)
+    : output(&os), valid(true), sizes(parent.sizes), counts(parent.counts), arrays(parent.arrays) {
+        counts.back() = index;
+    }
+
+    void beginObject(size_t size) { item(); *output << "{" << size << " "; open(size, false); }
+    void endObject() { close(); *output << "} "; }
+    void beginArray(size_t size) { item(); *output << "[" << size << " "; open(size, true); }
+    void endArray() { close(); *output << "] "; }
+    void key(const std::string& key) { ++counts.back(); *output << key << ": "; }
+    void string(const std::string& value) { item(); *output << "\"" << value << "\" "; }
+    void literal(const std::string& value) { item(); *output << value << " "; }
+    void boolean(bool value) { item(); *output << ((value) ? "true " : "false "); }
+    void sourceMap(const SourceMapBase& value) { item(); *output << "<" << value.sourceMap.size() << "> "; }
+    void append(const std::string& value) { ++counts.back(); *output << value; }
+
+    std::ostream* output;
+    bool valid;
+
+private:
+    std::vector<size_t> sizes;
+    std::vector<size_t> counts;
+    std::vector<bool> arrays;
+
+    void item() {
+        if (!counts.empty() && arrays.back())
+            ++counts.back();
+    }
+
+    void open(size_t size, bool array) {
+        sizes.push_back(size);
+        counts.push_back(0);
+        arrays.push_back(array);
+    }
+
+    void close() {
+        valid = valid && sizes.back() == counts.back();
+        sizes.pop_back();
+        counts.pop_back();
+        arrays.pop_back();
+    }
+};
+
+TEST_CASE("Visitor gets sizes of all the containers", "[blueprintvisitor]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, ExportSourcemapOption, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream ast, sourceMap;
+    TokenVisitor astVisitor(ast);
+    TokenVisitor sourceMapVisitor(sourceMap);
+
+    VisitBlueprint(blueprint.node, blueprint.sourceMap, astVisitor, sourceMapVisitor);
+
+    REQUIRE(astVisitor.valid);
+    REQUIRE(sourceMapVisitor.valid);
+
+    REQUIRE(ast.str().find("{5 _version: 2.1 metadata: [1 {2 name: \"FORMAT\" value: \"1A\" } ] ") == 0);
+    REQUIRE(ast.str().find("reference: {1 id: \"Note\" } ") != std::string::npos);
+    REQUIRE(ast.str().find("required: true ") != std::string::npos);
+    REQUIRE(sourceMap.str().find("{4 metadata: [1 <") == 0);
+    REQUIRE(sourceMap.str().find("reference: <") != std::string::npos);
+}
+
+TEST_CASE("Visit AST and source map in one walk", "[blueprintvisitor]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, ExportSourcemapOption, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream ast, sourceMap;
+    TokenVisitor astVisitor(ast);
+    TokenVisitor sourceMapVisitor(sourceMap);
+
+    VisitBlueprint(blueprint.node, astVisitor);
+    VisitSourceMap(blueprint.sourceMap, sourceMapVisitor);
+
+    std::stringstream syncAST, syncSourceMap;
+    TokenVisitor syncASTVisitor(syncAST);
+    TokenVisitor syncSourceMapVisitor(syncSourceMap);
+
+    VisitBlueprint(blueprint.node, blueprint.sourceMap, syncASTVisitor, syncSourceMapVisitor);
+
+    REQUIRE(syncAST.str() == ast.str());
+    REQUIRE(syncSourceMap.str() == sourceMap.str());
+}
+
+TEST_CASE("Visit AST without a source map in one walk", "[blueprintvisitor]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream ast, sourceMap;
+    TokenVisitor astVisitor(ast);
+    TokenVisitor sourceMapVisitor(sourceMap);
+
+    VisitBlueprint(blueprint.node, blueprint.sourceMap, astVisitor, sourceMapVisitor);
+
+    REQUIRE(astVisitor.valid);
+    REQUIRE(sourceMapVisitor.valid);
+    REQUIRE(ast.str().find("resourceGroups: [2 ") != std::string::npos);
+    REQUIRE(sourceMap.str() == "{4 metadata: [0 ] name: <0> description: <0> resourceGroups: [0 ] } ");
+}
+
+TEST_CASE("Visit resource groups in parallel", "[blueprintvisitor]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, ExportSourcemapOption, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream ast, sourceMap;
+    TokenVisitor astVisitor(ast);
+    TokenVisitor sourceMapVisitor(sourceMap);
+
+    VisitBlueprint(blueprint.node, blueprint.sourceMap, astVisitor, sourceMapVisitor);
+
+    std::stringstream parallelAST, parallelSourceMap;
+    TokenVisitor parallelASTVisitor(parallelAST);
+    TokenVisitor parallelSourceMapVisitor(parallelSourceMap);
+
+    VisitBlueprint(blueprint.node, blueprint.sourceMap, parallelASTVisitor, parallelSourceMapVisitor, ParallelSerializeOption);
+
+    REQUIRE(parallelASTVisitor.valid);
+    REQUIRE(parallelSourceMapVisitor.valid);
+    REQUIRE(parallelAST.str() == ast.str());
+    REQUIRE(parallelSourceMap.str() == sourceMap.str());
+}
+
+TEST_CASE("Visit a range of resource groups", "[blueprintvisitor]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream ast;
+    TokenVisitor astVisitor(ast);
+
+    VisitBlueprint(blueprint.node, astVisitor, 0, 1, 2);
+
+    REQUIRE(astVisitor.valid);
+    REQUIRE(ast.str().find("resourceGroups: [1 {3 name: \"Users\" ") != std::string::npos);
+    REQUIRE(ast.str().find("\"Notes\"") == std::string::npos);
+}
@@ -0,0 +1,166 @@
+//
+//  test-CompactSourceMap.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "catch.hpp"
+#include "CompactSourceMap.h"
+
+using namespace snowcrash;
+
+static mdp::BytesRangeSet rangeSet(size_t location, size_t length)
+{
+    mdp::BytesRangeSet set;
+    set.push_back(mdp::BytesRange(location, length));
+    return set;
+}
+
+static void buildSourceMap(SourceMap<Blueprint>& sourceMap)
+{
+    sourceMap.name.sourceMap = rangeSet(0, 10);
+
+    // Adjacent ranges
+    sourceMap.description.sourceMap = rangeSet(10, 5);
+    sourceMap.description.sourceMap.push_back(mdp::BytesRange(15, 5));
+    sourceMap.description.sourceMap.push_back(mdp::BytesRange(30, 2));
+
+    SourceMap<Metadata> metadata;
+    metadata.sourceMap = rangeSet(100, 20);
+    sourceMap.metadata.collection.push_back(metadata);
+
+    SourceMap<ResourceGroup> group;
+    group.name.sourceMap = rangeSet(40, 8);
+
+    SourceMap<Resource> resource;
+    resource.uriTemplate.sourceMap = rangeSet(50, 12);
+
+    SourceMap<Parameter> modelParameter;
+    modelParameter.name.sourceMap = rangeSet(60, 1);
+    resource.model.parameters.collection.push_back(modelParameter);
+
+    SourceMap<Parameter> parameter;
+    parameter.name.sourceMap = rangeSet(70, 2);
+    SourceMap<Value> value;
+    value.sourceMap = rangeSet(72, 3);
+    parameter.values.collection.push_back(value);
+    resource.parameters.collection.push_back(parameter);
+
+    SourceMap<Action> action;
+    action.method.sourceMap = rangeSet(80, 3);
+
+    // Headers sharing one range
+    SourceMap<Header> header;
+    header.sourceMap = rangeSet(90, 10);
+    action.headers.collection.push_back(header);
+    action.headers.collection.push_back(header);
+
+    SourceMap<TransactionExample> example;
+    SourceMap<Request> request;
+    request.body.sourceMap = rangeSet(110, 4);
+    example.requests.collection.push_back(request);
+    SourceMap<Response> response;
+    response.body.sourceMap = rangeSet(120, 4);
+    example.responses.collection.push_back(response);
+    action.examples.collection.push_back(example);
+
+    resource.actions.collection.push_back(action);
+    group.resources.collection.push_back(resource);
+    sourceMap.resourceGroups.collection.push_back(group);
+}
+
+TEST_CASE("Build compact source map", "[compactsourcemap]")
+{
+    SourceMap<Blueprint> sourceMap;
+    buildSourceMap(sourceMap);
+
+    CompactSourceMap compact;
+    BuildCompactSourceMap(sourceMap, compact);
+
+    // blueprint, metadata, group, resource, model, model parameter,
+    // parameter, value, action, 2 headers, example, request, response
+    REQUIRE(compact.size() == 14);
+    REQUIRE(compact.nodeKinds[0] == BlueprintSourceMapNodeKind);
+    REQUIRE(compact.nodeKinds[1] == MetadataSourceMapNodeKind);
+    REQUIRE(compact.nodeKinds[2] == ResourceGroupSourceMapNodeKind);
+    REQUIRE(compact.nodeKinds[3] == ResourceSourceMapNodeKind);
+    REQUIRE(compact.nodeKinds[4] == ModelSourceMapNodeKind);
+    REQUIRE(compact.nodeKinds[5] == ParameterSourceMapNodeKind);
+    REQUIRE(compact.nodeParents[5] == 4);
+    REQUIRE(compact.nodeKinds[6] == ParameterSourceMapNodeKind);
+    REQUIRE(compact.nodeParents[6] == 3);
+    REQUIRE(compact.nodeKinds[7] == ValueSourceMapNodeKind);
+    REQUIRE(compact.nodeKinds[8] == ActionSourceMapNodeKind);
+    REQUIRE(compact.nodeKinds[9] == HeaderSourceMapNodeKind);
+    REQUIRE(compact.nodeKinds[10] == HeaderSourceMapNodeKind);
+    REQUIRE(compact.nodeKinds[13] == ResponseSourceMapNodeKind);
+
+    // Adjacent ranges are coalesced
+    mdp::BytesRangeSet description = compact.sourceMap(0, DescriptionSourceMapField);
+    REQUIRE(description.size() == 2);
+    REQUIRE(description[0].location == 10);
+    REQUIRE(description[0].length == 10);
+    REQUIRE(description[1].location == 30);
+    REQUIRE(description[1].length == 2);
+
+    // Shared ranges are stored once
+    REQUIRE(compact.entryRanges[compact.nodeEntries[9]] == compact.entryRanges[compact.nodeEntries[10]]);
+    REQUIRE(compact.rangeLocations.size() == compact.entryNodes.size() - 1);
+
+    REQUIRE(compact.sourceMap(8, MethodSourceMapField).size() == 1);
+    REQUIRE(compact.sourceMap(8, NameSourceMapField).empty());
+    REQUIRE(compact.sourceMap(100, NameSourceMapField).empty());
+}
+
+TEST_CASE("Expand compact source map", "[compactsourcemap]")
+{
+    SourceMap<Blueprint> sourceMap;
+    buildSourceMap(sourceMap);
+
+    CompactSourceMap compact;
+    BuildCompactSourceMap(sourceMap, compact);
+
+    SourceMap<Blueprint> expanded;
+    ExpandCompactSourceMap(compact, expanded);
+
+    REQUIRE(expanded.name.sourceMap.size() == 1);
+    REQUIRE(expanded.description.sourceMap.size() == 2);
+    REQUIRE(expanded.metadata.collection.size() == 1);
+    REQUIRE(expanded.metadata.collection[0].sourceMap[0].location == 100);
+    REQUIRE(expanded.resourceGroups.collection.size() == 1);
+
+    SourceMap<Resource>& resource = expanded.resourceGroups.collection[0].resources.collection[0];
+    REQUIRE(resource.uriTemplate.sourceMap[0].length == 12);
+    REQUIRE(resource.model.parameters.collection.size() == 1);
+    REQUIRE(resource.model.parameters.collection[0].name.sourceMap[0].location == 60);
+    REQUIRE(resource.parameters.collection.size() == 1);
+    REQUIRE(resource.parameters.collection[0].values.collection.size() == 1);
+    REQUIRE(resource.actions.collection.size() == 1);
+
+    SourceMap<Action>& action = resource.actions.collection[0];
+    REQUIRE(action.headers.collection.size() == 2);
+    REQUIRE(action.examples.collection.size() == 1);
+    REQUIRE(action.examples.collection[0].requests.collection.size() == 1);
+    REQUIRE(action.examples.collection[0].requests.collection[0].body.sourceMap[0].location == 110);
+    REQUIRE(action.examples.collection[0].responses.collection.size() == 1);
+    REQUIRE(action.examples.collection[0].responses.collection[0].body.sourceMap[0].location == 120);
+}
+
+TEST_CASE("Compact empty source map", "[compactsourcemap]")
+{
+    SourceMap<Blueprint> sourceMap;
+    CompactSourceMap compact;
+    BuildCompactSourceMap(sourceMap, compact);
+
+    REQUIRE(compact.size() == 1);
+    REQUIRE(compact.entryNodes.empty());
+
+    compact.clear();
+    REQUIRE(compact.empty());
+
+    SourceMap<Blueprint> expanded;
+    ExpandCompactSourceMap(compact, expanded);
+    REQUIRE(expanded.resourceGroups.collection.empty());
+}
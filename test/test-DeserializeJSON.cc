@@ -0,0 +1,98 @@
+//
+//  test-DeserializeJSON.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "SerializeJSON.h"
+#include "DeserializeJSON.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+TEST_CASE("Deserialize JSON AST", "[deserializejson]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream json;
+    SerializeJSON(blueprint.node, json);
+
+    Blueprint result;
+    Report report;
+    REQUIRE(DeserializeJSON(json.str(), result, report) == Error::OK);
+
+    REQUIRE(result.name == "API");
+    REQUIRE(result.metadata.size() == 1);
+    REQUIRE(result.resourceGroups.size() == 2);
+    REQUIRE(result.resourceGroups[0].resources.size() == 2);
+
+    const Resource& resource = result.resourceGroups[0].resources[0];
+    REQUIRE(resource.uriTemplate == "/notes/{id}");
+    REQUIRE(resource.parameters.size() == 1);
+    REQUIRE(resource.parameters[0].use == RequiredParameterUse);
+    REQUIRE(resource.actions.size() == 1);
+    REQUIRE(resource.actions[0].examples[0].responses[0].reference.id == "Note");
+
+    // Serialization of the deserialized AST is identical
+    std::stringstream roundTrip;
+    SerializeJSON(result, roundTrip);
+    REQUIRE(roundTrip.str() == json.str());
+
+    // Compact serialization reads the same
+    std::stringstream compact;
+    SerializeJSON(blueprint.node, compact, CompactSerializeOption);
+
+    Blueprint compactResult;
+    REQUIRE(DeserializeJSON(compact.str(), compactResult, report) == Error::OK);
+
+    std::stringstream compactRoundTrip;
+    SerializeJSON(compactResult, compactRoundTrip);
+    REQUIRE(compactRoundTrip.str() == json.str());
+}
+
+TEST_CASE("Deserialize JSON source map", "[deserializejson]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, ExportSourcemapOption, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream json;
+    SerializeSourceMapJSON(blueprint.sourceMap, json);
+
+    SourceMap<Blueprint> result;
+    Report report;
+    REQUIRE(DeserializeSourceMapJSON(json.str(), result, report) == Error::OK);
+
+    REQUIRE(result.name.sourceMap.size() == 1);
+    REQUIRE(result.name.sourceMap[0].location == blueprint.sourceMap.name.sourceMap[0].location);
+    REQUIRE(result.metadata.collection.size() == 1);
+
+    std::stringstream roundTrip;
+    SerializeSourceMapJSON(result, roundTrip);
+    REQUIRE(roundTrip.str() == json.str());
+}
+
+TEST_CASE("Report malformed JSON AST", "[deserializejson]")
+{
+    Blueprint result;
+
+    Report report;
+    REQUIRE(DeserializeJSON("{\n  \"name\": [\n}", result, report) == BusinessError);
+    REQUIRE(report.error.location.size() == 1);
+    REQUIRE(report.error.location[0].location == 12);
+
+    Report versionReport;
+    REQUIRE(DeserializeJSON("{\"_version\": \"1.0\"}", result, versionReport) == BusinessError);
+    REQUIRE(versionReport.error.message.find("version") != std::string::npos);
+
+    Report rangeReport;
+    SourceMap<Blueprint> sourceMap;
+    REQUIRE(DeserializeSourceMapJSON("{\"name\": [[1]]}", sourceMap, rangeReport) == BusinessError);
+}
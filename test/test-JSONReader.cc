@@ -0,0 +1,103 @@
+//
+//  test-JSONReader.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "catch.hpp"
+#include "JSONReader.h"
+#include "SourceAnnotation.h"
+
+using namespace snowcrash;
+
+static void readDocument(JSONReader& reader)
+{
+    reader.skipValue();
+    reader.finish();
+}
+
+TEST_CASE("Read JSON values", "[jsonreader]")
+{
+    std::string source = " { \"name\" : \"value\", \"list\": [1, true, null, -1.5e3, {}], \"flag\": false } ";
+    JSONReader reader(source.data(), source.size());
+
+    std::string key, value;
+
+    REQUIRE(reader.peek() == JSONReader::ObjectValueType);
+    reader.beginObject();
+
+    REQUIRE(reader.nextMember(key));
+    REQUIRE(key == "name");
+    reader.readString(value);
+    REQUIRE(value == "value");
+
+    REQUIRE(reader.nextMember(key));
+    REQUIRE(key == "list");
+    reader.beginArray();
+    REQUIRE(reader.nextItem());
+    REQUIRE(reader.readNumber() == 1);
+    REQUIRE(reader.nextItem());
+    REQUIRE(reader.readBoolean());
+    REQUIRE(reader.nextItem());
+    REQUIRE(reader.peek() == JSONReader::NullValueType);
+    reader.skipValue();
+    REQUIRE(reader.nextItem());
+    REQUIRE(reader.peek() == JSONReader::NumberValueType);
+    reader.skipValue();
+    REQUIRE(reader.nextItem());
+    reader.skipValue();
+    REQUIRE(!reader.nextItem());
+
+    REQUIRE(reader.nextMember(key));
+    REQUIRE(key == "flag");
+    REQUIRE(!reader.readBoolean());
+
+    REQUIRE(!reader.nextMember(key));
+    reader.finish();
+}
+
+TEST_CASE("Unescape JSON strings", "[jsonreader]")
+{
+    std::string source = "\"a \\\"quoted\\\" \\\\ \\/ value\\n\\t\\r\\b\\f\\u0001\\u00e9\\u20ac\\ud83d\\ude00\"";
+    JSONReader reader(source.data(), source.size());
+
+    std::string value;
+    reader.readString(value);
+    reader.finish();
+
+    REQUIRE(value == "a \"quoted\" \\ / value\n\t\r\b\f\x01\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80");
+}
+
+TEST_CASE("Reject malformed JSON", "[jsonreader]")
+{
+    const char* sources[] = {
+        "{\"key\" 1}",
+        "{\"key\": 1,}",
+        "[1 2]",
+        "[1,]",
+        "\"unterminated",
+        "\"bad \\x escape\"",
+        "\"\\ud83d alone\"",
+        "tru",
+        "[1] 2",
+        "-"
+    };
+
+    for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); ++i) {
+
+        std::string source = sources[i];
+        JSONReader reader(source.data(), source.size());
+
+        REQUIRE_THROWS_AS(readDocument(reader), Error);
+    }
+}
+
+TEST_CASE("Limit JSON nesting", "[jsonreader]")
+{
+    std::string source(1000, '[');
+    JSONReader reader(source.data(), source.size());
+
+    REQUIRE_THROWS_AS(readDocument(reader), Error);
+}
@@ -0,0 +1,120 @@
+//
+//  test-JSONWriter.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "catch.hpp"
+#include "JSONWriter.h"
+
+using namespace snowcrash;
+
+TEST_CASE("Write raw JSON tokens", "[jsonwriter]")
+{
+    std::stringstream ss;
+
+    {
+        JSONWriter writer(ss);
+        writer << "{" << '\n';
+        writer.indent(2);
+        writer << std::string("\"key\": [") << size_t(0) << ", " << size_t(1234567890) << "]\n}";
+    }
+
+    REQUIRE(ss.str() == "{\n    \"key\": [0, 1234567890]\n}");
+}
+
+TEST_CASE("Escape JSON strings", "[jsonwriter]")
+{
+    std::stringstream ss;
+    JSONWriter writer(ss);
+
+    writer.string("");
+    writer.string("Hello World");
+    writer.string("a \"quoted\" \\ value\n");
+    writer.string(std::string("\t\r\b\f\x01\x1f", 6));
+    writer.flush();
+
+    REQUIRE(ss.str() == "\"\"" \
+                        "\"Hello World\"" \
+                        "\"a \\\"quoted\\\" \\\\ value\\n\"" \
+                        "\"\\t\\r\\b\\f\\u0001\\u001f\"");
+}
+
+TEST_CASE("Escape long JSON strings", "[jsonwriter]")
+{
+    std::string value(100, 'x');
+    value[15] = '"';
+    value[16] = '\n';
+    value[63] = '\\';
+    value += "\xc5\xbe";
+
+    std::string expected(value);
+    expected.replace(63, 1, "\\\\");
+    expected.replace(16, 1, "\\n");
+    expected.replace(15, 1, "\\\"");
+
+    std::stringstream ss;
+    JSONWriter writer(ss);
+
+    writer.string(value);
+    writer.flush();
+
+    REQUIRE(ss.str() == "\"" + expected + "\"");
+}
+
+TEST_CASE("Write more than buffer size", "[jsonwriter]")
+{
+    std::string value(JSONWriter::BufferSize + 10, 'a');
+    std::stringstream ss;
+
+    {
+        JSONWriter writer(ss);
+        writer << "[";
+        writer.string(value);
+        writer << "," << value << "]";
+        writer.indent(100);
+    }
+
+    REQUIRE(ss.str().size() == 2 * value.size() + 5 + 200);
+    REQUIRE(ss.str().substr(0, 3) == "[\"a");
+    REQUIRE(ss.str().substr(value.size() + 1, 3) == "a\",");
+}
+
+TEST_CASE("Write compact JSON", "[jsonwriter]")
+{
+    std::stringstream ss;
+
+    {
+        JSONWriter writer(ss, true);
+        writer << "{";
+        writer.newLine();
+        writer.indent(1);
+        writer << "\"key\":";
+        writer.space();
+        writer << "[" << size_t(1) << "," << size_t(2) << "],";
+        writer.newLine();
+        writer.indent(1);
+        writer << "\"value\":";
+        writer.space();
+        writer.string("a b\nc");
+        writer.newLine();
+        writer << "}";
+    }
+
+    REQUIRE(ss.str() == "{\"key\":[1,2],\"value\":\"a b\\nc\"}");
+}
+
+TEST_CASE("Write raw whitespace of compact JSON", "[jsonwriter]")
+{
+    std::stringstream ss;
+
+    {
+        JSONWriter writer(ss, true);
+        writer << "{\"a\": 1}" << '\n' << std::string("[ ]\n");
+    }
+
+    REQUIRE(ss.str() == "{\"a\": 1}\n[ ]\n");
+}
@@ -0,0 +1,50 @@
+//
+//  test-Parallel.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <stdexcept>
+#include <vector>
+#include "snowcrashtest.h"
+#include "Parallel.h"
+
+using namespace snowcrash;
+
+static void CountIteration(size_t index, void* context)
+{
+    std::vector<int>& counts = *static_cast<std::vector<int>*>(context);
+    ++counts[index];
+}
+
+static void FailIteration(size_t index, void*)
+{
+    if (index == 3)
+        throw std::logic_error("failed");
+}
+
+TEST_CASE("Run every iteration of a parallel loop once", "[parallel]")
+{
+    std::vector<int> counts(100, 0);
+
+    ParallelFor(CountIteration, &counts, counts.size(), 4);
+
+    for (std::vector<int>::const_iterator it = counts.begin(); it != counts.end(); ++it) {
+        REQUIRE(*it == 1);
+    }
+
+    REQUIRE(ProcessorCount() >= 1);
+}
+
+TEST_CASE("Run parallel loop without iterations", "[parallel]")
+{
+    std::vector<int> counts;
+    ParallelFor(CountIteration, &counts, 0);
+}
+
+TEST_CASE("Report failed iteration of a parallel loop", "[parallel]")
+{
+    REQUIRE_THROWS_AS(ParallelFor(FailIteration, NULL, 10, 2), std::runtime_error);
+}
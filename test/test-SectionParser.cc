@@ -28,16 +28,20 @@ TEST_CASE("Header adapter with header section", "[adapter]")
     mdp::MarkdownNode markdownAST;
     markdownParser.parse(HeaderSectionFixture, markdownAST);
 
+    FlatMarkdown markdown;
+    markdown.build(markdownAST);
+
     REQUIRE(!markdownAST.children().empty());
 
-    REQUIRE_NOTHROW(HeaderSectionAdapter::startingNode(markdownAST.children().begin()));
-    MarkdownNodeIterator it = HeaderSectionAdapter::startingNode(markdownAST.children().begin());
-    REQUIRE(it->text == "Signature");
+    size_t seed = markdown.nodes.front().firstChild;
+    REQUIRE_NOTHROW(HeaderSectionAdapter::startingNode(seed, markdown));
+    size_t node = HeaderSectionAdapter::startingNode(seed, markdown);
+    REQUIRE(markdown.iterator(0, node)->text == "Signature");
 
-    const MarkdownNodes& collection = HeaderSectionAdapter::startingNodeSiblings(it, markdownAST.children());
-    REQUIRE(collection.size() == 2);
+    size_t parent = HeaderSectionAdapter::startingNodeParent(node, 0, markdown);
+    REQUIRE(markdown.children(parent).size() == 2);
 
-    REQUIRE(HeaderSectionAdapter::nextStartingNode(markdownAST.children().begin(), markdownAST.children(), it)->text == "Signature");
+    REQUIRE(markdown.iterator(0, HeaderSectionAdapter::nextStartingNode(seed, node, markdown))->text == "Signature");
 }
 
 TEST_CASE("Header adapter with list section", "[adapter]")
@@ -46,9 +50,12 @@ TEST_CASE("Header adapter with list section", "[adapter]")
     mdp::MarkdownNode markdownAST;
     markdownParser.parse(ListSectionFixture, markdownAST);
 
+    FlatMarkdown markdown;
+    markdown.build(markdownAST);
+
     REQUIRE(!markdownAST.children().empty());
 
-    REQUIRE_THROWS_AS(HeaderSectionAdapter::startingNode(markdownAST.children().begin()), std::logic_error);
+    REQUIRE_THROWS_AS(HeaderSectionAdapter::startingNode(markdown.nodes.front().firstChild, markdown), std::logic_error);
 }
 
 TEST_CASE("List adapter with List section", "[adapter]")
@@ -57,16 +64,21 @@ TEST_CASE("List adapter with List section", "[adapter]")
     mdp::MarkdownNode markdownAST;
     markdownParser.parse(ListSectionFixture, markdownAST);
 
+    FlatMarkdown markdown;
+    markdown.build(markdownAST);
+
     REQUIRE(!markdownAST.children().empty());
 
-    REQUIRE_NOTHROW(ListSectionAdapter::startingNode(markdownAST.children().begin()));
-    MarkdownNodeIterator it = ListSectionAdapter::startingNode(markdownAST.children().begin());
-    REQUIRE(it->text == "Signature");
+    size_t seed = markdown.nodes.front().firstChild;
+    REQUIRE_NOTHROW(ListSectionAdapter::startingNode(seed, markdown));
+    size_t node = ListSectionAdapter::startingNode(seed, markdown);
+    REQUIRE(markdown.iterator(seed, node)->text == "Signature");
 
-    MarkdownNodes collection = ListSectionAdapter::startingNodeSiblings(markdownAST.children().begin(), markdownAST.children());
-    REQUIRE(collection.size() == 2);
+    size_t parent = ListSectionAdapter::startingNodeParent(seed, 0, markdown);
+    REQUIRE(parent == seed);
+    REQUIRE(markdown.children(parent).size() == 2);
 
-    REQUIRE(ListSectionAdapter::nextStartingNode(markdownAST.children().begin(), markdownAST.children(), it) == markdownAST.children().end());
+    REQUIRE(ListSectionAdapter::nextStartingNode(seed, node, markdown) == NoFlatNode);
 }
 
 TEST_CASE("List adapter with Header section", "[adapter]")
@@ -75,7 +87,58 @@ TEST_CASE("List adapter with Header section", "[adapter]")
     mdp::MarkdownNode markdownAST;
     markdownParser.parse(HeaderSectionFixture, markdownAST);
 
+    FlatMarkdown markdown;
+    markdown.build(markdownAST);
+
     REQUIRE(!markdownAST.children().empty());
 
-    REQUIRE_THROWS_AS(ListSectionAdapter::startingNode(markdownAST.children().begin()), std::logic_error);
+    REQUIRE_THROWS_AS(ListSectionAdapter::startingNode(markdown.nodes.front().firstChild, markdown), std::logic_error);
+}
+
+TEST_CASE("Flatten Markdown AST in pre-order", "[adapter]")
+{
+    mdp::ByteBuffer source = "# API\n\n" + ListSectionFixture + "\n+ Next\n";
+
+    mdp::MarkdownParser markdownParser;
+    mdp::MarkdownNode markdownAST;
+    markdownParser.parse(source, markdownAST);
+
+    FlatMarkdown markdown;
+    markdown.build(markdownAST);
+
+    // Root, header, list item with two paragraphs, list item with one
+    REQUIRE(markdown.nodes.size() == 7);
+    REQUIRE(markdown.nodes[0].type == mdp::RootMarkdownNodeType);
+    REQUIRE(markdown.nodes[0].parent == NoFlatNode);
+    REQUIRE(markdown.nodes[0].firstChild == 1);
+    REQUIRE(markdown.nodes[1].type == mdp::HeaderMarkdownNodeType);
+    REQUIRE(markdown.nodes[1].nextSibling == 2);
+    REQUIRE(markdown.nodes[2].type == mdp::ListItemMarkdownNodeType);
+    REQUIRE(markdown.nodes[2].firstChild == 3);
+    REQUIRE(markdown.nodes[2].nextSibling == 5);
+    REQUIRE(markdown.nodes[3].nextSibling == 4);
+    REQUIRE(markdown.nodes[4].parent == 2);
+    REQUIRE(markdown.nodes[4].nextSibling == NoFlatNode);
+    REQUIRE(markdown.nodes[5].position == 2);
+    REQUIRE(markdown.nodes[5].nextSibling == NoFlatNode);
+    REQUIRE(markdown.nodes[6].parent == 5);
+
+    REQUIRE(markdown.text.substr(markdown.nodes[1].textBegin, markdown.nodes[1].textLength) == "API");
+    REQUIRE(markdown.nodes[1].range.location == 0);
+    REQUIRE(markdown.nodes[2].range.location == source.find("+ Signature"));
+
+    // Nodes of the Markdown AST and back
+    MarkdownNodes& listItem = markdownAST.children()[1].children();
+
+    REQUIRE(markdown.text.substr(markdown.nodes[4].textBegin, markdown.nodes[4].textLength) == listItem[1].text);
+
+    REQUIRE(markdown.parentOf(markdownAST.children()) == 0);
+    REQUIRE(markdown.parentOf(listItem) == 2);
+    REQUIRE(markdown.indexOf(2, listItem.begin() + 1) == 4);
+    REQUIRE(markdown.indexOf(2, listItem.end()) == NoFlatNode);
+    REQUIRE(markdown.iterator(2, 4) == listItem.begin() + 1);
+    REQUIRE(markdown.iterator(2, NoFlatNode) == listItem.end());
+
+    mdp::MarkdownNode other;
+    REQUIRE_THROWS_AS(markdown.parentOf(other.children()), std::logic_error);
 }
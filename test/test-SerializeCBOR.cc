@@ -0,0 +1,61 @@
+//
+//  test-SerializeCBOR.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "SerializeCBOR.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+TEST_CASE("CBOR AST starts with the map of the blueprint members", "[serializecbor]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream cbor;
+    SerializeCBOR(blueprint.node, cbor);
+
+    // Definite-length map of the blueprint members
+    REQUIRE(cbor.str()[0] == '\xA5');
+}
+
+TEST_CASE("Report malformed CBOR AST", "[serializecbor]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream cbor;
+    SerializeCBOR(blueprint.node, cbor);
+
+    Blueprint result;
+
+    Report truncatedReport;
+    mdp::ByteBuffer truncated = cbor.str().substr(0, cbor.str().size() - 1);
+    REQUIRE(DeserializeCBOR(truncated, result, truncatedReport) == BusinessError);
+
+    // Map with an integer key
+    Report keyReport;
+    REQUIRE(DeserializeCBOR("\xA1\x01\x01", result, keyReport) == BusinessError);
+    REQUIRE(keyReport.error.location.size() == 1);
+    REQUIRE(keyReport.error.location[0].location == 1);
+
+    Report trailingReport;
+    REQUIRE(DeserializeCBOR(cbor.str() + '\x00', result, trailingReport) == BusinessError);
+
+    // Unknown key of a value with many tags
+    Report tagsReport;
+    mdp::ByteBuffer tags = "\xA1\x61x" + mdp::ByteBuffer(2000000, '\xC0') + '\x00';
+    REQUIRE(DeserializeCBOR(tags, result, tagsReport) == Error::OK);
+
+    Report tagsEndReport;
+    REQUIRE(DeserializeCBOR(tags.substr(0, tags.size() - 1), result, tagsEndReport) == BusinessError);
+}
@@ -0,0 +1,137 @@
+//
+//  test-SerializeJSON.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "SerializeJSON.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+TEST_CASE("Serialize JSON AST and source map in one walk", "[serializejson]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, ExportSourcemapOption, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream ast, sourceMap;
+    SerializeJSON(blueprint.node, ast);
+    SerializeSourceMapJSON(blueprint.sourceMap, sourceMap);
+
+    std::stringstream syncAST, syncSourceMap;
+    SerializeJSON(blueprint.node, blueprint.sourceMap, syncAST, syncSourceMap);
+
+    REQUIRE(syncAST.str() == ast.str());
+    REQUIRE(syncSourceMap.str() == sourceMap.str());
+}
+
+TEST_CASE("Serialize JSON AST without a source map in one walk", "[serializejson]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream ast, sourceMap;
+    SerializeJSON(blueprint.node, ast);
+    SerializeSourceMapJSON(blueprint.sourceMap, sourceMap);
+
+    std::stringstream syncAST, syncSourceMap;
+    SerializeJSON(blueprint.node, blueprint.sourceMap, syncAST, syncSourceMap);
+
+    REQUIRE(syncAST.str() == ast.str());
+    REQUIRE(syncSourceMap.str() == sourceMap.str());
+}
+
+TEST_CASE("Serialize combined JSON AST and source map", "[serializejson]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, ExportSourcemapOption, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream ast, sourceMap, combined;
+    SerializeJSON(blueprint.node, ast, CompactSerializeOption);
+    SerializeSourceMapJSON(blueprint.sourceMap, sourceMap, CompactSerializeOption);
+    SerializeCombinedJSON(blueprint.node, blueprint.sourceMap, combined, CompactSerializeOption);
+
+    REQUIRE(combined.str() == "{\"ast\":" + ast.str() + ",\"sourcemap\":" + sourceMap.str() + "}");
+
+    std::stringstream indented;
+    SerializeCombinedJSON(blueprint.node, blueprint.sourceMap, indented);
+
+    REQUIRE(indented.str().find("{\n  \"ast\": {\n    \"_version\": \"2.1\",\n") == 0);
+    REQUIRE(indented.str().find("\n  },\n  \"sourcemap\": {\n    \"metadata\": [\n") != std::string::npos);
+    REQUIRE(indented.str().substr(indented.str().size() - 8) == "]\n  }\n}\n");
+}
+
+static const mdp::ByteBuffer GroupsFixture = \
+"FORMAT: 1A\n\n"\
+"# API\n\n"\
+"# Group First\n\n"\
+"## Note [/notes/{id}]\n"\
+"### Retrieve [GET]\n"\
+"+ Response 200\n\n"\
+"# Group Second\n"\
+"Second group\n\n"\
+"## Users [/users]\n"\
+"### List [GET]\n"\
+"+ Response 204\n\n"\
+"# Group Third\n\n"\
+"## Tags [/tags]\n"\
+"### Create [POST]\n"\
+"+ Request (text/plain)\n\n"\
+"        tag\n\n"\
+"+ Response 201\n";
+
+TEST_CASE("Serialize JSON resource groups in parallel", "[serializejson]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(GroupsFixture, ExportSourcemapOption, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.node.resourceGroups.size() == 3);
+
+    std::stringstream ast, sourceMap;
+    SerializeJSON(blueprint.node, blueprint.sourceMap, ast, sourceMap);
+
+    std::stringstream parallelAST, parallelSourceMap;
+    SerializeJSON(blueprint.node, blueprint.sourceMap, parallelAST, parallelSourceMap, ParallelSerializeOption);
+
+    REQUIRE(parallelAST.str() == ast.str());
+    REQUIRE(parallelSourceMap.str() == sourceMap.str());
+
+    std::stringstream compact, parallelCompact;
+    SerializeJSON(blueprint.node, compact, CompactSerializeOption);
+    SerializeJSON(blueprint.node, parallelCompact, CompactSerializeOption | ParallelSerializeOption);
+
+    REQUIRE(parallelCompact.str() == compact.str());
+}
+
+TEST_CASE("Serialize JSON AST of one resource group", "[serializejson]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(GroupsFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    Blueprint shard = blueprint.node;
+    shard.resourceGroups.erase(shard.resourceGroups.begin());
+    shard.resourceGroups.pop_back();
+
+    std::stringstream expected, group;
+    SerializeJSON(shard, expected);
+    SerializeResourceGroupJSON(blueprint.node, 1, group);
+
+    REQUIRE(group.str() == expected.str());
+
+    shard.resourceGroups.clear();
+
+    std::stringstream empty, outOfRange;
+    SerializeJSON(shard, empty);
+    SerializeResourceGroupJSON(blueprint.node, 3, outOfRange);
+
+    REQUIRE(outOfRange.str() == empty.str());
+}
@@ -0,0 +1,53 @@
+//
+//  test-SerializeMessagePack.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "SerializeMessagePack.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+TEST_CASE("MessagePack AST starts with the map of the blueprint members", "[serializemessagepack]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream msgpack;
+    SerializeMessagePack(blueprint.node, msgpack);
+
+    // Fixmap of the blueprint members
+    REQUIRE(msgpack.str()[0] == '\x85');
+}
+
+TEST_CASE("Report malformed MessagePack AST", "[serializemessagepack]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream msgpack;
+    SerializeMessagePack(blueprint.node, msgpack);
+
+    Blueprint result;
+
+    Report truncatedReport;
+    mdp::ByteBuffer truncated = msgpack.str().substr(0, msgpack.str().size() - 1);
+    REQUIRE(DeserializeMessagePack(truncated, result, truncatedReport) == BusinessError);
+
+    // Map with an integer key
+    Report keyReport;
+    REQUIRE(DeserializeMessagePack("\x81\x01\x01", result, keyReport) == BusinessError);
+    REQUIRE(keyReport.error.location.size() == 1);
+    REQUIRE(keyReport.error.location[0].location == 1);
+
+    Report trailingReport;
+    REQUIRE(DeserializeMessagePack(msgpack.str() + '\x00', result, trailingReport) == BusinessError);
+}
@@ -0,0 +1,119 @@
+//
+//  test-SerializeNDJSON.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include <vector>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "SerializeNDJSON.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+TEST_CASE("Serialize one JSON record per action", "[serializendjson]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream ndjson;
+    SerializeNDJSON(blueprint.node, ndjson);
+
+    std::string line;
+    REQUIRE(std::getline(ndjson, line));
+    REQUIRE(line == "{\"group\":\"Notes\",\"resource\":\"Note\",\"uriTemplate\":\"/notes/{id}\","\
+                    "\"action\":\"Retrieve\",\"method\":\"GET\",\"parameters\":["\
+                    "{\"name\":\"id\",\"description\":\"Note id\",\"type\":\"number\",\"required\":true,"\
+                    "\"default\":\"\",\"example\":\"42\",\"values\":[\"42\",\"43\"]}],\"transactions\":["\
+                    "{\"example\":\"\",\"request\":{\"name\":\"\",\"headers\":[{\"name\":\"Accept\",\"value\":\"application/json\"}],"\
+                    "\"body\":\"\",\"schema\":\"\"},\"response\":{\"name\":\"200\",\"headers\":[{\"name\":\"Content-Type\",\"value\":\"application/json\"}],"\
+                    "\"body\":\"{ \\\"id\\\": 42 }\\n\",\"schema\":\"\"}}]}");
+
+    REQUIRE(std::getline(ndjson, line));
+    REQUIRE(line == "{\"group\":\"Notes\",\"resource\":\"Notes\",\"uriTemplate\":\"/notes\","\
+                    "\"action\":\"List\",\"method\":\"GET\",\"parameters\":[],\"transactions\":["\
+                    "{\"example\":\"\",\"request\":null,\"response\":{\"name\":\"204\",\"headers\":[],\"body\":\"\",\"schema\":\"\"}}]}");
+
+    REQUIRE(std::getline(ndjson, line));
+    REQUIRE(line.find("{\"group\":\"Users\",\"resource\":\"Users\",\"uriTemplate\":\"/users\",\"action\":\"List\"") == 0);
+
+    REQUIRE_FALSE(std::getline(ndjson, line));
+}
+
+TEST_CASE("Serialize action parameters before the resource parameters", "[serializendjson]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n"\
+    "## Note [/notes/{id}]\n"\
+    "+ Parameters\n"\
+    "    + id (required, number) ... Note id\n"\
+    "    + format (optional) ... Format\n\n"\
+    "### Retrieve [GET]\n"\
+    "+ Parameters\n"\
+    "    + format (required) ... Output format\n\n"\
+    "+ Response 200\n\n"\
+    "        {}\n\n"\
+    "+ Response 404\n";
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream ndjson;
+    SerializeNDJSON(blueprint.node, ndjson);
+
+    // The overridden resource parameter is left out, every response is a transaction
+    REQUIRE(ndjson.str() == "{\"group\":\"\",\"resource\":\"Note\",\"uriTemplate\":\"/notes/{id}\","\
+                            "\"action\":\"Retrieve\",\"method\":\"GET\",\"parameters\":["\
+                            "{\"name\":\"format\",\"description\":\"Output format\",\"type\":\"\",\"required\":true,"\
+                            "\"default\":\"\",\"example\":\"\",\"values\":[]},"\
+                            "{\"name\":\"id\",\"description\":\"Note id\",\"type\":\"number\",\"required\":true,"\
+                            "\"default\":\"\",\"example\":\"\",\"values\":[]}],\"transactions\":["\
+                            "{\"example\":\"\",\"request\":null,\"response\":{\"name\":\"200\",\"headers\":[],\"body\":\"{}\\n\",\"schema\":\"\"}},"\
+                            "{\"example\":\"\",\"request\":null,\"response\":{\"name\":\"404\",\"headers\":[],\"body\":\"\",\"schema\":\"\"}}]}\n");
+}
+
+TEST_CASE("Serialize no JSON records without actions", "[serializendjson]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse("# API\n", 0, blueprint);
+
+    std::stringstream ndjson;
+    SerializeNDJSON(blueprint.node, ndjson);
+
+    REQUIRE(ndjson.str().empty());
+}
+
+/** String buffer recording its content at every flush */
+class FlushRecordingBuffer : public std::stringbuf {
+public:
+    std::vector<std::string> flushes;
+
+protected:
+    virtual int sync() {
+        flushes.push_back(str());
+        return 0;
+    }
+};
+
+TEST_CASE("Flush every JSON record", "[serializendjson]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    FlushRecordingBuffer buffer;
+    std::ostream ndjson(&buffer);
+    SerializeNDJSON(blueprint.node, ndjson);
+
+    REQUIRE(buffer.flushes.size() == 3);
+    REQUIRE(buffer.flushes[0].find("\"Retrieve\"") != std::string::npos);
+    REQUIRE(buffer.flushes[0].find("\"List\"") == std::string::npos);
+    REQUIRE(buffer.flushes[0][buffer.flushes[0].size() - 1] == '\n');
+    REQUIRE(buffer.flushes[2] == buffer.str());
+}
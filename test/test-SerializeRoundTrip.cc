@@ -0,0 +1,116 @@
+//
+//  test-SerializeRoundTrip.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <fstream>
+#include <sstream>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "SerializeCBOR.h"
+#include "SerializeMessagePack.h"
+#include "SerializeJSON.h"
+#include "DeserializeJSON.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+/** Binary serialization format, CBOR */
+struct CBORFormat {
+    static void serialize(const Blueprint& blueprint, std::ostream& os) {
+        SerializeCBOR(blueprint, os);
+    }
+
+    static int deserialize(const mdp::ByteBuffer& source, Blueprint& blueprint, Report& report) {
+        return DeserializeCBOR(source, blueprint, report);
+    }
+
+    static void serializeSourceMap(const SourceMap<Blueprint>& sourceMap, std::ostream& os) {
+        SerializeSourceMapCBOR(sourceMap, os);
+    }
+
+    static int deserializeSourceMap(const mdp::ByteBuffer& source, SourceMap<Blueprint>& sourceMap, Report& report) {
+        return DeserializeSourceMapCBOR(source, sourceMap, report);
+    }
+};
+
+/** Binary serialization format, MessagePack */
+struct MessagePackFormat {
+    static void serialize(const Blueprint& blueprint, std::ostream& os) {
+        SerializeMessagePack(blueprint, os);
+    }
+
+    static int deserialize(const mdp::ByteBuffer& source, Blueprint& blueprint, Report& report) {
+        return DeserializeMessagePack(source, blueprint, report);
+    }
+
+    static void serializeSourceMap(const SourceMap<Blueprint>& sourceMap, std::ostream& os) {
+        SerializeSourceMapMessagePack(sourceMap, os);
+    }
+
+    static int deserializeSourceMap(const mdp::ByteBuffer& source, SourceMap<Blueprint>& sourceMap, Report& report) {
+        return DeserializeSourceMapMessagePack(source, sourceMap, report);
+    }
+};
+
+/** Serialize the AST of the JSON fixture and compare it read back as JSON */
+template<typename Format>
+static void CheckASTRoundTrip()
+{
+    std::ifstream fixture("features/fixtures/ast.json");
+    REQUIRE(fixture.is_open());
+
+    std::stringstream json;
+    json << fixture.rdbuf();
+
+    Blueprint blueprint;
+    Report report;
+    REQUIRE(DeserializeJSON(json.str(), blueprint, report) == Error::OK);
+
+    std::stringstream binary;
+    Format::serialize(blueprint, binary);
+    REQUIRE(binary.str().size() < json.str().size());
+
+    Blueprint result;
+    REQUIRE(Format::deserialize(binary.str(), result, report) == Error::OK);
+
+    std::stringstream roundTrip;
+    SerializeJSON(result, roundTrip);
+    REQUIRE(roundTrip.str() == json.str());
+}
+
+/** Serialize a source map and compare it read back as JSON */
+template<typename Format>
+static void CheckSourceMapRoundTrip()
+{
+    ParseResult<Blueprint> blueprint;
+    parse(NotesBlueprintFixture, ExportSourcemapOption, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    std::stringstream binary;
+    Format::serializeSourceMap(blueprint.sourceMap, binary);
+
+    SourceMap<Blueprint> result;
+    Report report;
+    REQUIRE(Format::deserializeSourceMap(binary.str(), result, report) == Error::OK);
+
+    std::stringstream json, roundTrip;
+    SerializeSourceMapJSON(blueprint.sourceMap, json);
+    SerializeSourceMapJSON(result, roundTrip);
+    REQUIRE(roundTrip.str() == json.str());
+}
+
+TEST_CASE("Binary AST round trip of the JSON fixture", "[serializecbor][serializemessagepack]")
+{
+    CheckASTRoundTrip<CBORFormat>();
+    CheckASTRoundTrip<MessagePackFormat>();
+}
+
+TEST_CASE("Binary source map round trip", "[serializecbor][serializemessagepack]")
+{
+    CheckSourceMapRoundTrip<CBORFormat>();
+    CheckSourceMapRoundTrip<MessagePackFormat>();
+}
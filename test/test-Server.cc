@@ -0,0 +1,174 @@
+//
+//  test-Server.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include "snowcrashtest.h"
+#include "Server.h"
+
+/** Request of a method with given params */
+static std::string Request(const std::string& method, const std::string& params)
+{
+    return "{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"" + method + "\",\"params\":{" + params + "}}";
+}
+
+/** Error response to the request of id 1 */
+static std::string ErrorResponse(int code, const std::string& message)
+{
+    std::stringstream ss;
+    ss << "{\"jsonrpc\":\"2.0\",\"id\":1,\"error\":{\"code\":" << code << ",\"message\":\"" << message << "\"}}";
+    return ss.str();
+}
+
+/** Write whole file */
+static void WriteFile(const std::string& path, const std::string& content)
+{
+    std::ofstream fileStream(path.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    fileStream << content;
+}
+
+static const std::string Source = "\"source\":\"# API\\n\"";
+static const std::string OKReport = "\"report\":{\"error\":{\"code\":0,\"message\":\"\",\"location\":[]},\"warnings\":[]}";
+
+TEST_CASE("Serve validate, parse and serialize requests", "[server]")
+{
+    Server server;
+
+    REQUIRE(server.handle(Request("validate", Source)) == "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":{" + OKReport + "}}");
+
+    std::string parse = server.handle(Request("parse", Source));
+    REQUIRE(parse.find("{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":{" + OKReport + ",\"ast\":{") == 0);
+    REQUIRE(parse.find("\"name\":\"API\"") != std::string::npos);
+    REQUIRE(parse.find("\"sourcemap\"") == std::string::npos);
+    REQUIRE(parse.find('\n') == std::string::npos);
+
+    std::string sourcemap = server.handle(Request("parse", Source + ",\"sourcemap\":true"));
+    REQUIRE(sourcemap.find(",\"sourcemap\":{") != std::string::npos);
+
+    std::string yaml = server.handle(Request("serialize", Source + ",\"format\":\"yaml\""));
+    REQUIRE(yaml.find(OKReport + ",\"ast\":\"") != std::string::npos);
+    REQUIRE(yaml.find("name: \\\"API\\\"") != std::string::npos);
+
+    std::string json = server.handle(Request("serialize", Source + ",\"compact\":true"));
+    REQUIRE(json.find("\\\"name\\\":\\\"API\\\"") != std::string::npos);
+
+    REQUIRE(server.handle(Request("serialize", Source + ",\"format\":\"ndjson\",\"sourcemap\":true")) ==
+            ErrorResponse(-32602, "unsupported format 'ndjson'"));
+}
+
+TEST_CASE("Serve the reports of invalid blueprints", "[server]")
+{
+    Server server;
+
+    // No API name
+    std::string response = server.handle(Request("validate", "\"source\":\"Lorem ipsum\\n\""));
+
+    REQUIRE(response.find("\"result\":{\"report\":{\"error\":{\"code\":0,") != std::string::npos);
+    REQUIRE(response.find("\"warnings\":[{\"code\":") != std::string::npos);
+}
+
+TEST_CASE("Report invalid requests", "[server]")
+{
+    Server server;
+
+    REQUIRE(server.handle("{\"method\":\"parse\"").find("{\"jsonrpc\":\"2.0\",\"id\":null,\"error\":{\"code\":-32700,") == 0);
+    REQUIRE(server.handle("{\"id\":1}") == ErrorResponse(-32600, "method expected"));
+    REQUIRE(server.handle(Request("render", Source)) == ErrorResponse(-32601, "unknown method 'render'"));
+    REQUIRE(server.handle("{\"id\":1,\"method\":\"parse\",\"params\":[]}") == ErrorResponse(-32602, "params have to be an object"));
+}
+
+TEST_CASE("Require either path or source", "[server]")
+{
+    Server server;
+
+    REQUIRE(server.handle(Request("parse", "")) == ErrorResponse(-32602, "either path or source expected"));
+    REQUIRE(server.handle(Request("parse", Source + ",\"path\":\"a.apib\"")) == ErrorResponse(-32602, "either path or source expected"));
+    REQUIRE(server.handle(Request("parse", "\"path\":\"missing.apib\"")) == ErrorResponse(-32000, "unable to open input file 'missing.apib'"));
+}
+
+TEST_CASE("Do not answer notifications", "[server]")
+{
+    Server server;
+
+    REQUIRE(server.handle("{\"jsonrpc\":\"2.0\",\"method\":\"parse\",\"params\":{" + Source + "}}").empty());
+    REQUIRE(server.handle("{\"jsonrpc\":\"2.0\",\"method\":\"render\"}").empty());
+
+    // Unless the request can't be read
+    REQUIRE(server.handle("{\"jsonrpc\":\"2.0\",\"params\":{}}").find("\"id\":null,\"error\":{\"code\":-32600,") != std::string::npos);
+}
+
+TEST_CASE("Serve cached sources", "[server]")
+{
+    Server server;
+
+    std::string first = server.handle(Request("parse", Source));
+    REQUIRE(server.handle(Request("parse", Source)) == first);
+
+    // More sources than the cache keeps
+    for (size_t i = 0; i < 100; ++i) {
+        std::stringstream source;
+        source << "\"source\":\"# API " << i << "\\n\"";
+
+        std::stringstream name;
+        name << "\"name\":\"API " << i << "\"";
+
+        REQUIRE(server.handle(Request("parse", source.str())).find(name.str()) != std::string::npos);
+    }
+
+    REQUIRE(server.handle(Request("parse", Source)) == first);
+}
+
+TEST_CASE("Serve a file rewritten after it is cached", "[server]")
+{
+    const std::string path = "test-Server.apib";
+    const std::string params = "\"path\":\"" + path + "\"";
+
+    WriteFile(path, "# First\n");
+
+    {
+        Server server;
+
+        REQUIRE(server.handle(Request("parse", params)).find("\"name\":\"First\"") != std::string::npos);
+        REQUIRE(server.handle(Request("parse", params)).find("\"name\":\"First\"") != std::string::npos);
+
+        WriteFile(path, "# Second API\n");
+        REQUIRE(server.handle(Request("parse", params)).find("\"name\":\"Second API\"") != std::string::npos);
+        REQUIRE(server.handle(Request("validate", params)).find(OKReport) != std::string::npos);
+
+        // A watched file is replaced once the watcher sees the change
+        WriteFile(path, "# Third\n");
+
+        std::string response;
+        std::clock_t start = std::clock();
+
+        do {
+            response = server.handle(Request("parse", params));
+        } while (response.find("\"name\":\"Third\"") == std::string::npos && std::clock() - start < 5 * CLOCKS_PER_SEC);
+
+        REQUIRE(response.find("\"name\":\"Third\"") != std::string::npos);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Serve requests line by line", "[server]")
+{
+    Server server;
+
+    std::stringstream input;
+    input << Request("validate", Source) << "\n\n";
+    input << "{\"jsonrpc\":\"2.0\",\"method\":\"validate\",\"params\":{" << Source << "}}\n";
+    input << "{\"id\":2}\n";
+
+    std::stringstream output;
+    server.serve(input, output);
+
+    REQUIRE(output.str() == "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":{" + OKReport + "}}\n"
+                            "{\"jsonrpc\":\"2.0\",\"id\":2,\"error\":{\"code\":-32600,\"message\":\"method expected\"}}\n");
+}
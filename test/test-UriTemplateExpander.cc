@@ -0,0 +1,89 @@
+//
+//  test-UriTemplateExpander.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "catch.hpp"
+#include "UriTemplateExpander.h"
+
+using namespace snowcrash;
+
+static const std::string Var = "value";
+static const std::string Hello = "Hello World!";
+static const std::string Path = "/foo/bar";
+static const std::string Empty = "";
+static const std::string X = "1024";
+static const std::string Y = "768";
+
+/** Expand a template with the variables of RFC 6570 examples */
+static std::string Expand(const URITemplate& uriTemplate)
+{
+    URITemplateExpander expander(uriTemplate);
+    URITemplateValues values(expander.variables().size(), NULL);
+
+    for (size_t i = 0; i < expander.variables().size(); ++i) {
+        const std::string& name = expander.variables()[i];
+
+        if (name == "var") values[i] = &Var;
+        if (name == "hello") values[i] = &Hello;
+        if (name == "path") values[i] = &Path;
+        if (name == "empty") values[i] = &Empty;
+        if (name == "x") values[i] = &X;
+        if (name == "y") values[i] = &Y;
+    }
+
+    std::string out;
+    expander.expand(values, out);
+    return out;
+}
+
+TEST_CASE("Expand level one and two uri templates", "[uritemplateexpander]")
+{
+    REQUIRE(Expand("{var}") == "value");
+    REQUIRE(Expand("{hello}") == "Hello%20World%21");
+    REQUIRE(Expand("{+var}") == "value");
+    REQUIRE(Expand("{+hello}") == "Hello%20World!");
+    REQUIRE(Expand("{+path}/here") == "/foo/bar/here");
+    REQUIRE(Expand("here?ref={+path}") == "here?ref=/foo/bar");
+    REQUIRE(Expand("X{#var}") == "X#value");
+    REQUIRE(Expand("X{#hello}") == "X#Hello%20World!");
+}
+
+TEST_CASE("Expand level three uri templates", "[uritemplateexpander]")
+{
+    REQUIRE(Expand("map?{x,y}") == "map?1024,768");
+    REQUIRE(Expand("{x,hello,y}") == "1024,Hello%20World%21,768");
+    REQUIRE(Expand("{+x,hello,y}") == "1024,Hello%20World!,768");
+    REQUIRE(Expand("{+path,x}/here") == "/foo/bar,1024/here");
+    REQUIRE(Expand("{#x,hello,y}") == "#1024,Hello%20World!,768");
+    REQUIRE(Expand("{#path,x}/here") == "#/foo/bar,1024/here");
+    REQUIRE(Expand("X{.var}") == "X.value");
+    REQUIRE(Expand("X{.x,y}") == "X.1024.768");
+    REQUIRE(Expand("{/var}") == "/value");
+    REQUIRE(Expand("{/var,x}/here") == "/value/1024/here");
+    REQUIRE(Expand("{;x,y}") == ";x=1024;y=768");
+    REQUIRE(Expand("{;x,y,empty}") == ";x=1024;y=768;empty");
+    REQUIRE(Expand("{?x,y}") == "?x=1024&y=768");
+    REQUIRE(Expand("{?x,y,empty}") == "?x=1024&y=768&empty=");
+    REQUIRE(Expand("?fixed=yes{&x}") == "?fixed=yes&x=1024");
+    REQUIRE(Expand("{&x,y,empty}") == "&x=1024&y=768&empty=");
+}
+
+TEST_CASE("Expand uri template with undefined variables", "[uritemplateexpander]")
+{
+    REQUIRE(Expand("/notes{/undef}{?undef,x}") == "/notes?x=1024");
+    REQUIRE(Expand("/notes/{undef}") == "/notes/");
+    REQUIRE(Expand("/a b{|x}") == "/a%20b{|x}");
+
+    URITemplateExpander expander("/notes/{id}{?limit,id}");
+    REQUIRE(expander.variables().size() == 2);
+    REQUIRE(expander.variableIndex("limit") == 1);
+    REQUIRE(expander.variableIndex("undef") == std::string::npos);
+
+    std::string out = "previous";
+    expander.expand(URITemplateValues(), out);
+    REQUIRE(out == "/notes/");
+}
@@ -331,3 +331,41 @@ TEST_CASE("Parse uri template for consistent invalid character warning", "[inval
     REQUIRE(result2.report.warnings[0].message == "URI template expression \"$a,b,c\" contains invalid characters. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters");
 
 }
+
+TEST_CASE("Parse uri template expressions and their operators", "[uritemplateexpressions]")
+{
+    const snowcrash::URITemplate uri = "https://www.test.com/notes/{id}{?limit,offset}{.format}";
+
+    ParsedURITemplate result;
+    mdp::CharactersRangeSet sourceBlock;
+
+    URITemplateParser::parse(uri, sourceBlock, result);
+
+    REQUIRE(result.scheme == "https");
+    REQUIRE(result.host == "www.test.com");
+    REQUIRE(result.path == "/notes/{id}{?limit,offset}{.format}");
+
+    REQUIRE(result.expressions.size() == 3);
+    REQUIRE(result.expressions[0].op == NoURITemplateOperator);
+    REQUIRE(result.path.substr(result.expressions[0].offset, result.expressions[0].length) == "id");
+    REQUIRE(result.expressions[1].op == QueryURITemplateOperator);
+    REQUIRE(result.path.substr(result.expressions[1].offset, result.expressions[1].length) == "?limit,offset");
+    REQUIRE(result.expressions[2].op == LabelURITemplateOperator);
+
+    REQUIRE(result.report.warnings.size() == 1);
+    REQUIRE(result.report.warnings[0].message == "URI template label expansion is not supported");
+}
+
+TEST_CASE("Parse identical uri templates once", "[uritemplatecache]")
+{
+    ParsedURITemplates cache;
+
+    const ParsedURITemplate& result = URITemplateParser::parse("/notes/{id-x}", cache);
+    const ParsedURITemplate& result2 = URITemplateParser::parse("/notes/{id-x}", cache);
+
+    REQUIRE(cache.size() == 1);
+    REQUIRE(&result == &result2);
+    REQUIRE(result.report.warnings.size() == 1);
+    REQUIRE(result.report.warnings[0].message == "URI template expression \"id-x\" contains hyphens. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters");
+    REQUIRE(result.report.warnings[0].location.empty());
+}
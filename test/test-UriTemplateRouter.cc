@@ -0,0 +1,176 @@
+//
+//  test-UriTemplateRouter.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <ctime>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "UriTemplateRouter.h"
+
+using namespace snowcrash;
+
+static const mdp::ByteBuffer RoutesFixture = \
+"FORMAT: 1A\n\n"\
+"# API\n\n"\
+"## Notes [/notes{?limit,offset}]\n"\
+"### List [GET]\n"\
+"+ Response 200\n\n"\
+"### Create [POST]\n"\
+"+ Response 201\n\n"\
+"## Note [/notes/{id}]\n"\
+"### Retrieve [GET]\n"\
+"+ Response 200\n\n"\
+"## Note Text [/notes/{id}.txt]\n"\
+"### Retrieve Text [GET]\n"\
+"+ Response 200\n\n"\
+"## Latest Note [/notes/latest]\n"\
+"### Retrieve Latest [GET]\n"\
+"+ Response 200\n\n"\
+"## File [/files/{+path}]\n"\
+"### Download [GET]\n"\
+"+ Response 200\n\n"\
+"## Label [/labels{.format}]\n"\
+"### Retrieve Label [GET]\n"\
+"+ Response 200\n";
+
+TEST_CASE("Route requests to actions", "[uritemplaterouter]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(RoutesFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    URITemplateRouter router(blueprint.node);
+    REQUIRE(router.size() == 6);
+
+    URIRouteMatch match;
+
+    REQUIRE(router.match("POST", "/notes", "", match));
+    REQUIRE(match.action->name == "Create");
+    REQUIRE(match.bindings.empty());
+
+    REQUIRE(router.match("GET", "/notes", "offset=10&sort=asc", match));
+    REQUIRE(match.action->name == "List");
+    REQUIRE(match.bindings.size() == 1);
+    REQUIRE(match.bindings[0].first == "offset");
+    REQUIRE(match.bindings[0].second == "10");
+
+    REQUIRE(router.match("GET", "/notes/42", "", match));
+    REQUIRE(match.resource->name == "Note");
+    REQUIRE(match.bindings.size() == 1);
+    REQUIRE(match.bindings[0].first == "id");
+    REQUIRE(match.bindings[0].second == "42");
+
+    REQUIRE(router.match("GET", "/notes/42.txt", "", match));
+    REQUIRE(match.resource->name == "Note Text");
+    REQUIRE(match.bindings[0].second == "42");
+
+    REQUIRE(router.match("GET", "/notes/latest", "", match));
+    REQUIRE(match.resource->name == "Latest Note");
+
+    REQUIRE(router.match("GET", "/notes/lat", "", match));
+    REQUIRE(match.resource->name == "Note");
+    REQUIRE(match.bindings[0].second == "lat");
+
+    REQUIRE(router.match("GET", "/files/a/b.txt", "", match));
+    REQUIRE(match.action->name == "Download");
+    REQUIRE(match.bindings[0].first == "path");
+    REQUIRE(match.bindings[0].second == "a/b.txt");
+}
+
+TEST_CASE("Do not route unmatched requests", "[uritemplaterouter]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(RoutesFixture, 0, blueprint);
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    URITemplateRouter router(blueprint.node);
+    URIRouteMatch match;
+
+    REQUIRE_FALSE(router.match("DELETE", "/notes/42", "", match));
+    REQUIRE_FALSE(router.match("GET", "/notes/42/comments", "", match));
+    REQUIRE_FALSE(router.match("GET", "/notes/", "", match));
+    REQUIRE_FALSE(router.match("GET", "/labels.json", "", match));
+    REQUIRE(match.action == NULL);
+}
+
+TEST_CASE("Route variable values containing the characters of other templates", "[uritemplaterouter]")
+{
+    Blueprint blueprint;
+    blueprint.resourceGroups.push_back(ResourceGroup());
+
+    Resource note;
+    note.name = "Note";
+    note.uriTemplate = "/notes/{id}";
+    note.actions.push_back(Action());
+    note.actions.back().method = "GET";
+
+    Resource text = note;
+    text.name = "Note Text";
+    text.uriTemplate = "/notes/{id}.txt";
+
+    blueprint.resourceGroups.back().resources.push_back(note);
+
+    URIRouteMatch match;
+
+    {
+        URITemplateRouter router(blueprint);
+        REQUIRE(router.match("GET", "/notes/v1.2", "", match));
+        REQUIRE(match.resource->name == "Note");
+        REQUIRE(match.bindings[0].second == "v1.2");
+    }
+
+    blueprint.resourceGroups.back().resources.push_back(text);
+    URITemplateRouter router(blueprint);
+
+    REQUIRE(router.match("GET", "/notes/v1.2", "", match));
+    REQUIRE(match.resource->name == "Note");
+    REQUIRE(match.bindings[0].second == "v1.2");
+
+    REQUIRE(router.match("GET", "/notes/v1.2.txt", "", match));
+    REQUIRE(match.resource->name == "Note Text");
+    REQUIRE(match.bindings[0].second == "v1.2");
+
+    REQUIRE_FALSE(router.match("GET", "/notes/v1.2/x", "", match));
+}
+
+TEST_CASE("Route a path of many variable values in linear time", "[uritemplaterouter]")
+{
+    Blueprint blueprint;
+    blueprint.resourceGroups.push_back(ResourceGroup());
+
+    Resource part;
+    part.name = "Part";
+    part.uriTemplate = "/{a}.{b}.{c}.{d}.txt";
+    part.actions.push_back(Action());
+    part.actions.back().method = "GET";
+    blueprint.resourceGroups.back().resources.push_back(part);
+
+    URITemplateRouter router(blueprint);
+    URIRouteMatch match;
+
+    // Every split of the dots is a candidate, retrying them took seconds
+    std::string path = "/";
+
+    while (path.length() < 8000)
+        path += "x.";
+
+    std::clock_t start = std::clock();
+
+    for (size_t i = 0; i < 10; ++i) {
+        REQUIRE_FALSE(router.match("GET", path, "", match));
+    }
+
+    REQUIRE(std::clock() - start < CLOCKS_PER_SEC);
+
+    path += "txt";
+
+    REQUIRE(router.match("GET", path, "", match));
+    REQUIRE(match.bindings.size() == 4);
+    REQUIRE(match.bindings[0].second == "x");
+    REQUIRE(match.bindings[2].second == "x");
+    REQUIRE(match.bindings[3].second.length() == path.length() - 11);
+}
@@ -92,3 +92,123 @@ TEST_CASE("Warn about unsupported uri template in abbreviated blueprint", "[warn
     REQUIRE(blueprint.report.warnings[0].code == URIWarning);
 }
 
+
+TEST_CASE("Suppress warnings by code", "[warnings]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n"\
+    "## GET /res/{.id}\n";
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.size() == 2);
+
+    ReportOptions reportOptions;
+    reportOptions.suppressedWarnings = WarningCodeMask(EmptyDefinitionWarning);
+
+    ParseResult<Blueprint> filtered;
+    parse(source, 0, reportOptions, filtered);
+
+    REQUIRE(filtered.report.error.code == Error::OK);
+    REQUIRE(filtered.report.warnings.size() == 1);
+    REQUIRE(filtered.report.warnings[0].code == URIWarning);
+    REQUIRE(filtered.node.resourceGroups[0].resources[0].actions.size() == 1);
+}
+
+TEST_CASE("Limit number of warnings", "[warnings]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n"\
+    "## GET /a\n"\
+    "## GET /b\n"\
+    "## GET /c\n";
+
+    ReportOptions reportOptions;
+    reportOptions.maxWarnings = 2;
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, reportOptions, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.size() == 2);
+    REQUIRE(blueprint.node.resourceGroups[0].resources.size() == 3);
+}
+
+TEST_CASE("Stop parsing on the first error", "[warnings]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n"\
+    "# /a\n"\
+    "+ Model\n"\
+    "\n"\
+    "        {}\n"\
+    "\n"\
+    "## GET\n"\
+    "\n"\
+    "# GET /b\n";
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, blueprint);
+
+    REQUIRE(blueprint.report.error.code == SymbolError);
+    REQUIRE(blueprint.report.warnings.size() == 2);
+    REQUIRE(blueprint.node.resourceGroups[0].resources.size() == 2);
+
+    ParseResult<Blueprint> aborted;
+    parse(source, AbortOnErrorOption, aborted);
+
+    REQUIRE(aborted.report.error.code == SymbolError);
+    REQUIRE(aborted.report.warnings.empty());
+    REQUIRE(aborted.node.resourceGroups[0].resources.size() == 1);
+}
+
+TEST_CASE("Validate only reports the warnings of a full parse", "[warnings]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n"\
+    "Description\n"\
+    "\n"\
+    "## Note [/note]\n"\
+    "+ Model (text/plain)\n"\
+    "\n"\
+    "        Hello\n"\
+    "\n"\
+    "### Retrieve [GET]\n"\
+    "+ Request\n"\
+    "\n"\
+    "    [Note][]\n"\
+    "\n"\
+    "+ Response 204\n"\
+    "\n"\
+    "    [Note][]\n"\
+    "\n"\
+    "+ Response 200\n";
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, ExportSourcemapOption, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(!blueprint.report.warnings.empty());
+
+    ParseResult<Blueprint> validated;
+    parse(source, ValidateOnlyOption | ExportSourcemapOption, validated);
+
+    REQUIRE(validated.report.error.code == Error::OK);
+    REQUIRE(validated.report.warnings.size() == blueprint.report.warnings.size());
+
+    for (size_t i = 0; i < blueprint.report.warnings.size(); ++i) {
+        REQUIRE(validated.report.warnings[i].code == blueprint.report.warnings[i].code);
+        REQUIRE(validated.report.warnings[i].message == blueprint.report.warnings[i].message);
+        REQUIRE(validated.report.warnings[i].location.size() == blueprint.report.warnings[i].location.size());
+
+        for (size_t j = 0; j < blueprint.report.warnings[i].location.size(); ++j) {
+            REQUIRE(validated.report.warnings[i].location[j].location == blueprint.report.warnings[i].location[j].location);
+            REQUIRE(validated.report.warnings[i].location[j].length == blueprint.report.warnings[i].location[j].length);
+        }
+    }
+
+    REQUIRE(validated.sourceMap.resourceGroups.collection.empty());
+    REQUIRE(validated.node.resourceGroups[0].resources[0].actions[0].examples[0].requests[0].body.size() == 1);
+}
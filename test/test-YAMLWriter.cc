@@ -0,0 +1,62 @@
+//
+//  test-YAMLWriter.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "catch.hpp"
+#include "YAMLWriter.h"
+
+using namespace snowcrash;
+
+TEST_CASE("Write YAML array items", "[yamlwriter]")
+{
+    std::stringstream ss;
+
+    {
+        YAMLWriter writer(ss);
+        writer.arrayItemLeadIn(0);
+        writer.arrayItemLeadIn(1);
+        writer << "a\n";
+        writer.arrayItemLeadIn(3, false);
+        writer << "\n";
+        writer.indent(2);
+        writer << size_t(42) << "\n";
+    }
+
+    REQUIRE(ss.str() == "- a\n    -\n    42\n");
+}
+
+TEST_CASE("Write quoted YAML scalars", "[yamlwriter]")
+{
+    std::stringstream ss;
+    YAMLWriter writer(ss);
+
+    writer.scalar("Hello World");
+    writer.scalar("a \"quoted\"\nvalue");
+    writer.flush();
+
+    REQUIRE(ss.str() == "\"Hello World\"\"a \\\"quoted\\\"\\nvalue\"");
+}
+
+TEST_CASE("Write YAML scalars with implicit quotation", "[yamlwriter]")
+{
+    std::stringstream ss;
+    YAMLWriter writer(ss);
+
+    writer.scalar("true", false);
+    writer << " ";
+    writer.scalar("2.1", false);
+    writer << " ";
+    writer.scalar("a: b", false);
+    writer << " ";
+    writer.scalar("#hash", false);
+    writer << " ";
+    writer.scalar("new\nline", false);
+    writer.flush();
+
+    REQUIRE(ss.str() == "true 2.1 \"a: b\" \"#hash\" \"new\\nline\"");
+}
@@ -402,3 +402,166 @@ TEST_CASE("Parse blueprint with multiple reference via C interface", "[cinterfac
     sc_blueprint_free(blueprint);
     sc_report_free(report);
 }
+
+TEST_CASE("Parse source of given length with C interface", "[cinterface]")
+{
+    mdp::ByteBuffer source = \
+    "# My API\n"\
+    "## GET /message\n"\
+    "+ Response 200\n"\
+    "\n"\
+    "        Hello World!\n"\
+    "\n"\
+    "# Trailing data not to be parsed\n";
+
+    size_t length = source.find("# Trailing");
+
+    sc_report_t* report;
+    sc_blueprint_t* blueprint;
+    sc_sm_blueprint_t* sm_blueprint;
+
+    sc_c_parse_n(source.data(), length, 0, &report, &blueprint, &sm_blueprint);
+
+    REQUIRE(sc_error_code(sc_error_handler(report)) == 0);
+    REQUIRE(std::string(sc_blueprint_name(blueprint)) == "My API");
+    REQUIRE(sc_resource_group_collection_size(sc_resource_group_collection_handle(blueprint)) == 1);
+    REQUIRE(sm_blueprint == NULL);
+
+    sc_report_free(report);
+    sc_blueprint_free(blueprint);
+
+    sc_c_parse_n(source.data(), length, SC_EXPORT_SORUCEMAP_OPTION, &report, &blueprint, &sm_blueprint);
+
+    REQUIRE(std::string(sc_blueprint_name(blueprint)) == "My API");
+    REQUIRE(sc_sm_resource_group_collection_size(sc_sm_resource_group_collection_handle(sm_blueprint)) == 1);
+
+    sc_report_free(report);
+    sc_blueprint_free(blueprint);
+    sc_sm_blueprint_free(sm_blueprint);
+}
+
+/** Writer accepting only a given number of bytes */
+static size_t LimitedWrite(const char* data, size_t length, void* context)
+{
+    size_t& limit = *static_cast<size_t*>(context);
+    size_t written = (length < limit) ? length : limit;
+
+    limit -= written;
+    return written;
+}
+
+TEST_CASE("Parse and serialize with C interface", "[cinterface]")
+{
+    mdp::ByteBuffer source = \
+    "# My API\n"\
+    "## GET /message\n"\
+    "+ Response 200\n"\
+    "\n"\
+    "        Hello World!\n";
+
+    sc_buffer_t json = { NULL, 0, 0 };
+    sc_report_t* report;
+
+    REQUIRE(sc_c_parse_to_json(source.data(), source.size(), 0, SC_COMPACT_SERIALIZE_OPTION, sc_buffer_write, &json, &report) == 0);
+    REQUIRE(sc_warnings_size(sc_warnings_handler(report)) == 0);
+
+    std::string output(json.data, json.size);
+    REQUIRE(output.find("{\"_version\":\"2.1\",") == 0);
+    REQUIRE(output.find("\"name\":\"My API\"") != std::string::npos);
+
+    sc_report_free(report);
+    sc_buffer_free(&json);
+    REQUIRE(json.data == NULL);
+
+    sc_buffer_t yaml = { NULL, 0, 0 };
+
+    REQUIRE(sc_c_parse_to_yaml(source.data(), source.size(), SC_EXPORT_SORUCEMAP_OPTION, 0, sc_buffer_write, &yaml, NULL) == 0);
+
+    output.assign(yaml.data, yaml.size);
+    REQUIRE(output.find("_version: 2.1\n") == 0);
+    REQUIRE(output.find("\n---\n") != std::string::npos);
+
+    sc_buffer_free(&yaml);
+
+    size_t limit = 10;
+    REQUIRE(sc_c_parse_to_json(source.data(), source.size(), 0, 0, LimitedWrite, &limit, NULL) == 1);
+}
+
+TEST_CASE("Parse in steps with C interface", "[cinterface]")
+{
+    mdp::ByteBuffer source = \
+    "# My API\n"\
+    "# Group Messages\n"\
+    "## Message [/message]\n"\
+    "### GET\n"\
+    "+ Response 200\n"\
+    "\n"\
+    "        Hello World!\n"\
+    "\n"\
+    "## Messages [/messages]\n"\
+    "### GET\n"\
+    "+ Response 204\n";
+
+    sc_report_t* report;
+    sc_blueprint_t* blueprint;
+    sc_sm_blueprint_t* sm_blueprint;
+
+    sc_parse_context_t* context = sc_parse_context_new(source.data(), source.size(), SC_EXPORT_SORUCEMAP_OPTION, &report, &blueprint, &sm_blueprint);
+
+    int ret;
+    size_t steps = 0;
+
+    while ((ret = sc_parse_context_step(context, 1)) == SC_PARSE_IN_PROGRESS)
+        ++steps;
+
+    sc_parse_context_free(context);
+
+    REQUIRE(ret == 0);
+    REQUIRE(steps > 3);
+    REQUIRE(std::string(sc_blueprint_name(blueprint)) == "My API");
+
+    const sc_resource_group_collection_t* res_gr_col = sc_resource_group_collection_handle(blueprint);
+    REQUIRE(sc_resource_group_collection_size(res_gr_col) == 1);
+    REQUIRE(sc_resource_collection_size(sc_resource_collection_handle(sc_resource_group_handle(res_gr_col, 0))) == 2);
+    REQUIRE(sc_sm_resource_group_collection_size(sc_sm_resource_group_collection_handle(sm_blueprint)) == 1);
+
+    sc_report_free(report);
+    sc_blueprint_free(blueprint);
+    sc_sm_blueprint_free(sm_blueprint);
+}
+
+TEST_CASE("Parse in steps without source map with C interface", "[cinterface]")
+{
+    mdp::ByteBuffer source = \
+    "# My API\n"\
+    "## Message [/message]\n"\
+    "### GET\n"\
+    "+ Response 204\n";
+
+    sc_report_t* report;
+    sc_blueprint_t* blueprint;
+    sc_sm_blueprint_t* sm_blueprint;
+
+    sc_parse_context_t* context = sc_parse_context_new(source.data(), source.size(), 0, &report, &blueprint, &sm_blueprint);
+    REQUIRE(sm_blueprint == NULL);
+
+    while (sc_parse_context_step(context, 1) == SC_PARSE_IN_PROGRESS);
+    sc_parse_context_free(context);
+
+    REQUIRE(std::string(sc_blueprint_name(blueprint)) == "My API");
+
+    sc_report_free(report);
+    sc_blueprint_free(blueprint);
+
+    context = sc_parse_context_new(source.data(), source.size(), SC_EXPORT_SORUCEMAP_OPTION, &report, &blueprint, NULL);
+    REQUIRE(sc_parse_context_step(context, 100) == SC_PARSE_IN_PROGRESS);
+
+    int ret = sc_parse_context_step(context, 100);
+    sc_parse_context_free(context);
+
+    REQUIRE(ret == 0);
+    REQUIRE(std::string(sc_blueprint_name(blueprint)) == "My API");
+
+    sc_report_free(report);
+    sc_blueprint_free(blueprint);
+}
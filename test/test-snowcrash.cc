@@ -7,8 +7,10 @@
 //
 
 #define CATCH_CONFIG_MAIN
+#include <sstream>
 #include "snowcrashtest.h"
 #include "snowcrash.h"
+#include "SerializeJSON.h"
 
 using namespace snowcrash;
 using namespace snowcrashtest;
@@ -662,3 +664,108 @@ TEST_CASE("Don't mess up sourcemaps when there are references", "[parser][#213]"
     REQUIRE(blueprint.sourceMap.resourceGroups.collection[0].resources.collection[0].actions.collection[0].method.sourceMap[0].location == 111);
     REQUIRE(blueprint.sourceMap.resourceGroups.collection[0].resources.collection[0].actions.collection[0].method.sourceMap[0].length == 8);
 }
+
+TEST_CASE("Reuse parser for multiple blueprints", "[parser]")
+{
+    mdp::ByteBuffer first = \
+    "# API\n"\
+    "## Note [/note]\n"\
+    "+ Model (text/plain)\n\n"\
+    "        Hello\n\n"\
+    "### Retrieve [GET]\n"\
+    "+ Response 200\n\n"\
+    "    [Note][]\n";
+
+    mdp::ByteBuffer second = \
+    "# API 2\n"\
+    "## Users [/users]\n"\
+    "### List [GET]\n"\
+    "+ Response 200\n\n"\
+    "    [Note][]\n";
+
+    Parser parser;
+
+    ParseResult<Blueprint> blueprint;
+    parser.parse(first, ExportSourcemapOption, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.node.resourceGroups[0].resources[0].actions[0].examples[0].responses[0].body == "Hello\n");
+    REQUIRE(blueprint.sourceMap.resourceGroups.collection.size() == 1);
+
+    // Symbols of the previous blueprint are not kept
+    ParseResult<Blueprint> unresolved;
+    parser.parse(second, 0, unresolved);
+
+    ParseResult<Blueprint> expected;
+    parse(second, 0, expected);
+
+    REQUIRE(unresolved.report.error.code == SymbolError);
+    REQUIRE(unresolved.report.error.code == expected.report.error.code);
+    REQUIRE(unresolved.node.name == "API 2");
+
+    ParseResult<Blueprint> again;
+    parser.parse(first, ExportSourcemapOption, again);
+
+    REQUIRE(again.report.error.code == Error::OK);
+    REQUIRE(again.report.warnings.size() == blueprint.report.warnings.size());
+    REQUIRE(again.node.resourceGroups[0].resources[0].actions[0].examples[0].responses[0].body == "Hello\n");
+}
+
+TEST_CASE("Parse in steps", "[parser]")
+{
+    mdp::ByteBuffer source = \
+    "FORMAT: 1A\n\n"\
+    "# API\n"\
+    "Description\n\n"\
+    "## Note [/note]\n"\
+    "+ Model (text/plain)\n\n"\
+    "        Hello\n\n"\
+    "### Retrieve [GET]\n"\
+    "+ Response 200\n\n"\
+    "    [Note][]\n\n"\
+    "# Group Users\n"\
+    "## User [/users/{id}]\n"\
+    "### Retrieve [GET]\n"\
+    "+ Response 204\n\n"\
+    "## Users [/users]\n"\
+    "### List [GET]\n"\
+    "+ Response 200\n\n"\
+    "        []\n\n"\
+    "# Group Users\n";
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, ExportSourcemapOption, blueprint);
+
+    ParseResult<Blueprint> stepped;
+    ParseContext context(source, ExportSourcemapOption, stepped);
+
+    size_t steps = 0;
+
+    while (!context.step(1))
+        ++steps;
+
+    REQUIRE(steps > 6);
+    REQUIRE(context.isDone());
+    REQUIRE(context.step(1));
+
+    REQUIRE(stepped.report.error.code == blueprint.report.error.code);
+    REQUIRE(stepped.report.warnings.size() == blueprint.report.warnings.size());
+    REQUIRE(stepped.report.warnings[0].code == DuplicateWarning);
+
+    std::stringstream ast, steppedAST;
+    SerializeCombinedJSON(blueprint.node, blueprint.sourceMap, ast);
+    SerializeCombinedJSON(stepped.node, stepped.sourceMap, steppedAST);
+
+    REQUIRE(steppedAST.str() == ast.str());
+
+    ParseResult<Blueprint> unbounded;
+    ParseContext unboundedContext(source, 0, unbounded);
+
+    // The first call parses the Markdown only
+    REQUIRE_FALSE(unboundedContext.step(static_cast<size_t>(-1)));
+    REQUIRE(unbounded.node.name.empty());
+
+    REQUIRE(unboundedContext.step(static_cast<size_t>(-1)));
+    REQUIRE(unbounded.node.name == "API");
+    REQUIRE(unbounded.node.resourceGroups.size() == 3);
+}